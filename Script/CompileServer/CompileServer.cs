@@ -0,0 +1,237 @@
+using System.Net;
+using System.Net.Sockets;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Runtime.Loader;
+using System.Text;
+using Microsoft.Build.Evaluation;
+using Microsoft.Build.Execution;
+using Microsoft.Build.Framework;
+using Microsoft.Build.Logging;
+
+namespace CompileServer
+{
+    /// <summary>
+    /// Long-lived publish host for the editor. It keeps MSBuild loaded, jitted and holding the evaluated
+    /// game project between cycles, and receives the changed files of each cycle over a loopback socket.
+    /// Protocol, one UTF-8 line per message:
+    ///   editor -> server: "&lt;Added|Modified|Removed|Unknown&gt;\t&lt;Path&gt;" per changed file, then "Publish"
+    ///   server -> editor: "0" on success, "1" on failure, after the build log has been written
+    ///   editor -> server: "Shutdown", or closing the connection, ends the server
+    /// </summary>
+    internal class CompileServer
+    {
+        static int Main(string[] args)
+        {
+            if (args.Length != 4 || !int.TryParse(args[0], out var Port))
+            {
+                Console.Error.WriteLine("Usage: CompileServer <Port> <Project> <PublishDirectory> <LogFile>");
+
+                return 1;
+            }
+
+            var MSBuildBinPath = typeof(CompileServer).Assembly
+                .GetCustomAttributes<AssemblyMetadataAttribute>()
+                .FirstOrDefault(Attribute => Attribute.Key == "MSBuildBinPath")?.Value;
+
+            if (string.IsNullOrEmpty(MSBuildBinPath) || !File.Exists(Path.Combine(MSBuildBinPath, "MSBuild.dll")))
+            {
+                Console.Error.WriteLine($"MSBuild not found in \"{MSBuildBinPath}\", rebuild the compile server");
+
+                return 2;
+            }
+
+            // the same setup MSBuildLocator does, MSBuild is loaded from the SDK that built this server
+            Environment.SetEnvironmentVariable("MSBUILD_EXE_PATH", Path.Combine(MSBuildBinPath, "MSBuild.dll"));
+
+            Environment.SetEnvironmentVariable("MSBuildExtensionsPath", MSBuildBinPath);
+
+            Environment.SetEnvironmentVariable("MSBuildSDKsPath", Path.Combine(MSBuildBinPath, "Sdks"));
+
+            // tasks that start dotnet themselves, the shared compiler among them, look for the host here
+            var DotNet = Path.GetFullPath(Path.Combine(MSBuildBinPath, "..", "..",
+                OperatingSystem.IsWindows() ? "dotnet.exe" : "dotnet"));
+
+            if (File.Exists(DotNet))
+            {
+                Environment.SetEnvironmentVariable("DOTNET_HOST_PATH", DotNet);
+            }
+
+            AssemblyLoadContext.Default.Resolving += (Context, Name) =>
+            {
+                var AssemblyPath = Path.Combine(MSBuildBinPath, Name.Name + ".dll");
+
+                return File.Exists(AssemblyPath) ? Context.LoadFromAssemblyPath(AssemblyPath) : null;
+            };
+
+            return Serve(Port, args[1], args[2], args[3]);
+        }
+
+        // kept out of Main so no MSBuild type is resolved before the load context knows where to look
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static int Serve(int inPort, string inProject, string inPublishDirectory, string inLogFile)
+        {
+            using var Client = new TcpClient();
+
+            Client.NoDelay = true;
+
+            Client.Connect(IPAddress.Loopback, inPort);
+
+            using var Stream = Client.GetStream();
+
+            using var Reader = new StreamReader(Stream, new UTF8Encoding(false));
+
+            using var Writer = new StreamWriter(Stream, new UTF8Encoding(false));
+
+            Writer.NewLine = "\n";
+
+            Writer.AutoFlush = true;
+
+            var Server = new CompileServer(inProject, inPublishDirectory, inLogFile);
+
+            while (Reader.ReadLine() is { } Line)
+            {
+                if (Line == "Shutdown")
+                {
+                    break;
+                }
+
+                if (Line == "Publish")
+                {
+                    Writer.WriteLine(Server.Publish() ? "0" : "1");
+                }
+                else
+                {
+                    Server.AddChange(Line);
+                }
+            }
+
+            Server.Dispose();
+
+            return 0;
+        }
+
+        private CompileServer(string inProject, string inPublishDirectory, string inLogFile)
+        {
+            _project = Path.GetFullPath(inProject);
+
+            _logFile = inLogFile;
+
+            // what "dotnet publish -c Debug -o <PublishDirectory>" passes
+            _globalProperties = new Dictionary<string, string>
+            {
+                ["Configuration"] = "Debug",
+                ["PublishDir"] = Path.TrimEndingDirectorySeparator(Path.GetFullPath(inPublishDirectory)) +
+                                 Path.DirectorySeparatorChar,
+                ["_CommandLineDefinedOutputPath"] = "true",
+                ["_IsPublishing"] = "true"
+            };
+
+            _projectCollection = new ProjectCollection(_globalProperties);
+
+            _bIsReloadRequired = true;
+        }
+
+        private void Dispose()
+        {
+            _projectCollection.UnloadAllProjects();
+
+            _projectCollection.Dispose();
+        }
+
+        private void AddChange(string inLine)
+        {
+            var Index = inLine.IndexOf('\t');
+
+            var Action = Index >= 0 ? inLine[..Index] : inLine;
+
+            var FileName = Index >= 0 ? inLine[(Index + 1)..] : "";
+
+            // editing a source file leaves the evaluated items as they are, anything else may change them
+            if (Action != "Modified" || !FileName.EndsWith(".cs", StringComparison.OrdinalIgnoreCase))
+            {
+                _bIsReloadRequired = true;
+            }
+        }
+
+        private bool Publish()
+        {
+            try
+            {
+                if (_bIsReloadRequired)
+                {
+                    _projectCollection.UnloadAllProjects();
+
+                    var RestoreProperties = new Dictionary<string, string>(_globalProperties)
+                    {
+                        ["MSBuildRestoreSessionId"] = Guid.NewGuid().ToString("D"),
+                        ["ExcludeRestorePackageImports"] = "true"
+                    };
+
+                    if (!Build(new BuildRequestData(_project, RestoreProperties, null, new[] { "Restore" }, null)))
+                    {
+                        return false;
+                    }
+
+                    // restore rewrites the nuget.g.props and nuget.g.targets the project imports
+                    _projectCollection.UnloadAllProjects();
+
+                    _bIsReloadRequired = false;
+                }
+
+                // LoadProject hands back the cached evaluation until the next reload
+                var ProjectInstance = _projectCollection.LoadProject(_project).CreateProjectInstance();
+
+                if (!Build(new BuildRequestData(ProjectInstance, new[] { "Publish" })))
+                {
+                    // a failed cycle may have left the evaluation behind what is on disk
+                    _bIsReloadRequired = true;
+
+                    return false;
+                }
+
+                return true;
+            }
+            catch (Exception Exception)
+            {
+                File.AppendAllText(_logFile, Exception + Environment.NewLine);
+
+                _bIsReloadRequired = true;
+
+                return false;
+            }
+        }
+
+        private bool Build(BuildRequestData inBuildRequestData)
+        {
+            var Parameters = new BuildParameters(_projectCollection)
+            {
+                Loggers = new ILogger[]
+                {
+                    new FileLogger
+                    {
+                        Parameters = $"LogFile={_logFile};Verbosity=minimal",
+                        Verbosity = LoggerVerbosity.Minimal
+                    }
+                },
+                // everything builds on the in-proc node, so the jitted tasks stay in this process
+                MaxNodeCount = 1,
+                EnableNodeReuse = false
+            };
+
+            var Result = BuildManager.DefaultBuildManager.Build(Parameters, inBuildRequestData);
+
+            return Result.OverallResult == BuildResultCode.Success;
+        }
+
+        private readonly string _project;
+
+        private readonly string _logFile;
+
+        private readonly Dictionary<string, string> _globalProperties;
+
+        private readonly ProjectCollection _projectCollection;
+
+        private bool _bIsReloadRequired;
+    }
+}
@@ -5,7 +5,6 @@ namespace Script.CoreUObject
     public partial class UClass
     {
         public void RemoveFunction(FName InName) =>
-            UClassImplementation.UClass_RemoveFunctionImplementation(GarbageCollectionHandle,
-                InName.GarbageCollectionHandle);
+            UClassImplementation.UClass_RemoveFunctionImplementation(GarbageCollectionHandle, InName);
     }
 }
\ No newline at end of file
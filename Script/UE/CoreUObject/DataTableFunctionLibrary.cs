@@ -10,7 +10,7 @@ namespace Script.Engine
             return UDataTableFunctionLibraryImplementation
                 .UDataTableFunctionLibrary_GetDataTableRowFromNameImplementation(
                     Table.GarbageCollectionHandle,
-                    RowName.GarbageCollectionHandle,
+                    RowName,
                     out OutRow);
         }
     }
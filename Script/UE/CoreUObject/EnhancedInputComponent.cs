@@ -44,7 +44,7 @@ namespace Script.EnhancedInput
 
                 return UEnhancedInputComponentImplementation.UEnhancedInputComponent_BindActionImplementation(
                     GarbageCollectionHandle, Binding.GarbageCollectionHandle, InObject.GarbageCollectionHandle,
-                    Binding.FunctionNameToBind.GarbageCollectionHandle);
+                    Binding.FunctionNameToBind);
             }
 
             return null;
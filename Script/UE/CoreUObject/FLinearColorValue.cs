@@ -0,0 +1,81 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace Script.CoreUObject
+{
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FLinearColorValue : IEquatable<FLinearColorValue>
+    {
+        public float R;
+
+        public float G;
+
+        public float B;
+
+        public float A;
+
+        public FLinearColorValue(float InR, float InG, float InB, float InA = 1.0f)
+        {
+            R = InR;
+
+            G = InG;
+
+            B = InB;
+
+            A = InA;
+        }
+
+        public static FLinearColorValue White => new(1.0f, 1.0f, 1.0f);
+
+        public static FLinearColorValue Black => new(0.0f, 0.0f, 0.0f);
+
+        public static FLinearColorValue Transparent => new(0.0f, 0.0f, 0.0f, 0.0f);
+
+        public static FLinearColorValue operator +(FLinearColorValue X, FLinearColorValue Y) =>
+            new(X.R + Y.R, X.G + Y.G, X.B + Y.B, X.A + Y.A);
+
+        public static FLinearColorValue operator -(FLinearColorValue X, FLinearColorValue Y) =>
+            new(X.R - Y.R, X.G - Y.G, X.B - Y.B, X.A - Y.A);
+
+        public static FLinearColorValue operator *(FLinearColorValue X, FLinearColorValue Y) =>
+            new(X.R * Y.R, X.G * Y.G, X.B * Y.B, X.A * Y.A);
+
+        public static FLinearColorValue operator *(FLinearColorValue X, float Scalar) =>
+            new(X.R * Scalar, X.G * Scalar, X.B * Scalar, X.A * Scalar);
+
+        public static FLinearColorValue operator *(float Scalar, FLinearColorValue X) => X * Scalar;
+
+        public static FLinearColorValue operator /(FLinearColorValue X, float Scalar)
+        {
+            var InvScalar = 1.0f / Scalar;
+
+            return new FLinearColorValue(X.R * InvScalar, X.G * InvScalar, X.B * InvScalar, X.A * InvScalar);
+        }
+
+        public static bool operator ==(FLinearColorValue X, FLinearColorValue Y) =>
+            X.R == Y.R && X.G == Y.G && X.B == Y.B && X.A == Y.A;
+
+        public static bool operator !=(FLinearColorValue X, FLinearColorValue Y) => !(X == Y);
+
+        public static FLinearColorValue Lerp(FLinearColorValue X, FLinearColorValue Y, float Alpha) =>
+            X + Alpha * (Y - X);
+
+        public FLinearColorValue GetClamped(float InMin = 0.0f, float InMax = 1.0f) =>
+            new(Math.Clamp(R, InMin, InMax), Math.Clamp(G, InMin, InMax), Math.Clamp(B, InMin, InMax),
+                Math.Clamp(A, InMin, InMax));
+
+        public float GetLuminance() => R * 0.3f + G * 0.59f + B * 0.11f;
+
+        public static FLinearColorValue From(FLinearColor InLinearColor) => FLinearColor.ToValue(InLinearColor);
+
+        public FLinearColor ToLinearColor() => new(this);
+
+        public bool Equals(FLinearColorValue Other) => this == Other;
+
+        public override bool Equals(object Other) => Other is FLinearColorValue Value && Equals(Value);
+
+        public override int GetHashCode() => HashCode.Combine(R, G, B, A);
+
+        public override string ToString() => $"(R={R:F6},G={G:F6},B={B:F6},A={A:F6})";
+    }
+}
@@ -0,0 +1,41 @@
+using System;
+
+namespace Script.CoreUObject
+{
+    public static class FMathValue
+    {
+        public const double SMALL_NUMBER = 1e-8;
+
+        public const double KINDA_SMALL_NUMBER = 1e-4;
+
+        public const double PI = Math.PI;
+
+        public const double DEG_TO_RAD = PI / 180.0;
+
+        public const double RAD_TO_DEG = 180.0 / PI;
+
+        public static double ClampAxis(double Angle)
+        {
+            Angle %= 360.0;
+
+            if (Angle < 0.0)
+            {
+                Angle += 360.0;
+            }
+
+            return Angle;
+        }
+
+        public static double NormalizeAxis(double Angle)
+        {
+            Angle = ClampAxis(Angle);
+
+            if (Angle > 180.0)
+            {
+                Angle -= 360.0;
+            }
+
+            return Angle;
+        }
+    }
+}
@@ -1,32 +1,39 @@
-﻿using Script.Library;
+﻿using System;
+using System.Runtime.InteropServices;
+using Script.Library;
 
 namespace Script.CoreUObject
 {
-    public class FName : IGarbageCollectionHandle
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FName : IEquatable<FName>
     {
-        public FName()
-        {
-        }
+        public uint ComparisonIndex;
 
-        ~FName() => FNameImplementation.FName_UnRegisterImplementation(GarbageCollectionHandle);
+        public int Number;
 
-        public FName(string InValue) => FNameImplementation.FName_RegisterImplementation(this, InValue);
+#if WITH_EDITOR
+        public uint DisplayIndex;
+#endif
+
+        public FName(string InValue) => FNameImplementation.FName_FromStringImplementation(InValue, out this);
 
         public static implicit operator FName(string InValue) => new(InValue);
 
         public static bool operator ==(FName A, FName B) =>
-            Utils.EqualsTo(A, B, FNameImplementation.FName_IdenticalImplementation);
+            A.ComparisonIndex == B.ComparisonIndex && A.Number == B.Number;
 
         public static bool operator !=(FName A, FName B) => !(A == B);
 
-        public override bool Equals(object Other) => this == Other as FName;
+        public bool Equals(FName Other) => this == Other;
+
+        public override bool Equals(object Other) => Other is FName Name && Equals(Name);
 
-        public override int GetHashCode() => (int)GarbageCollectionHandle;
+        public override int GetHashCode() => HashCode.Combine(ComparisonIndex, Number);
 
-        public override string ToString() => FNameImplementation.FName_ToStringImplementation(GarbageCollectionHandle);
+        public override string ToString() => FNameImplementation.FName_ToStringImplementation(this);
 
-        public static FName NAME_None => FNameImplementation.FName_NAME_NoneImplementation();
+        public bool IsNone() => ComparisonIndex == 0 && Number == 0;
 
-        public nint GarbageCollectionHandle { get; set; }
+        public static FName NAME_None => default;
     }
 }
\ No newline at end of file
@@ -0,0 +1,151 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace Script.CoreUObject
+{
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FQuatValue : IEquatable<FQuatValue>
+    {
+        public double X;
+
+        public double Y;
+
+        public double Z;
+
+        public double W;
+
+        public FQuatValue(double InX, double InY, double InZ, double InW)
+        {
+            X = InX;
+
+            Y = InY;
+
+            Z = InZ;
+
+            W = InW;
+        }
+
+        public FQuatValue(FVectorValue Axis, double AngleRad)
+        {
+            var (S, C) = Math.SinCos(0.5 * AngleRad);
+
+            X = S * Axis.X;
+
+            Y = S * Axis.Y;
+
+            Z = S * Axis.Z;
+
+            W = C;
+        }
+
+        public static FQuatValue Identity => new(0.0, 0.0, 0.0, 1.0);
+
+        public static FQuatValue operator *(FQuatValue A, FQuatValue B) =>
+            new(A.W * B.X + A.X * B.W + A.Y * B.Z - A.Z * B.Y,
+                A.W * B.Y - A.X * B.Z + A.Y * B.W + A.Z * B.X,
+                A.W * B.Z + A.X * B.Y - A.Y * B.X + A.Z * B.W,
+                A.W * B.W - A.X * B.X - A.Y * B.Y - A.Z * B.Z);
+
+        public static FVectorValue operator *(FQuatValue A, FVectorValue V) => A.RotateVector(V);
+
+        public static bool operator ==(FQuatValue A, FQuatValue B) =>
+            A.X == B.X && A.Y == B.Y && A.Z == B.Z && A.W == B.W;
+
+        public static bool operator !=(FQuatValue A, FQuatValue B) => !(A == B);
+
+        public double Size() => Math.Sqrt(X * X + Y * Y + Z * Z + W * W);
+
+        public double SizeSquared() => X * X + Y * Y + Z * Z + W * W;
+
+        public FQuatValue Inverse() => new(-X, -Y, -Z, W);
+
+        public void Normalize(double Tolerance = FMathValue.SMALL_NUMBER)
+        {
+            var SquareSum = X * X + Y * Y + Z * Z + W * W;
+
+            if (SquareSum >= Tolerance)
+            {
+                var Scale = 1.0 / Math.Sqrt(SquareSum);
+
+                X *= Scale;
+
+                Y *= Scale;
+
+                Z *= Scale;
+
+                W *= Scale;
+            }
+            else
+            {
+                this = Identity;
+            }
+        }
+
+        public FQuatValue GetNormalized(double Tolerance = FMathValue.SMALL_NUMBER)
+        {
+            var Result = this;
+
+            Result.Normalize(Tolerance);
+
+            return Result;
+        }
+
+        public FVectorValue RotateVector(FVectorValue V)
+        {
+            var Q = new FVectorValue(X, Y, Z);
+
+            var T = 2.0 * FVectorValue.CrossProduct(Q, V);
+
+            return V + W * T + FVectorValue.CrossProduct(Q, T);
+        }
+
+        public FVectorValue UnrotateVector(FVectorValue V)
+        {
+            var Q = new FVectorValue(-X, -Y, -Z);
+
+            var T = 2.0 * FVectorValue.CrossProduct(Q, V);
+
+            return V + W * T + FVectorValue.CrossProduct(Q, T);
+        }
+
+        public FRotatorValue Rotator()
+        {
+            const double SINGULARITY_THRESHOLD = 0.4999995;
+
+            var SingularityTest = Z * X - W * Y;
+
+            var YawY = 2.0 * (W * Z + X * Y);
+
+            var YawX = 1.0 - 2.0 * (Y * Y + Z * Z);
+
+            var Yaw = Math.Atan2(YawY, YawX) * FMathValue.RAD_TO_DEG;
+
+            if (SingularityTest < -SINGULARITY_THRESHOLD)
+            {
+                return new FRotatorValue(-90.0, Yaw,
+                    FMathValue.NormalizeAxis(-Yaw - 2.0 * Math.Atan2(X, W) * FMathValue.RAD_TO_DEG));
+            }
+
+            if (SingularityTest > SINGULARITY_THRESHOLD)
+            {
+                return new FRotatorValue(90.0, Yaw,
+                    FMathValue.NormalizeAxis(Yaw - 2.0 * Math.Atan2(X, W) * FMathValue.RAD_TO_DEG));
+            }
+
+            return new FRotatorValue(Math.Asin(2.0 * SingularityTest) * FMathValue.RAD_TO_DEG, Yaw,
+                Math.Atan2(-2.0 * (W * X + Y * Z), 1.0 - 2.0 * (X * X + Y * Y)) * FMathValue.RAD_TO_DEG);
+        }
+
+        public static FQuatValue From(FQuat InQuat) => FQuat.ToValue(InQuat);
+
+        public FQuat ToQuat() => new(this);
+
+        public bool Equals(FQuatValue Other) => this == Other;
+
+        public override bool Equals(object Other) => Other is FQuatValue Value && Equals(Value);
+
+        public override int GetHashCode() => HashCode.Combine(X, Y, Z, W);
+
+        public override string ToString() => $"X={X:F6} Y={Y:F6} Z={Z:F6} W={W:F6}";
+    }
+}
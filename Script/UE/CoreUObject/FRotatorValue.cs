@@ -0,0 +1,102 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace Script.CoreUObject
+{
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FRotatorValue : IEquatable<FRotatorValue>
+    {
+        public double Pitch;
+
+        public double Yaw;
+
+        public double Roll;
+
+        public FRotatorValue(double InPitch, double InYaw, double InRoll)
+        {
+            Pitch = InPitch;
+
+            Yaw = InYaw;
+
+            Roll = InRoll;
+        }
+
+        public static FRotatorValue ZeroRotator => new(0.0, 0.0, 0.0);
+
+        public static FRotatorValue operator +(FRotatorValue A, FRotatorValue B) =>
+            new(A.Pitch + B.Pitch, A.Yaw + B.Yaw, A.Roll + B.Roll);
+
+        public static FRotatorValue operator -(FRotatorValue A, FRotatorValue B) =>
+            new(A.Pitch - B.Pitch, A.Yaw - B.Yaw, A.Roll - B.Roll);
+
+        public static FRotatorValue operator *(FRotatorValue A, double Scale) =>
+            new(A.Pitch * Scale, A.Yaw * Scale, A.Roll * Scale);
+
+        public static FRotatorValue operator *(double Scale, FRotatorValue A) => A * Scale;
+
+        public static bool operator ==(FRotatorValue A, FRotatorValue B) =>
+            A.Pitch == B.Pitch && A.Yaw == B.Yaw && A.Roll == B.Roll;
+
+        public static bool operator !=(FRotatorValue A, FRotatorValue B) => !(A == B);
+
+        public FRotatorValue GetNormalized() =>
+            new(FMathValue.NormalizeAxis(Pitch), FMathValue.NormalizeAxis(Yaw), FMathValue.NormalizeAxis(Roll));
+
+        public void Normalize()
+        {
+            Pitch = FMathValue.NormalizeAxis(Pitch);
+
+            Yaw = FMathValue.NormalizeAxis(Yaw);
+
+            Roll = FMathValue.NormalizeAxis(Roll);
+        }
+
+        public FQuatValue Quaternion()
+        {
+            const double RADS_DIVIDED_BY_2 = FMathValue.DEG_TO_RAD / 2.0;
+
+            var PitchNoWinding = Pitch % 360.0;
+
+            var YawNoWinding = Yaw % 360.0;
+
+            var RollNoWinding = Roll % 360.0;
+
+            var (SP, CP) = Math.SinCos(PitchNoWinding * RADS_DIVIDED_BY_2);
+
+            var (SY, CY) = Math.SinCos(YawNoWinding * RADS_DIVIDED_BY_2);
+
+            var (SR, CR) = Math.SinCos(RollNoWinding * RADS_DIVIDED_BY_2);
+
+            return new FQuatValue(
+                CR * SP * SY - SR * CP * CY,
+                -CR * SP * CY - SR * CP * SY,
+                CR * CP * SY - SR * SP * CY,
+                CR * CP * CY + SR * SP * SY);
+        }
+
+        public FVectorValue Vector()
+        {
+            var (SP, CP) = Math.SinCos((Pitch % 360.0) * FMathValue.DEG_TO_RAD);
+
+            var (SY, CY) = Math.SinCos((Yaw % 360.0) * FMathValue.DEG_TO_RAD);
+
+            return new FVectorValue(CP * CY, CP * SY, SP);
+        }
+
+        public FVectorValue RotateVector(FVectorValue V) => Quaternion().RotateVector(V);
+
+        public FVectorValue UnrotateVector(FVectorValue V) => Quaternion().UnrotateVector(V);
+
+        public static FRotatorValue From(FRotator InRotator) => FRotator.ToValue(InRotator);
+
+        public FRotator ToRotator() => new(this);
+
+        public bool Equals(FRotatorValue Other) => this == Other;
+
+        public override bool Equals(object Other) => Other is FRotatorValue Value && Equals(Value);
+
+        public override int GetHashCode() => HashCode.Combine(Pitch, Yaw, Roll);
+
+        public override string ToString() => $"P={Pitch:F6} Y={Yaw:F6} R={Roll:F6}";
+    }
+}
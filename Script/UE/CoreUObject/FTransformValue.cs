@@ -0,0 +1,85 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace Script.CoreUObject
+{
+    // Mirrors the vectorized native layout, where Translation and Scale3D are stored as 4-wide registers
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FTransformValue : IEquatable<FTransformValue>
+    {
+        public FQuatValue Rotation;
+
+        public FVectorValue Translation;
+
+        private double TranslationW;
+
+        public FVectorValue Scale3D;
+
+        private double Scale3DW;
+
+        public FTransformValue(FQuatValue InRotation, FVectorValue InTranslation, FVectorValue InScale3D)
+        {
+            Rotation = InRotation;
+
+            Translation = InTranslation;
+
+            TranslationW = 0.0;
+
+            Scale3D = InScale3D;
+
+            Scale3DW = 0.0;
+        }
+
+        public FTransformValue(FRotatorValue InRotation, FVectorValue InTranslation, FVectorValue InScale3D) :
+            this(InRotation.Quaternion(), InTranslation, InScale3D)
+        {
+        }
+
+        public static FTransformValue Identity =>
+            new(FQuatValue.Identity, FVectorValue.ZeroVector, FVectorValue.OneVector);
+
+        public static FTransformValue operator *(FTransformValue A, FTransformValue B) =>
+            new(B.Rotation * A.Rotation,
+                B.Rotation.RotateVector(B.Scale3D * A.Translation) + B.Translation,
+                A.Scale3D * B.Scale3D);
+
+        public static bool operator ==(FTransformValue A, FTransformValue B) =>
+            A.Rotation == B.Rotation && A.Translation == B.Translation && A.Scale3D == B.Scale3D;
+
+        public static bool operator !=(FTransformValue A, FTransformValue B) => !(A == B);
+
+        public FRotatorValue Rotator() => Rotation.Rotator();
+
+        public FVectorValue TransformPosition(FVectorValue V) => Rotation.RotateVector(Scale3D * V) + Translation;
+
+        public FVectorValue TransformPositionNoScale(FVectorValue V) => Rotation.RotateVector(V) + Translation;
+
+        public FVectorValue TransformVector(FVectorValue V) => Rotation.RotateVector(Scale3D * V);
+
+        public FVectorValue TransformVectorNoScale(FVectorValue V) => Rotation.RotateVector(V);
+
+        public FVectorValue InverseTransformPosition(FVectorValue V) =>
+            Rotation.UnrotateVector(V - Translation) * GetSafeScaleReciprocal(Scale3D);
+
+        public FVectorValue InverseTransformVector(FVectorValue V) =>
+            Rotation.UnrotateVector(V) * GetSafeScaleReciprocal(Scale3D);
+
+        public static FVectorValue GetSafeScaleReciprocal(FVectorValue InScale,
+            double Tolerance = FMathValue.SMALL_NUMBER) =>
+            new(Math.Abs(InScale.X) <= Tolerance ? 0.0 : 1.0 / InScale.X,
+                Math.Abs(InScale.Y) <= Tolerance ? 0.0 : 1.0 / InScale.Y,
+                Math.Abs(InScale.Z) <= Tolerance ? 0.0 : 1.0 / InScale.Z);
+
+        public static FTransformValue From(FTransform InTransform) => FTransform.ToValue(InTransform);
+
+        public FTransform ToTransform() => new(this);
+
+        public bool Equals(FTransformValue Other) => this == Other;
+
+        public override bool Equals(object Other) => Other is FTransformValue Value && Equals(Value);
+
+        public override int GetHashCode() => HashCode.Combine(Rotation, Translation, Scale3D);
+
+        public override string ToString() => $"{Translation}|{Rotator()}|{Scale3D}";
+    }
+}
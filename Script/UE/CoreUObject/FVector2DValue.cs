@@ -0,0 +1,87 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace Script.CoreUObject
+{
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FVector2DValue : IEquatable<FVector2DValue>
+    {
+        public double X;
+
+        public double Y;
+
+        public FVector2DValue(double InX, double InY)
+        {
+            X = InX;
+
+            Y = InY;
+        }
+
+        public static FVector2DValue ZeroVector => new(0.0, 0.0);
+
+        public static FVector2DValue UnitVector => new(1.0, 1.0);
+
+        public static FVector2DValue operator +(FVector2DValue A, FVector2DValue B) => new(A.X + B.X, A.Y + B.Y);
+
+        public static FVector2DValue operator -(FVector2DValue A, FVector2DValue B) => new(A.X - B.X, A.Y - B.Y);
+
+        public static FVector2DValue operator -(FVector2DValue A) => new(-A.X, -A.Y);
+
+        public static FVector2DValue operator *(FVector2DValue A, FVector2DValue B) => new(A.X * B.X, A.Y * B.Y);
+
+        public static FVector2DValue operator *(FVector2DValue A, double Scale) => new(A.X * Scale, A.Y * Scale);
+
+        public static FVector2DValue operator *(double Scale, FVector2DValue A) => A * Scale;
+
+        public static FVector2DValue operator /(FVector2DValue A, double Scale)
+        {
+            var RScale = 1.0 / Scale;
+
+            return new FVector2DValue(A.X * RScale, A.Y * RScale);
+        }
+
+        public static double operator |(FVector2DValue A, FVector2DValue B) => DotProduct(A, B);
+
+        public static double operator ^(FVector2DValue A, FVector2DValue B) => CrossProduct(A, B);
+
+        public static bool operator ==(FVector2DValue A, FVector2DValue B) => A.X == B.X && A.Y == B.Y;
+
+        public static bool operator !=(FVector2DValue A, FVector2DValue B) => !(A == B);
+
+        public static double DotProduct(FVector2DValue A, FVector2DValue B) => A.X * B.X + A.Y * B.Y;
+
+        public static double CrossProduct(FVector2DValue A, FVector2DValue B) => A.X * B.Y - A.Y * B.X;
+
+        public static double Distance(FVector2DValue V1, FVector2DValue V2) => (V2 - V1).Size();
+
+        public double Size() => Math.Sqrt(X * X + Y * Y);
+
+        public double SizeSquared() => X * X + Y * Y;
+
+        public FVector2DValue GetSafeNormal(double Tolerance = FMathValue.SMALL_NUMBER)
+        {
+            var SquareSum = X * X + Y * Y;
+
+            if (SquareSum > Tolerance)
+            {
+                var Scale = 1.0 / Math.Sqrt(SquareSum);
+
+                return new FVector2DValue(X * Scale, Y * Scale);
+            }
+
+            return ZeroVector;
+        }
+
+        public static FVector2DValue From(FVector2D InVector2D) => FVector2D.ToValue(InVector2D);
+
+        public FVector2D ToVector2D() => new(this);
+
+        public bool Equals(FVector2DValue Other) => this == Other;
+
+        public override bool Equals(object Other) => Other is FVector2DValue Value && Equals(Value);
+
+        public override int GetHashCode() => HashCode.Combine(X, Y);
+
+        public override string ToString() => $"X={X:F3} Y={Y:F3}";
+    }
+}
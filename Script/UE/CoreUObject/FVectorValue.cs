@@ -0,0 +1,139 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace Script.CoreUObject
+{
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FVectorValue : IEquatable<FVectorValue>
+    {
+        public double X;
+
+        public double Y;
+
+        public double Z;
+
+        public FVectorValue(double InX, double InY, double InZ)
+        {
+            X = InX;
+
+            Y = InY;
+
+            Z = InZ;
+        }
+
+        public FVectorValue(double InF) : this(InF, InF, InF)
+        {
+        }
+
+        public static FVectorValue ZeroVector => new(0.0, 0.0, 0.0);
+
+        public static FVectorValue OneVector => new(1.0, 1.0, 1.0);
+
+        public static FVectorValue UpVector => new(0.0, 0.0, 1.0);
+
+        public static FVectorValue ForwardVector => new(1.0, 0.0, 0.0);
+
+        public static FVectorValue RightVector => new(0.0, 1.0, 0.0);
+
+        public static FVectorValue operator +(FVectorValue A, FVectorValue B) => new(A.X + B.X, A.Y + B.Y, A.Z + B.Z);
+
+        public static FVectorValue operator -(FVectorValue A, FVectorValue B) => new(A.X - B.X, A.Y - B.Y, A.Z - B.Z);
+
+        public static FVectorValue operator -(FVectorValue A) => new(-A.X, -A.Y, -A.Z);
+
+        public static FVectorValue operator *(FVectorValue A, FVectorValue B) => new(A.X * B.X, A.Y * B.Y, A.Z * B.Z);
+
+        public static FVectorValue operator *(FVectorValue A, double Scale) => new(A.X * Scale, A.Y * Scale, A.Z * Scale);
+
+        public static FVectorValue operator *(double Scale, FVectorValue A) => A * Scale;
+
+        public static FVectorValue operator /(FVectorValue A, FVectorValue B) => new(A.X / B.X, A.Y / B.Y, A.Z / B.Z);
+
+        public static FVectorValue operator /(FVectorValue A, double Scale)
+        {
+            var RScale = 1.0 / Scale;
+
+            return new FVectorValue(A.X * RScale, A.Y * RScale, A.Z * RScale);
+        }
+
+        public static double operator |(FVectorValue A, FVectorValue B) => DotProduct(A, B);
+
+        public static FVectorValue operator ^(FVectorValue A, FVectorValue B) => CrossProduct(A, B);
+
+        public static bool operator ==(FVectorValue A, FVectorValue B) => A.X == B.X && A.Y == B.Y && A.Z == B.Z;
+
+        public static bool operator !=(FVectorValue A, FVectorValue B) => !(A == B);
+
+        public static double DotProduct(FVectorValue A, FVectorValue B) => A.X * B.X + A.Y * B.Y + A.Z * B.Z;
+
+        public static FVectorValue CrossProduct(FVectorValue A, FVectorValue B) =>
+            new(A.Y * B.Z - A.Z * B.Y, A.Z * B.X - A.X * B.Z, A.X * B.Y - A.Y * B.X);
+
+        public static double Dist(FVectorValue V1, FVectorValue V2) => (V2 - V1).Size();
+
+        public static double DistSquared(FVectorValue V1, FVectorValue V2) => (V2 - V1).SizeSquared();
+
+        public static FVectorValue Lerp(FVectorValue A, FVectorValue B, double Alpha) => A + Alpha * (B - A);
+
+        public double Size() => Math.Sqrt(X * X + Y * Y + Z * Z);
+
+        public double SizeSquared() => X * X + Y * Y + Z * Z;
+
+        public bool IsNearlyZero(double Tolerance = FMathValue.KINDA_SMALL_NUMBER) =>
+            Math.Abs(X) <= Tolerance && Math.Abs(Y) <= Tolerance && Math.Abs(Z) <= Tolerance;
+
+        public bool Equals(FVectorValue V, double Tolerance) =>
+            Math.Abs(X - V.X) <= Tolerance && Math.Abs(Y - V.Y) <= Tolerance && Math.Abs(Z - V.Z) <= Tolerance;
+
+        public FVectorValue GetSafeNormal(double Tolerance = FMathValue.SMALL_NUMBER)
+        {
+            var SquareSum = X * X + Y * Y + Z * Z;
+
+            if (SquareSum == 1.0)
+            {
+                return this;
+            }
+
+            if (SquareSum < Tolerance)
+            {
+                return ZeroVector;
+            }
+
+            var Scale = 1.0 / Math.Sqrt(SquareSum);
+
+            return new FVectorValue(X * Scale, Y * Scale, Z * Scale);
+        }
+
+        public bool Normalize(double Tolerance = FMathValue.SMALL_NUMBER)
+        {
+            var SquareSum = X * X + Y * Y + Z * Z;
+
+            if (SquareSum > Tolerance)
+            {
+                var Scale = 1.0 / Math.Sqrt(SquareSum);
+
+                X *= Scale;
+
+                Y *= Scale;
+
+                Z *= Scale;
+
+                return true;
+            }
+
+            return false;
+        }
+
+        public static FVectorValue From(FVector InVector) => FVector.ToValue(InVector);
+
+        public FVector ToVector() => new(this);
+
+        public bool Equals(FVectorValue Other) => this == Other;
+
+        public override bool Equals(object Other) => Other is FVectorValue Value && Equals(Value);
+
+        public override int GetHashCode() => HashCode.Combine(X, Y, Z);
+
+        public override string ToString() => $"X={X:F3} Y={Y:F3} Z={Z:F3}";
+    }
+}
@@ -40,7 +40,7 @@ namespace Script.Engine
                     GarbageCollectionHandle,
                     InputActionDelegateBinding.GarbageCollectionHandle,
                     InObject.GarbageCollectionHandle,
-                    Binding.FunctionNameToBind.GarbageCollectionHandle);
+                    Binding.FunctionNameToBind);
             }
         }
 
@@ -74,7 +74,7 @@ namespace Script.Engine
                     GarbageCollectionHandle,
                     InputAxisDelegateBinding.GarbageCollectionHandle,
                     InObject.GarbageCollectionHandle,
-                    Binding.FunctionNameToBind.GarbageCollectionHandle);
+                    Binding.FunctionNameToBind);
             }
         }
 
@@ -108,7 +108,7 @@ namespace Script.Engine
                     GarbageCollectionHandle,
                     InputAxisKeyDelegateBinding.GarbageCollectionHandle,
                     InObject.GarbageCollectionHandle,
-                    Binding.FunctionNameToBind.GarbageCollectionHandle);
+                    Binding.FunctionNameToBind);
             }
         }
 
@@ -144,7 +144,7 @@ namespace Script.Engine
                     GarbageCollectionHandle,
                     InputKeyDelegateBinding.GarbageCollectionHandle,
                     InObject.GarbageCollectionHandle,
-                    Binding.FunctionNameToBind.GarbageCollectionHandle);
+                    Binding.FunctionNameToBind);
             }
         }
 
@@ -193,7 +193,7 @@ namespace Script.Engine
                     GarbageCollectionHandle,
                     InputTouchDelegateBinding.GarbageCollectionHandle,
                     InObject.GarbageCollectionHandle,
-                    Binding.FunctionNameToBind.GarbageCollectionHandle);
+                    Binding.FunctionNameToBind);
             }
         }
 
@@ -227,7 +227,7 @@ namespace Script.Engine
                     GarbageCollectionHandle,
                     InputVectorAxisDelegateBinding.GarbageCollectionHandle,
                     InObject.GarbageCollectionHandle,
-                    Binding.FunctionNameToBind.GarbageCollectionHandle);
+                    Binding.FunctionNameToBind);
             }
         }
 
@@ -1,4 +1,5 @@
-﻿using System.Collections;
+﻿using System;
+using System.Collections;
 using System.Collections.Generic;
 using Script.Library;
 
@@ -53,6 +54,31 @@ namespace Script.CoreUObject
 
         public int Max() => TArrayImplementation.TArray_MaxImplementation(GarbageCollectionHandle);
 
+        /// <summary>
+        /// Views the elements in place without a call per element, see TArraySpan for when the view becomes invalid.
+        /// Only plain old data elements are supported, TElement must be the managed type of the element, its
+        /// underlying integer type for enums, or the matching value type such as FVectorValue for math structs.
+        /// Keep this TArray referenced for as long as the view is used.
+        /// </summary>
+        public TArraySpan<TElement> AsSpan<TElement>() where TElement : unmanaged
+        {
+            unsafe
+            {
+                void* Data;
+
+                int Num;
+
+                if (!TArrayImplementation.TArray_GetDataImplementation(GarbageCollectionHandle, typeof(TElement),
+                        sizeof(TElement), &Data, &Num))
+                {
+                    throw new InvalidOperationException(
+                        $"TArray<{typeof(T).Name}> can not be viewed as a span of {typeof(TElement).Name}.");
+                }
+
+                return new TArraySpan<TElement>(this, new Span<TElement>(Data, Num));
+            }
+        }
+
         public T this[int InIndex]
         {
             get
@@ -0,0 +1,82 @@
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using Script.Library;
+
+namespace Script.CoreUObject
+{
+    /// <summary>
+    /// The elements of a TArray viewed in place, reads and writes go straight to the native allocation.
+    /// Anything that changes Num or reallocates the array invalidates the view, this includes Add, Insert, Remove,
+    /// Reset, Empty and SetNum from C# as well as any change made by native code.
+    /// Debug builds check the view on every access through it, the Span it hands out is never checked.
+    /// </summary>
+    public readonly ref struct TArraySpan<TElement> where TElement : unmanaged
+    {
+        internal TArraySpan(IGarbageCollectionHandle InArray, Span<TElement> InElements)
+        {
+            Array = InArray;
+
+            Elements = InElements;
+        }
+
+        public int Length => Elements.Length;
+
+        public bool IsEmpty => Elements.IsEmpty;
+
+        public ref TElement this[int InIndex]
+        {
+            get
+            {
+                CheckValid();
+
+                return ref Elements[InIndex];
+            }
+        }
+
+        public Span<TElement> Span
+        {
+            get
+            {
+                CheckValid();
+
+                return Elements;
+            }
+        }
+
+        public Span<TElement>.Enumerator GetEnumerator()
+        {
+            CheckValid();
+
+            return Elements.GetEnumerator();
+        }
+
+        public static implicit operator Span<TElement>(TArraySpan<TElement> InSpan) => InSpan.Span;
+
+        public static implicit operator ReadOnlySpan<TElement>(TArraySpan<TElement> InSpan) => InSpan.Span;
+
+        [Conditional("DEBUG")]
+        private void CheckValid()
+        {
+            unsafe
+            {
+                void* Data;
+
+                int Num;
+
+                if (!TArrayImplementation.TArray_GetDataImplementation(Array.GarbageCollectionHandle,
+                        typeof(TElement), sizeof(TElement), &Data, &Num) ||
+                    Data != Unsafe.AsPointer(ref MemoryMarshal.GetReference(Elements)) ||
+                    Num != Elements.Length)
+                {
+                    throw new InvalidOperationException("TArray was resized or reallocated after AsSpan.");
+                }
+            }
+        }
+
+        private readonly IGarbageCollectionHandle Array;
+
+        private readonly Span<TElement> Elements;
+    }
+}
@@ -9,7 +9,7 @@ namespace Script.CoreUObject
     {
         public static T NewObject<T>(UObject Outer = null,
             UClass Class = null,
-            FName Name = null,
+            FName Name = default,
             EObjectFlags Flags = EObjectFlags.RF_NoFlags,
             UObject Template = null,
             bool bCopyTransientsFromClassDefaults = false
@@ -17,17 +17,17 @@ namespace Script.CoreUObject
             UnrealImplementation.Unreal_NewObjectImplementation<T>(
                 Outer?.GarbageCollectionHandle ?? GetTransientPackage().GarbageCollectionHandle,
                 Class?.GarbageCollectionHandle ?? T.StaticClass().GarbageCollectionHandle,
-                Name?.GarbageCollectionHandle ?? FName.NAME_None.GarbageCollectionHandle,
+                Name,
                 Flags,
                 Template?.GarbageCollectionHandle ?? nint.Zero,
                 bCopyTransientsFromClassDefaults);
 
-        public static T DuplicateObject<T>(UObject SourceObject, UObject Outer = null, FName Name = null)
+        public static T DuplicateObject<T>(UObject SourceObject, UObject Outer = null, FName Name = default)
             where T : UObject =>
             UnrealImplementation.Unreal_DuplicateObjectImplementation<T>(
                 SourceObject?.GarbageCollectionHandle ?? nint.Zero,
                 Outer?.GarbageCollectionHandle ?? nint.Zero,
-                Name?.GarbageCollectionHandle ?? FName.NAME_None.GarbageCollectionHandle);
+                Name);
 
         public static T LoadObject<T>(UObject Outer = null,
             FString Name = null,
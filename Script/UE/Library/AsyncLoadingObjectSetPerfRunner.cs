@@ -0,0 +1,39 @@
+using System;
+
+namespace Script.Library;
+
+/// <summary>
+/// Only available in non-shipping builds.
+/// </summary>
+public static unsafe class AsyncLoadingObjectSetPerfRunner
+{
+    public static void RunScaling(int objectsPerPackage = 50)
+    {
+        RunCompare(200, objectsPerPackage);
+        RunCompare(1_000, objectsPerPackage);
+        RunCompare(4_000, objectsPerPackage);
+    }
+
+    public static void RunCompare(int packageCount = 200, int objectsPerPackage = 50)
+    {
+        if (packageCount <= 0) throw new ArgumentOutOfRangeException(nameof(packageCount));
+        if (objectsPerPackage <= 0) throw new ArgumentOutOfRangeException(nameof(objectsPerPackage));
+        if ((long)packageCount * objectsPerPackage > int.MaxValue)
+            throw new ArgumentOutOfRangeException(nameof(packageCount));
+
+        double arrayMs, setMs;
+
+        var countOk = FAsyncLoadingObjectSetPerfImplementation.FAsyncLoadingObjectSetPerf_CompareImplementation(
+            packageCount, objectsPerPackage, &arrayMs, &setMs);
+
+        // the set must bind exactly the objects that finished loading and were not destroyed while streaming
+        if (!countOk) throw new InvalidOperationException("AsyncLoadingObjectSetPerfRunner check failed: bound count");
+
+        Console.WriteLine(
+            $"[AsyncLoadingObjectSetCompare] packages={packageCount} objectsPerPackage={objectsPerPackage} " +
+            $"objects={packageCount * objectsPerPackage} " +
+            $"arrayUsPerFlush={arrayMs * 1_000.0 / packageCount:F2} " +
+            $"setUsPerFlush={setMs * 1_000.0 / packageCount:F2} " +
+            $"speedup={arrayMs / Math.Max(0.000001, setMs):F2}x");
+    }
+}
@@ -0,0 +1,27 @@
+using System;
+
+namespace Script.Library;
+
+/// <summary>
+/// The offsets themselves are checked at compile time, this only compares the cost of reading them.
+/// Only available in non-shipping builds.
+/// </summary>
+public static unsafe class BufferOffsetPerfRunner
+{
+    public static void RunCompare(int argumentCount = 8, int iterations = 1_000_000)
+    {
+        if (argumentCount is < 0 or > 8) throw new ArgumentOutOfRangeException(nameof(argumentCount));
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        double runtimeNs, constexprNs;
+
+        var ok = FBufferOffsetPerfImplementation.FBufferOffsetPerf_CompareImplementation(argumentCount,
+            iterations, &runtimeNs, &constexprNs);
+
+        if (!ok) throw new InvalidOperationException("BufferOffsetPerfRunner check failed: arguments differ");
+
+        Console.WriteLine(
+            $"[BufferOffsetCompare] arguments={argumentCount} iterations={iterations} " +
+            $"runtimeNsPerCall={runtimeNs:F3} constexprNsPerCall={constexprNs:F3}");
+    }
+}
@@ -1,10 +1,11 @@
 using System.Runtime.CompilerServices;
+using Script.CoreUObject;
 
 namespace Script.Library
 {
     public static partial class UClassImplementation
     {
         [MethodImpl(MethodImplOptions.InternalCall)]
-        public static extern void UClass_RemoveFunctionImplementation(nint InClass, nint InName);
+        public static extern void UClass_RemoveFunctionImplementation(nint InClass, in FName InName);
     }
 }
\ No newline at end of file
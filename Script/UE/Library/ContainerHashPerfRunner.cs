@@ -0,0 +1,156 @@
+using System;
+using System.Diagnostics;
+using Script.CoreUObject;
+
+namespace Script.Library;
+
+public static class ContainerHashPerfRunner
+{
+    public static void RunScaling()
+    {
+        RunMap(10_000);
+        RunMap(100_000);
+        RunSet(10_000);
+        RunSet(100_000);
+        RunStringMap(10_000);
+    }
+
+    public static void RunMap(int count)
+    {
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count));
+
+        var map = new TMap<int, int>();
+
+        var sw = Stopwatch.StartNew();
+        for (var i = 0; i < count; i++)
+        {
+            map.Add(i, i * 2);
+        }
+        var addMs = sw.Elapsed.TotalMilliseconds;
+
+        Check(map.Num() == count, "map count after add");
+
+        sw.Restart();
+        for (var i = 0; i < count; i++)
+        {
+            Check(map.Find(i) == i * 2, "map find");
+        }
+        var findMs = sw.Elapsed.TotalMilliseconds;
+
+        for (var i = 0; i < count; i++)
+        {
+            map[i] = i + 1;
+        }
+
+        Check(map.Num() == count, "map count after overwrite");
+        Check(map[count - 1] == count, "map overwrite value");
+        Check(!map.Contains(count), "map contains missing");
+
+        sw.Restart();
+        var removed = 0;
+        for (var i = 0; i < count; i += 2)
+        {
+            removed += map.Remove(i);
+        }
+        var removeMs = sw.Elapsed.TotalMilliseconds;
+
+        Check(removed == (count + 1) / 2, "map removed count");
+        Check(map.Num() == count - removed, "map count after remove");
+
+        for (var i = 0; i < count; i++)
+        {
+            Check(map.Contains(i) == (i % 2 == 1), "map contains after remove");
+        }
+
+        Check(map.Remove(0) == 0, "map remove missing");
+
+        Console.WriteLine(
+            $"[ContainerHashMap] count={count} add={addMs:F3}ms find={findMs:F3}ms remove={removeMs:F3}ms " +
+            $"addNsPerOp={addMs * 1_000_000.0 / count:F2} findNsPerOp={findMs * 1_000_000.0 / count:F2}");
+    }
+
+    public static void RunSet(int count)
+    {
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count));
+
+        var set = new TSet<int>();
+
+        var sw = Stopwatch.StartNew();
+        for (var i = 0; i < count; i++)
+        {
+            set.Add(i);
+        }
+        var addMs = sw.Elapsed.TotalMilliseconds;
+
+        for (var i = 0; i < count; i++)
+        {
+            set.Add(i);
+        }
+
+        Check(set.Num() == count, "set count after duplicate add");
+
+        sw.Restart();
+        for (var i = 0; i < count; i++)
+        {
+            Check(set.Contains(i), "set contains");
+        }
+        var containsMs = sw.Elapsed.TotalMilliseconds;
+
+        Check(!set.Contains(-1), "set contains missing");
+
+        sw.Restart();
+        var removed = 0;
+        for (var i = 0; i < count; i += 2)
+        {
+            removed += set.Remove(i);
+        }
+        var removeMs = sw.Elapsed.TotalMilliseconds;
+
+        Check(set.Num() == count - removed, "set count after remove");
+        Check(!set.Contains(0) && (count < 2 || set.Contains(1)), "set contains after remove");
+
+        Console.WriteLine(
+            $"[ContainerHashSet] count={count} add={addMs:F3}ms contains={containsMs:F3}ms remove={removeMs:F3}ms " +
+            $"addNsPerOp={addMs * 1_000_000.0 / count:F2} containsNsPerOp={containsMs * 1_000_000.0 / count:F2}");
+    }
+
+    public static void RunStringMap(int count)
+    {
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count));
+
+        var map = new TMap<FString, int>();
+
+        var sw = Stopwatch.StartNew();
+        for (var i = 0; i < count; i++)
+        {
+            map.Add(new FString($"Key{i}"), i);
+        }
+        var addMs = sw.Elapsed.TotalMilliseconds;
+
+        map.Add(new FString("Key0"), -1);
+
+        Check(map.Num() == count, "string map count");
+        Check(map[new FString("Key0")] == -1, "string map overwrite");
+
+        sw.Restart();
+        for (var i = 1; i < count; i++)
+        {
+            Check(map.Find(new FString($"Key{i}")) == i, "string map find");
+        }
+        var findMs = sw.Elapsed.TotalMilliseconds;
+
+        Check(map.Remove(new FString("Key0")) == 1, "string map remove");
+        Check(!map.Contains(new FString("Key0")), "string map contains after remove");
+
+        Console.WriteLine(
+            $"[ContainerHashStringMap] count={count} add={addMs:F3}ms find={findMs:F3}ms");
+    }
+
+    private static void Check(bool condition, string message)
+    {
+        if (!condition)
+        {
+            throw new InvalidOperationException($"[ContainerHashPerfRunner] check failed: {message}");
+        }
+    }
+}
@@ -1,4 +1,5 @@
 using System.Runtime.CompilerServices;
+using Script.CoreUObject;
 
 namespace Script.Library
 {
@@ -6,6 +7,6 @@ namespace Script.Library
     {
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern bool UDataTableFunctionLibrary_GetDataTableRowFromNameImplementation<T>(nint Table,
-            nint RowName, out T OutRow);
+            in FName RowName, out T OutRow);
     }
 }
\ No newline at end of file
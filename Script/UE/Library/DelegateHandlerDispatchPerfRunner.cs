@@ -0,0 +1,23 @@
+using System;
+
+namespace Script.Library;
+
+/// <summary>
+/// Only available in non-shipping builds.
+/// </summary>
+public static class DelegateHandlerDispatchPerfRunner
+{
+    public static unsafe void Run(int iterations = 100_000)
+    {
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        double dispatchNs;
+
+        var ok = FDelegateHandlerDispatchPerfImplementation.FDelegateHandlerDispatchPerf_DispatchImplementation(
+            iterations, &dispatchNs);
+
+        if (!ok) throw new InvalidOperationException("DelegateHandlerDispatchPerfRunner check failed: callback match");
+
+        Console.WriteLine($"[DelegateHandlerDispatch] iterations={iterations} dispatchNs={dispatchNs:F2}");
+    }
+}
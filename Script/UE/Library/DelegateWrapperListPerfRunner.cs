@@ -0,0 +1,37 @@
+using System;
+
+namespace Script.Library;
+
+public static class DelegateWrapperListPerfRunner
+{
+    public static void RunAll()
+    {
+        Run(100);
+        Run(1_000);
+        Run(10_000);
+    }
+
+    /// <summary>
+    /// Checks ordering and removal during broadcast natively, then times subscribing and unsubscribing
+    /// subscriberCount listeners with the former array storage and with FDelegateWrapperList.
+    /// The quadratic array storage is only timed up to 1000 subscribers.
+    /// Only available in non-shipping builds.
+    /// </summary>
+    public static unsafe void Run(int subscriberCount = 10_000)
+    {
+        if (subscriberCount <= 0) throw new ArgumentOutOfRangeException(nameof(subscriberCount));
+
+        double arrayMs;
+        double listMs;
+
+        var ok = FDelegateWrapperListPerfImplementation.FDelegateWrapperListPerf_RunImplementation(subscriberCount,
+            &arrayMs, &listMs);
+
+        if (!ok) throw new InvalidOperationException("DelegateWrapperListPerfRunner check failed: ordering or re-entrancy");
+
+        Console.WriteLine(arrayMs < 0
+            ? $"[DelegateWrapperList] subscribers={subscriberCount} array=skipped list={listMs:F3}ms"
+            : $"[DelegateWrapperList] subscribers={subscriberCount} array={arrayMs:F3}ms list={listMs:F3}ms " +
+              $"speedup={arrayMs / Math.Max(0.000001, listMs):F2}x");
+    }
+}
@@ -17,7 +17,7 @@ namespace Script.Library
             nint InObject,
             nint InBlueprintEnhancedInputActionBinding,
             nint InObjectToBindTo,
-            nint InFunctionNameToBind);
+            in FName InFunctionNameToBind);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void UEnhancedInputComponent_RemoveBindingImplementation(
@@ -0,0 +1,10 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FAsyncLoadingObjectSetPerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FAsyncLoadingObjectSetPerf_CompareImplementation(int packageCount,
+        int objectsPerPackage, double* outArrayMilliseconds, double* outSetMilliseconds);
+}
@@ -0,0 +1,10 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FBufferOffsetPerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FBufferOffsetPerf_CompareImplementation(int argumentCount, int iterations,
+        double* outRuntimeNanoseconds, double* outConstexprNanoseconds);
+}
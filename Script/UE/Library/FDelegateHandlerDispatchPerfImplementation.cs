@@ -0,0 +1,10 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FDelegateHandlerDispatchPerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FDelegateHandlerDispatchPerf_DispatchImplementation(int iterations,
+        double* outDispatchNanoseconds);
+}
@@ -0,0 +1,10 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FDelegateWrapperListPerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FDelegateWrapperListPerf_RunImplementation(int subscriberCount,
+        double* outArrayMilliseconds, double* outListMilliseconds);
+}
@@ -0,0 +1,10 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FFunctionParamBufferAllocatorPerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FFunctionParamBufferAllocatorPerf_StressImplementation(int threadCount, int iterations,
+        double* outPoolMilliseconds, double* outPersistentMilliseconds);
+}
@@ -0,0 +1,12 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static class FGarbageCollectionHandlePerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern long FGarbageCollectionHandlePerf_ResolveByPropertyImplementation(object value, int iterations);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern long FGarbageCollectionHandlePerf_ResolveByFieldImplementation(object value, int iterations);
+}
@@ -0,0 +1,13 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FLazyBindPerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FLazyBindPerf_SpawnImplementation(nint worldContextObject, nint actorClass,
+        int actorCount, bool enableLazyBind, double* outMilliseconds, int* outBoundNum);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FLazyBindPerf_DestroyImplementation();
+}
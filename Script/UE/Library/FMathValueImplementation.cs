@@ -0,0 +1,57 @@
+using System.Runtime.CompilerServices;
+using Script.CoreUObject;
+
+namespace Script.Library;
+
+public static unsafe class FMathValueImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern int FMathValue_SizeOfVectorImplementation();
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern int FMathValue_SizeOfVector2DImplementation();
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern int FMathValue_SizeOfRotatorImplementation();
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern int FMathValue_SizeOfQuatImplementation();
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern int FMathValue_SizeOfTransformImplementation();
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern int FMathValue_SizeOfLinearColorImplementation();
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FMathValue_MakeTransformImplementation(FQuatValue* rotation, FVectorValue* translation,
+        FVectorValue* scale3D, FTransformValue* outValue);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FMathValue_VectorGetSafeNormalImplementation(FVectorValue* vector, FVectorValue* outValue);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FMathValue_RotatorQuaternionImplementation(FRotatorValue* rotator, FQuatValue* outValue);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FMathValue_RotatorNormalizeImplementation(FRotatorValue* rotator, FRotatorValue* outValue);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FMathValue_QuatMultipliesImplementation(FQuatValue* a, FQuatValue* b, FQuatValue* outValue);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FMathValue_QuatRotateVectorImplementation(FQuatValue* quat, FVectorValue* vector,
+        FVectorValue* outValue);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FMathValue_TransformPositionImplementation(FTransformValue* transform,
+        FVectorValue* vector, FVectorValue* outValue);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FMathValue_InverseTransformPositionImplementation(FTransformValue* transform,
+        FVectorValue* vector, FVectorValue* outValue);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FMathValue_LinearColorLerpImplementation(FLinearColorValue* a, FLinearColorValue* b,
+        float alpha, FLinearColorValue* outValue);
+}
@@ -0,0 +1,12 @@
+using System;
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FMulticastBroadcastPerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FMulticastBroadcastPerf_CompareImplementation<T>(T listener, int listenerCount,
+        int iterations, double* outPerListenerMilliseconds, double* outPerBroadcastMilliseconds)
+        where T : Delegate;
+}
@@ -0,0 +1,11 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FMulticastDelegateHandlerPerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FMulticastDelegateHandlerPerf_RunImplementation(int count,
+        double* outBaselineMilliseconds, double* outRootedMilliseconds, double* outUnboundMilliseconds,
+        double* outBoundMilliseconds);
+}
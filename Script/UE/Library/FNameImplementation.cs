@@ -6,18 +6,12 @@ namespace Script.Library
     public static class FNameImplementation
     {
         [MethodImpl(MethodImplOptions.InternalCall)]
-        public static extern void FName_RegisterImplementation(FName InName, string InValue);
+        public static extern void FName_FromStringImplementation(string InValue, out FName OutName);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
-        public static extern bool FName_IdenticalImplementation(nint InA, nint InB);
+        public static extern string FName_ToStringImplementation(in FName InName);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
-        public static extern void FName_UnRegisterImplementation(nint InName);
-
-        [MethodImpl(MethodImplOptions.InternalCall)]
-        public static extern string FName_ToStringImplementation(nint InName);
-
-        [MethodImpl(MethodImplOptions.InternalCall)]
-        public static extern FName FName_NAME_NoneImplementation();
+        public static extern int FName_SizeOfImplementation();
     }
 }
\ No newline at end of file
@@ -0,0 +1,154 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using Script.CoreUObject;
+using Script.Engine;
+
+namespace Script.Library;
+
+public static class FNameRunner
+{
+    public static void RunAll(int iterations = 1_000_000)
+    {
+        RunLayout();
+        RunEquality();
+        RunProperty();
+        RunContainers();
+        RunCompare(iterations);
+    }
+
+    /// <summary>
+    /// The managed struct must match the native FName, DisplayIndex only exists in editor builds and
+    /// follows Number there. Field offsets are checked natively when the assemblies load.
+    /// </summary>
+    public static void RunLayout()
+    {
+        Check(Unsafe.SizeOf<FName>() == FNameImplementation.FName_SizeOfImplementation(), "layout size");
+
+        Check(default(FName).IsNone() && FName.NAME_None.ToString() == "None", "default is None");
+
+        Check(new FName("None").IsNone(), "None from string");
+
+        Console.WriteLine($"[FNameLayout] size={Unsafe.SizeOf<FName>()} ok=True");
+    }
+
+    public static void RunEquality()
+    {
+        var lower = new FName("PlayerStart");
+        var upper = new FName("PLAYERSTART");
+        var numbered = new FName("PlayerStart_2");
+
+        Check(lower == upper && lower.Equals(upper) && lower.Equals((object)upper), "case variants equal");
+        Check(lower.GetHashCode() == upper.GetHashCode(), "case variants hash");
+        Check(lower != numbered && lower.ComparisonIndex == numbered.ComparisonIndex, "numbered name differs");
+        Check(numbered.ToString() == "PlayerStart_2", "numbered round trip");
+        Check(new FName(lower.ToString()) == lower, "string round trip");
+
+        var set = new HashSet<FName> { lower, upper, numbered };
+
+        Check(set.Count == 2, "hash set");
+
+        Console.WriteLine("[FNameEquality] ok=True");
+    }
+
+    public static void RunProperty()
+    {
+        var binding = new FBlueprintInputActionDelegateBinding
+        {
+            InputActionName = "Jump",
+            FunctionNameToBind = FName.NAME_None
+        };
+
+        Check(binding.InputActionName == new FName("jump"), "property round trip");
+        Check(binding.InputActionName.ToString() == "Jump", "property string");
+        Check(binding.FunctionNameToBind.IsNone(), "property None");
+
+        binding.FunctionNameToBind = binding.InputActionName;
+
+        Check(binding.FunctionNameToBind == binding.InputActionName, "property copy");
+
+        Console.WriteLine("[FNameProperty] ok=True");
+    }
+
+    public static void RunContainers(int count = 256)
+    {
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count));
+
+        var array = new TArray<FName>();
+        var map = new TMap<FName, int>();
+
+        for (var i = 0; i < count; i++)
+        {
+            var name = new FName($"Name_{i}");
+
+            array.Add(name);
+
+            map.Add(name, i);
+        }
+
+        Check(array.Num() == count && map.Num() == count, "container num");
+
+        for (var i = 0; i < count; i++)
+        {
+            var variant = new FName($"NAME_{i}");
+
+            Check(array[i] == variant, "array element");
+            Check(array.Find(variant) == i, "array find case variant");
+            Check(map.Contains(variant) && map.Find(variant) == i, "map key case variant");
+            Check(map.FindKey(i) == variant, "map find key");
+        }
+
+        var span = array.AsSpan<FName>();
+
+        Check(span.Length == count && span[count - 1] == new FName($"Name_{count - 1}"), "array span");
+
+        map.Add(new FName("name_0"), -1);
+
+        Check(map.Num() == count && map.Find("Name_0") == -1, "map overwrite case variant");
+
+        Check(map.Remove("NAME_1") == 1 && !map.Contains("Name_1"), "map remove case variant");
+
+        GC.KeepAlive(array);
+
+        Console.WriteLine($"[FNameContainers] count={count} ok=True");
+    }
+
+    /// <summary>
+    /// Equality and hashing stay in managed code, only ToString crosses into native code.
+    /// </summary>
+    public static void RunCompare(int iterations = 1_000_000)
+    {
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        var left = new FName("Montage_Attack");
+        var right = new FName("montage_attack");
+
+        var equal = 0;
+        var sw = Stopwatch.StartNew();
+        for (var i = 0; i < iterations; i++)
+        {
+            if (left == right && left.GetHashCode() == right.GetHashCode()) equal++;
+        }
+        var compareMs = sw.Elapsed.TotalMilliseconds;
+
+        var length = 0;
+        sw.Restart();
+        for (var i = 0; i < iterations; i++)
+        {
+            length += left.ToString().Length;
+        }
+        var toStringMs = sw.Elapsed.TotalMilliseconds;
+
+        Check(equal == iterations && length == iterations * "Montage_Attack".Length, "compare results");
+
+        Console.WriteLine(
+            $"[FNameCompare] iterations={iterations} compare={compareMs:F3}ms toString={toStringMs:F3}ms " +
+            $"compareNs={compareMs * 1_000_000.0 / iterations:F2} toStringNs={toStringMs * 1_000_000.0 / iterations:F2}");
+    }
+
+    private static void Check(bool condition, string what)
+    {
+        if (!condition) throw new InvalidOperationException($"FNameRunner check failed: {what}");
+    }
+}
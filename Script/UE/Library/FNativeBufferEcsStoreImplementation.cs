@@ -0,0 +1,30 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FNativeBufferEcsStoreImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern nint FNativeBufferEcsStore_CreateImplementation(int* componentSizes, int componentCount,
+        int chunkBytes);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FNativeBufferEcsStore_DestroyImplementation(nint store);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern int FNativeBufferEcsStore_AddImplementation(nint store, int count, ulong* outHandles);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FNativeBufferEcsStore_RemoveImplementation(nint store, ulong handle);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern nint FNativeBufferEcsStore_GetComponentImplementation(nint store, ulong handle,
+        int component);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern int FNativeBufferEcsStore_NumImplementation(nint store);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern long FNativeBufferEcsStore_UpdatePosVelParallelImplementation(nint store,
+        int positionComponent, int velocityComponent, int dt);
+}
@@ -0,0 +1,10 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FNativeBufferEcsStorePerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FNativeBufferEcsStorePerf_CompareImplementation(int entityCount, int iterations,
+        double* outSliceMilliseconds, double* outChunkMilliseconds, int* outChunkCapacity);
+}
@@ -0,0 +1,45 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FNativeBufferKernelImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern int FNativeBufferKernel_AddOneAndSumInt32Implementation(nint data, int length);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FNativeBufferKernel_AddInt32Implementation(nint data, int length, int value);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FNativeBufferKernel_AddFloatImplementation(nint data, int length, float value);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FNativeBufferKernel_MultiplyAddInt32Implementation(nint data, int length,
+        int scale, int bias);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FNativeBufferKernel_MultiplyAddFloatImplementation(nint data, int length,
+        float scale, float bias);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern long FNativeBufferKernel_SumInt32Implementation(nint data, int length);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern float FNativeBufferKernel_SumFloatImplementation(nint data, int length);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FNativeBufferKernel_MinMaxInt32Implementation(nint data, int length,
+        int* outMin, int* outMax);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FNativeBufferKernel_MinMaxFloatImplementation(nint data, int length,
+        float* outMin, float* outMax);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FNativeBufferKernel_ClampInt32Implementation(nint data, int length,
+        int min, int max);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern void FNativeBufferKernel_ClampFloatImplementation(nint data, int length,
+        float min, float max);
+}
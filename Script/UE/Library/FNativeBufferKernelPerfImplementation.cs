@@ -0,0 +1,10 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FNativeBufferKernelPerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FNativeBufferKernelPerf_CompareImplementation(int kernel, int length, int iterations,
+        double* outScalarGigabytesPerSecond, double* outVectorGigabytesPerSecond);
+}
@@ -0,0 +1,11 @@
+using System.Runtime.CompilerServices;
+
+namespace Script.Library;
+
+public static unsafe class FObjectRegistryPerfImplementation
+{
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FObjectRegistryPerf_CompareImplementation(int objectCount, int iterations,
+        double* outMapMilliseconds, double* outArrayMilliseconds, double* outParallelArrayMilliseconds,
+        long* outMapBytes, long* outArrayBytes);
+}
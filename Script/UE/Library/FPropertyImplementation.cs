@@ -19,5 +19,25 @@ namespace Script.Library
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void FProperty_SetStructPropertyImplementation(nint InMonoObject,
             uint InPropertyHash, byte* InBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern uint FProperty_CreatePropertyListImplementation(uint* InPropertyHashes, int InNum,
+            int* OutOffsets, int* OutBufferSize);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern bool FProperty_GetObjectPropertiesImplementation(nint InMonoObject,
+            uint InPropertyList, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern bool FProperty_SetObjectPropertiesImplementation(nint InMonoObject,
+            uint InPropertyList, byte* InBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern bool FProperty_GetStructPropertiesImplementation(nint InMonoObject,
+            uint InPropertyList, byte* ReturnBuffer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern bool FProperty_SetStructPropertiesImplementation(nint InMonoObject,
+            uint InPropertyList, byte* InBuffer);
     }
 }
\ No newline at end of file
@@ -6,4 +6,11 @@ public static unsafe class FTasksImplementation
 {
     [MethodImpl(MethodImplOptions.InternalCall)]
     public static extern void FTasks_ExecuteBatchImplementation(nint stateHandle, int taskCount, bool wait);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern ulong FTasks_LaunchBatchImplementation(nint stateHandle, int taskCount,
+        ulong* prerequisites, int prerequisiteCount);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public static extern bool FTasks_WaitImplementation(ulong handle);
 }
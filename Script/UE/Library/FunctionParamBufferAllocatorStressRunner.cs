@@ -0,0 +1,29 @@
+using System;
+
+namespace Script.Library;
+
+public static unsafe class FunctionParamBufferAllocatorStressRunner
+{
+    /// <summary>
+    /// Call from the game thread so the game thread pool and the shared buffers are exercised together.
+    /// This only catches buffers that were handed out twice or overwritten. It does not replace a run under
+    /// a race detector such as TSan, which has not been done yet.
+    /// Only available in non-shipping builds.
+    /// </summary>
+    public static void RunStress(int threadCount = 8, int iterations = 10_000)
+    {
+        if (threadCount <= 0) throw new ArgumentOutOfRangeException(nameof(threadCount));
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        double poolMs, persistentMs;
+
+        var ok = FFunctionParamBufferAllocatorPerfImplementation.FFunctionParamBufferAllocatorPerf_StressImplementation(
+            threadCount, iterations, &poolMs, &persistentMs);
+
+        Console.WriteLine(
+            $"[FunctionParamBufferAllocatorStress] threads={threadCount} iterations={iterations} " +
+            $"pool={poolMs:F3}ms persistent={persistentMs:F3}ms ok={ok}");
+
+        if (!ok) throw new InvalidOperationException("FunctionParamBufferAllocatorStressRunner check failed");
+    }
+}
@@ -1,4 +1,5 @@
 ﻿using System.Runtime.CompilerServices;
+using Script.CoreUObject;
 using Script.Engine;
 
 namespace Script.Library
@@ -16,42 +17,42 @@ namespace Script.Library
             nint InObject,
             nint InInputActionDelegateBinding,
             nint InObjectToBindTo,
-            nint InFunctionNameToBind);
+            in FName InFunctionNameToBind);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void UInputComponent_BindAxisImplementation(
             nint InObject,
             nint InInputAxisDelegateBinding,
             nint InObjectToBindTo,
-            nint InFunctionNameToBind);
+            in FName InFunctionNameToBind);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void UInputComponent_BindAxisKeyImplementation(
             nint InObject,
             nint InInputAxisKeyDelegateBinding,
             nint InObjectToBindTo,
-            nint InFunctionNameToBind);
+            in FName InFunctionNameToBind);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void UInputComponent_BindKeyImplementation(
             nint InObject,
             nint InInputKeyDelegateBinding,
             nint InObjectToBindTo,
-            nint InFunctionNameToBind);
+            in FName InFunctionNameToBind);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void UInputComponent_BindTouchImplementation(
             nint InObject,
             nint InInputTouchDelegateBinding,
             nint InObjectToBindTo,
-            nint InFunctionNameToBind);
+            in FName InFunctionNameToBind);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void UInputComponent_BindVectorAxisImplementation(
             nint InObject,
             nint InInputVectorAxisDelegateBinding,
             nint InObjectToBindTo,
-            nint InFunctionNameToBind);
+            in FName InFunctionNameToBind);
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void UInputComponent_ClearBindingValuesImplementation(nint InObject);
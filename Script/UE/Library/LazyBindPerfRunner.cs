@@ -0,0 +1,60 @@
+using System;
+using Script.CoreUObject;
+
+namespace Script.Library;
+
+/// <summary>
+/// Only available in non-shipping builds.
+/// </summary>
+public static unsafe class LazyBindPerfRunner
+{
+    public static void RunCompare(UObject worldContextObject, UClass actorClass, int actorCount = 50_000)
+    {
+        if (worldContextObject == null) throw new ArgumentNullException(nameof(worldContextObject));
+        if (actorClass == null) throw new ArgumentNullException(nameof(actorClass));
+        if (actorCount <= 0) throw new ArgumentOutOfRangeException(nameof(actorCount));
+
+        var eagerOk = Run(worldContextObject, actorClass, actorCount, false,
+            out var eagerMs, out var eagerBytes, out var eagerBound);
+
+        var lazyOk = Run(worldContextObject, actorClass, actorCount, true,
+            out var lazyMs, out var lazyBytes, out var lazyBound);
+
+        // lazy binding defers wrappers until first script access, it never binds more actors than eager binding
+        if (!eagerOk || !lazyOk) throw new InvalidOperationException("LazyBindPerfRunner check failed: spawn failed");
+        if (lazyBound > eagerBound) throw new InvalidOperationException("LazyBindPerfRunner check failed: bound");
+
+        Console.WriteLine(
+            $"[LazyBindCompare] actors={actorCount} " +
+            $"eager={eagerMs:F3}ms lazy={lazyMs:F3}ms " +
+            $"eagerUsPerActor={eagerMs * 1_000.0 / actorCount:F2} " +
+            $"lazyUsPerActor={lazyMs * 1_000.0 / actorCount:F2} " +
+            $"eagerManagedBytes={eagerBytes} lazyManagedBytes={lazyBytes} " +
+            $"eagerBound={eagerBound} lazyBound={lazyBound}");
+    }
+
+    private static bool Run(UObject worldContextObject, UClass actorClass, int actorCount, bool enableLazyBind,
+        out double milliseconds, out long managedBytes, out int boundNum)
+    {
+        double spawnMs;
+        int spawnBound;
+
+        GC.Collect();
+        GC.WaitForPendingFinalizers();
+
+        var before = GC.GetTotalMemory(true);
+
+        var ok = FLazyBindPerfImplementation.FLazyBindPerf_SpawnImplementation(
+            worldContextObject.GarbageCollectionHandle, actorClass.GarbageCollectionHandle,
+            actorCount, enableLazyBind, &spawnMs, &spawnBound);
+
+        managedBytes = GC.GetTotalMemory(true) - before;
+
+        FLazyBindPerfImplementation.FLazyBindPerf_DestroyImplementation();
+
+        milliseconds = spawnMs;
+        boundNum = spawnBound;
+
+        return ok;
+    }
+}
@@ -0,0 +1,215 @@
+using System;
+using System.Diagnostics;
+using Script.CoreUObject;
+
+namespace Script.Library;
+
+public static unsafe class MathValueRunner
+{
+    private const double Tolerance = 1e-6;
+
+    public static void RunAll(int samples = 10_000, int iterations = 1_000_000)
+    {
+        RunLayout();
+        RunParity(samples);
+        RunCompare(iterations);
+    }
+
+    public static void RunLayout()
+    {
+        Check(sizeof(FVectorValue) == FMathValueImplementation.FMathValue_SizeOfVectorImplementation(), "FVector size");
+        Check(sizeof(FVector2DValue) == FMathValueImplementation.FMathValue_SizeOfVector2DImplementation(),
+            "FVector2D size");
+        Check(sizeof(FRotatorValue) == FMathValueImplementation.FMathValue_SizeOfRotatorImplementation(),
+            "FRotator size");
+        Check(sizeof(FQuatValue) == FMathValueImplementation.FMathValue_SizeOfQuatImplementation(), "FQuat size");
+        Check(sizeof(FTransformValue) == FMathValueImplementation.FMathValue_SizeOfTransformImplementation(),
+            "FTransform size");
+        Check(sizeof(FLinearColorValue) == FMathValueImplementation.FMathValue_SizeOfLinearColorImplementation(),
+            "FLinearColor size");
+
+        var Rotation = new FRotatorValue(10.0, 20.0, 30.0).Quaternion();
+
+        var Translation = new FVectorValue(1.0, 2.0, 3.0);
+
+        var Scale3D = new FVectorValue(4.0, 5.0, 6.0);
+
+        var Native = new FTransformValue();
+
+        FMathValueImplementation.FMathValue_MakeTransformImplementation(&Rotation, &Translation, &Scale3D, &Native);
+
+        var Managed = new FTransformValue(Rotation, Translation, Scale3D);
+
+        Check(BitwiseEqual(&Native, &Managed), "FTransform bitwise layout");
+
+        var Vector = new FVectorValue(1.5, -2.5, 3.25);
+
+        Check(FVectorValue.From(Vector.ToVector()) == Vector, "FVector round trip");
+
+        var Vector2D = new FVector2DValue(-7.0, 8.5);
+
+        Check(FVector2DValue.From(Vector2D.ToVector2D()) == Vector2D, "FVector2D round trip");
+
+        var Rotator = new FRotatorValue(-45.0, 90.0, 179.0);
+
+        Check(FRotatorValue.From(Rotator.ToRotator()) == Rotator, "FRotator round trip");
+
+        Check(FQuatValue.From(Rotation.ToQuat()) == Rotation, "FQuat round trip");
+
+        Check(FTransformValue.From(Managed.ToTransform()) == Managed,
+            "FTransform round trip");
+
+        var LinearColor = new FLinearColorValue(0.25f, 0.5f, 0.75f, 1.0f);
+
+        Check(FLinearColorValue.From(LinearColor.ToLinearColor()) == LinearColor, "FLinearColor round trip");
+
+        Console.WriteLine("[MathValueLayout] ok");
+    }
+
+    public static void RunParity(int samples)
+    {
+        if (samples <= 0) throw new ArgumentOutOfRangeException(nameof(samples));
+
+        var Random = new Random(1234);
+
+        var MaxError = 0.0;
+
+        for (var Index = 0; Index < samples; Index++)
+        {
+            var Vector = NextVector(Random, 1000.0);
+
+            var Rotator = new FRotatorValue(NextDouble(Random, 720.0), NextDouble(Random, 720.0),
+                NextDouble(Random, 720.0));
+
+            var Other = new FRotatorValue(NextDouble(Random, 180.0), NextDouble(Random, 180.0),
+                NextDouble(Random, 180.0));
+
+            var NativeNormal = new FVectorValue();
+
+            FMathValueImplementation.FMathValue_VectorGetSafeNormalImplementation(&Vector, &NativeNormal);
+
+            MaxError = Math.Max(MaxError, Error(Vector.GetSafeNormal(), NativeNormal));
+
+            var NativeRotator = new FRotatorValue();
+
+            FMathValueImplementation.FMathValue_RotatorNormalizeImplementation(&Rotator, &NativeRotator);
+
+            MaxError = Math.Max(MaxError, Math.Abs(Rotator.GetNormalized().Pitch - NativeRotator.Pitch));
+
+            var Quat = Rotator.Quaternion();
+
+            var NativeQuat = new FQuatValue();
+
+            FMathValueImplementation.FMathValue_RotatorQuaternionImplementation(&Rotator, &NativeQuat);
+
+            MaxError = Math.Max(MaxError, Error(Quat, NativeQuat));
+
+            var OtherQuat = Other.Quaternion();
+
+            var NativeProduct = new FQuatValue();
+
+            FMathValueImplementation.FMathValue_QuatMultipliesImplementation(&Quat, &OtherQuat, &NativeProduct);
+
+            MaxError = Math.Max(MaxError, Error(Quat * OtherQuat, NativeProduct));
+
+            var NativeRotated = new FVectorValue();
+
+            FMathValueImplementation.FMathValue_QuatRotateVectorImplementation(&Quat, &Vector, &NativeRotated);
+
+            MaxError = Math.Max(MaxError, Error(Quat.RotateVector(Vector), NativeRotated) / 1000.0);
+
+            var Transform = new FTransformValue(Quat, NextVector(Random, 100.0),
+                new FVectorValue(0.5 + Random.NextDouble(), 0.5 + Random.NextDouble(), 0.5 + Random.NextDouble()));
+
+            var NativePosition = new FVectorValue();
+
+            FMathValueImplementation.FMathValue_TransformPositionImplementation(&Transform, &Vector, &NativePosition);
+
+            MaxError = Math.Max(MaxError, Error(Transform.TransformPosition(Vector), NativePosition) / 1000.0);
+
+            var NativeInverse = new FVectorValue();
+
+            FMathValueImplementation.FMathValue_InverseTransformPositionImplementation(&Transform, &Vector,
+                &NativeInverse);
+
+            MaxError = Math.Max(MaxError, Error(Transform.InverseTransformPosition(Vector), NativeInverse) / 1000.0);
+        }
+
+        var A = new FLinearColorValue(0.1f, 0.2f, 0.3f, 0.4f);
+
+        var B = new FLinearColorValue(0.9f, 0.8f, 0.7f, 0.6f);
+
+        var NativeColor = new FLinearColorValue();
+
+        FMathValueImplementation.FMathValue_LinearColorLerpImplementation(&A, &B, 0.25f, &NativeColor);
+
+        Check(FLinearColorValue.Lerp(A, B, 0.25f) == NativeColor, "FLinearColor lerp");
+
+        Check(MaxError <= Tolerance, $"parity error {MaxError:E3}");
+
+        Console.WriteLine($"[MathValueParity] samples={samples} maxRelativeError={MaxError:E3}");
+    }
+
+    public static void RunCompare(int iterations)
+    {
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        var WrapperA = new FVectorValue(1.0, 2.0, 3.0).ToVector();
+
+        var WrapperB = new FVectorValue(4.0, 5.0, 6.0).ToVector();
+
+        var ValueA = new FVectorValue(1.0, 2.0, 3.0);
+
+        var ValueB = new FVectorValue(4.0, 5.0, 6.0);
+
+        var Timer = Stopwatch.StartNew();
+
+        var WrapperSum = 0.0;
+
+        for (var Index = 0; Index < iterations; Index++)
+        {
+            WrapperSum += FVector.CrossProduct(WrapperA, WrapperB).Size();
+        }
+
+        var WrapperMs = Timer.Elapsed.TotalMilliseconds;
+
+        Timer.Restart();
+
+        var ValueSum = 0.0;
+
+        for (var Index = 0; Index < iterations; Index++)
+        {
+            ValueSum += FVectorValue.CrossProduct(ValueA, ValueB).Size();
+        }
+
+        var ValueMs = Timer.Elapsed.TotalMilliseconds;
+
+        Console.WriteLine(
+            $"[MathValueCompare] iterations={iterations} wrapper={WrapperMs:F3}ms value={ValueMs:F3}ms " +
+            $"sumOk={Math.Abs(WrapperSum - ValueSum) <= Tolerance * Math.Abs(ValueSum)} " +
+            $"speedup={WrapperMs / Math.Max(0.000001, ValueMs):F2}x");
+    }
+
+    private static bool BitwiseEqual<T>(T* A, T* B) where T : unmanaged =>
+        new ReadOnlySpan<byte>(A, sizeof(T)).SequenceEqual(new ReadOnlySpan<byte>(B, sizeof(T)));
+
+    private static double NextDouble(Random Random, double Range) => (Random.NextDouble() * 2.0 - 1.0) * Range;
+
+    private static FVectorValue NextVector(Random Random, double Range) =>
+        new(NextDouble(Random, Range), NextDouble(Random, Range), NextDouble(Random, Range));
+
+    private static double Error(FVectorValue A, FVectorValue B) =>
+        Math.Max(Math.Abs(A.X - B.X), Math.Max(Math.Abs(A.Y - B.Y), Math.Abs(A.Z - B.Z)));
+
+    private static double Error(FQuatValue A, FQuatValue B) =>
+        Math.Max(Math.Max(Math.Abs(A.X - B.X), Math.Abs(A.Y - B.Y)),
+            Math.Max(Math.Abs(A.Z - B.Z), Math.Abs(A.W - B.W)));
+
+    private static void Check(bool condition, string message)
+    {
+        if (!condition)
+        {
+            throw new InvalidOperationException($"[MathValueRunner] check failed: {message}");
+        }
+    }
+}
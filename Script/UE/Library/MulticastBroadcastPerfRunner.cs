@@ -0,0 +1,68 @@
+using System;
+using Script.CoreUObject;
+
+namespace Script.Library;
+
+public static class MulticastBroadcastPerfRunner
+{
+    private static double damage;
+
+    private static int calls;
+
+    public static void RunAll(int iterations = 10_000)
+    {
+        if (iterations < 10) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        Run(1, iterations);
+        Run(10, iterations);
+        Run(100, iterations / 10);
+    }
+
+    /// <summary>
+    /// Broadcasts AActor.OnTakeAnyDamage to listenerCount static listeners, once converting the arguments for
+    /// every listener and once through the multicast handler that converts them once per broadcast.
+    /// Only available in non-shipping builds.
+    /// </summary>
+    public static unsafe void Run(int listenerCount = 10, int iterations = 1_000)
+    {
+        if (listenerCount <= 0) throw new ArgumentOutOfRangeException(nameof(listenerCount));
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        damage = 0.0;
+        calls = 0;
+
+        double perListenerMs;
+        double perBroadcastMs;
+
+        var listener = new Action<UObject, float, UObject, UObject, UObject>(OnTakeAnyDamage);
+
+        Check(FMulticastBroadcastPerfImplementation.FMulticastBroadcastPerf_CompareImplementation(listener,
+            listenerCount, iterations, &perListenerMs, &perBroadcastMs), "compare");
+
+        var expected = 2L * listenerCount * iterations;
+
+        Check(calls == expected, "every listener called in both phases");
+        Check(damage == expected, "every listener received the damage");
+
+        var broadcasts = (double)iterations;
+
+        Console.WriteLine(
+            $"[MulticastBroadcast] listeners={listenerCount} iterations={iterations} " +
+            $"perListener={perListenerMs:F3}ms perBroadcast={perBroadcastMs:F3}ms " +
+            $"perListenerUsPerBroadcast={perListenerMs * 1000.0 / broadcasts:F2} " +
+            $"perBroadcastUsPerBroadcast={perBroadcastMs * 1000.0 / broadcasts:F2} " +
+            $"speedup={perListenerMs / Math.Max(0.000001, perBroadcastMs):F2}x");
+    }
+
+    private static void OnTakeAnyDamage(UObject damagedActor, float value, UObject damageType,
+        UObject instigatedBy, UObject damageCauser)
+    {
+        damage += value;
+        calls++;
+    }
+
+    private static void Check(bool condition, string what)
+    {
+        if (!condition) throw new InvalidOperationException($"MulticastBroadcastPerfRunner check failed: {what}");
+    }
+}
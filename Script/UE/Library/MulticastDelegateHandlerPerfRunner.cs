@@ -0,0 +1,33 @@
+using System;
+
+namespace Script.Library;
+
+/// <summary>
+/// Only available in non-shipping builds.
+/// </summary>
+public static class MulticastDelegateHandlerPerfRunner
+{
+    /// <summary>
+    /// Checks handler, root set and descriptor counts natively, then reports full collection times with count rooted
+    /// handlers, with count registry delegates without listeners and with count registry delegates with one listener
+    /// each. Runs several full collections, call it between levels.
+    /// </summary>
+    public static unsafe void Run(int count = 10_000)
+    {
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count));
+
+        double baselineMs;
+        double rootedMs;
+        double unboundMs;
+        double boundMs;
+
+        var ok = FMulticastDelegateHandlerPerfImplementation.FMulticastDelegateHandlerPerf_RunImplementation(count,
+            &baselineMs, &rootedMs, &unboundMs, &boundMs);
+
+        if (!ok) throw new InvalidOperationException("MulticastDelegateHandlerPerfRunner check failed: object counts");
+
+        Console.WriteLine(
+            $"[MulticastDelegateHandler] count={count} baselineGc={baselineMs:F3}ms rootedGc={rootedMs:F3}ms " +
+            $"unboundGc={unboundMs:F3}ms boundGc={boundMs:F3}ms");
+    }
+}
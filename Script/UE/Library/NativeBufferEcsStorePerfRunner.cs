@@ -0,0 +1,39 @@
+using System;
+
+namespace Script.Library;
+
+/// <summary>
+/// Only available in non-shipping builds.
+/// </summary>
+public static unsafe class NativeBufferEcsStorePerfRunner
+{
+    public static void RunCompare(int entityCount = 1_000_000, int iterations = 100)
+    {
+        if (entityCount <= 0) throw new ArgumentOutOfRangeException(nameof(entityCount));
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        double sliceMs, chunkMs;
+        int chunkCapacity;
+
+        var ok = FNativeBufferEcsStorePerfImplementation.FNativeBufferEcsStorePerf_CompareImplementation(
+            entityCount, iterations, &sliceMs, &chunkMs, &chunkCapacity);
+
+        // the chunk store must produce the slice results and keep handles valid across removals
+        if (!ok) throw new InvalidOperationException("NativeBufferEcsStorePerfRunner check failed: chunk results");
+
+        var entityUpdates = (double)entityCount * iterations;
+
+        // position read and written, velocity read
+        var bytes = entityUpdates * sizeof(int) * 3;
+
+        Console.WriteLine(
+            $"[NativeBufferEcsStoreCompare] entities={entityCount} iterations={iterations} " +
+            $"chunkCapacity={chunkCapacity} chunks={(entityCount + chunkCapacity - 1) / Math.Max(1, chunkCapacity)} " +
+            $"slice={sliceMs:F3}ms chunk={chunkMs:F3}ms " +
+            $"sliceNsPerEntity={sliceMs * 1_000_000.0 / entityUpdates:F3} " +
+            $"chunkNsPerEntity={chunkMs * 1_000_000.0 / entityUpdates:F3} " +
+            $"sliceGBps={bytes / Math.Max(0.000001, sliceMs) / 1_000_000.0:F2} " +
+            $"chunkGBps={bytes / Math.Max(0.000001, chunkMs) / 1_000_000.0:F2} " +
+            $"speedup={sliceMs / Math.Max(0.000001, chunkMs):F2}x");
+    }
+}
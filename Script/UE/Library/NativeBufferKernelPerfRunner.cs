@@ -0,0 +1,57 @@
+using System;
+
+namespace Script.Library;
+
+/// <summary>
+/// Only available in non-shipping builds.
+/// </summary>
+public static unsafe class NativeBufferKernelPerfRunner
+{
+    // same order as FNativeBufferKernelPerf::GetKernel
+    private static readonly string[] KernelNames =
+    {
+        "AddInt32",
+        "AddFloat",
+        "MultiplyAddInt32",
+        "MultiplyAddFloat",
+        "SumInt32",
+        "SumFloat",
+        "MinMaxInt32",
+        "MinMaxFloat",
+        "ClampInt32",
+        "ClampFloat",
+        "AddOneAndSumInt32"
+    };
+
+    public static void RunAll(int length = 1 << 16, int iterations = 20)
+    {
+        for (var kernel = 0; kernel < KernelNames.Length; ++kernel)
+        {
+            RunCompare(kernel, length, iterations);
+        }
+    }
+
+    public static void RunCompare(int kernel, int length = 1 << 16, int iterations = 20)
+    {
+        if (kernel < 0 || kernel >= KernelNames.Length) throw new ArgumentOutOfRangeException(nameof(kernel));
+        if (length <= 0) throw new ArgumentOutOfRangeException(nameof(length));
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        double scalarGBps, vectorGBps;
+
+        var bitExact = FNativeBufferKernelPerfImplementation.FNativeBufferKernelPerf_CompareImplementation(
+            kernel, length, iterations, &scalarGBps, &vectorGBps);
+
+        // the vector kernel must match the scalar reference bit for bit, including the unaligned tails
+        if (!bitExact)
+        {
+            throw new InvalidOperationException(
+                $"NativeBufferKernelPerfRunner check failed: {KernelNames[kernel]} is not bit exact");
+        }
+
+        Console.WriteLine(
+            $"[NativeBufferKernelCompare] kernel={KernelNames[kernel]} length={length} iterations={iterations} " +
+            $"scalar={scalarGBps:F2}GB/s vector={vectorGBps:F2}GB/s " +
+            $"speedup={vectorGBps / Math.Max(0.000001, scalarGBps):F2}x");
+    }
+}
@@ -0,0 +1,45 @@
+using System;
+
+namespace Script.Library;
+
+/// <summary>
+/// Only available in non-shipping builds.
+/// </summary>
+public static unsafe class ObjectRegistryPerfRunner
+{
+    private const int LargeObjectCount = 10_000;
+
+    /// <summary>
+    /// Spawns 100k and then 1M transient objects, pass allowLargeObjectCounts to confirm.
+    /// </summary>
+    public static void RunScaling(bool allowLargeObjectCounts, int iterations = 4_000_000)
+    {
+        RunCompare(100_000, iterations, allowLargeObjectCounts);
+        RunCompare(1_000_000, iterations, allowLargeObjectCounts);
+    }
+
+    public static void RunCompare(int objectCount = 10_000, int iterations = 100_000,
+        bool allowLargeObjectCounts = false)
+    {
+        if (objectCount <= 0) throw new ArgumentOutOfRangeException(nameof(objectCount));
+        if (objectCount > LargeObjectCount && !allowLargeObjectCounts)
+            throw new ArgumentOutOfRangeException(nameof(objectCount),
+                $"more than {LargeObjectCount} objects requires allowLargeObjectCounts");
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        double mapMs, arrayMs, parallelArrayMs;
+        long mapBytes, arrayBytes;
+
+        var sumOk = FObjectRegistryPerfImplementation.FObjectRegistryPerf_CompareImplementation(
+            objectCount, iterations, &mapMs, &arrayMs, &parallelArrayMs, &mapBytes, &arrayBytes);
+
+        // the slot array, also read from worker threads, must find the same handles as the map
+        if (!sumOk) throw new InvalidOperationException("ObjectRegistryPerfRunner check failed: lookups differ");
+
+        Console.WriteLine(
+            $"[ObjectRegistryCompare] objects={objectCount} iterations={iterations} " +
+            $"mapNsPerLookup={mapMs * 1_000_000.0 / iterations:F2} " +
+            $"arrayNsPerLookup={arrayMs * 1_000_000.0 / iterations:F2} " +
+            $"parallelArray={parallelArrayMs:F3}ms mapBytes={mapBytes} arrayBytes={arrayBytes}");
+    }
+}
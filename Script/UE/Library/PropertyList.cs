@@ -0,0 +1,70 @@
+using System;
+
+namespace Script.Library;
+
+/// <summary>
+/// A fixed list of property hashes that is read or written in one internal call.
+/// Each property owns the slot at Offsets[i] of a BufferSize byte buffer, laid out like the single property buffers.
+/// </summary>
+public sealed unsafe class PropertyList
+{
+    public uint Handle { get; }
+
+    public int BufferSize { get; }
+
+    public int[] Offsets { get; }
+
+    public PropertyList(params uint[] propertyHashes)
+    {
+        if (propertyHashes == null || propertyHashes.Length == 0)
+        {
+            throw new ArgumentException("At least one property hash is required.", nameof(propertyHashes));
+        }
+
+        Offsets = new int[propertyHashes.Length];
+
+        int bufferSize;
+
+        fixed (uint* hashes = propertyHashes)
+        fixed (int* offsets = Offsets)
+        {
+            Handle = FPropertyImplementation.FProperty_CreatePropertyListImplementation(hashes,
+                propertyHashes.Length, offsets, &bufferSize);
+        }
+
+        if (Handle == 0)
+        {
+            throw new InvalidOperationException("Property hashes could not be resolved.");
+        }
+
+        BufferSize = bufferSize;
+    }
+
+    public void GetObject(nint garbageCollectionHandle, byte* buffer) =>
+        Check(FPropertyImplementation.FProperty_GetObjectPropertiesImplementation(garbageCollectionHandle, Handle,
+            buffer));
+
+    public void SetObject(nint garbageCollectionHandle, byte* buffer) =>
+        Check(FPropertyImplementation.FProperty_SetObjectPropertiesImplementation(garbageCollectionHandle, Handle,
+            buffer));
+
+    public void GetStruct(nint garbageCollectionHandle, byte* buffer) =>
+        Check(FPropertyImplementation.FProperty_GetStructPropertiesImplementation(garbageCollectionHandle, Handle,
+            buffer));
+
+    public void SetStruct(nint garbageCollectionHandle, byte* buffer) =>
+        Check(FPropertyImplementation.FProperty_SetStructPropertiesImplementation(garbageCollectionHandle, Handle,
+            buffer));
+
+    /// <summary>
+    /// Fails when a property can not be found any more, or a reloaded property no longer fits the layout
+    /// this list was created with. A missing owner is ignored like in the single property calls.
+    /// </summary>
+    private static void Check(bool succeeded)
+    {
+        if (!succeeded)
+        {
+            throw new InvalidOperationException("Property list no longer matches its owner, create it again.");
+        }
+    }
+}
@@ -0,0 +1,141 @@
+using System;
+using System.Diagnostics;
+using System.Reflection;
+using Script.CoreUObject;
+
+namespace Script.Library;
+
+public static unsafe class PropertyListRunner
+{
+    // float, float, struct, object, object on AActor
+    private static readonly string[] ActorPropertyNames =
+    {
+        "InitialLifeSpan",
+        "CustomTimeDilation",
+        "PivotOffset",
+        "Instigator",
+        "RootComponent"
+    };
+
+    /// <summary>
+    /// source and target are two actors of the same class, target receives the properties of source.
+    /// </summary>
+    public static void RunActorCompare(UObject source, UObject target, int iterations = 100_000)
+    {
+        RunCompare(source, target, ActorPropertyNames, iterations);
+    }
+
+    public static void RunCompare(UObject source, UObject target, string[] propertyNames, int iterations = 100_000)
+    {
+        if (source == null) throw new ArgumentNullException(nameof(source));
+        if (target == null) throw new ArgumentNullException(nameof(target));
+        if (source.GetType() != target.GetType())
+            throw new ArgumentException("Source and target types differ.", nameof(target));
+        if (propertyNames == null || propertyNames.Length == 0) throw new ArgumentNullException(nameof(propertyNames));
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        var hashes = new uint[propertyNames.Length];
+        var properties = new PropertyInfo[propertyNames.Length];
+
+        for (var index = 0; index < propertyNames.Length; ++index)
+        {
+            hashes[index] = FindPropertyHash(source.GetType(), propertyNames[index], out properties[index]);
+        }
+
+        var list = new PropertyList(hashes);
+        var shared = new PropertyList(hashes).Handle == list.Handle;
+        var handle = source.GarbageCollectionHandle;
+
+        var single = stackalloc byte[list.BufferSize];
+        var bulk = stackalloc byte[list.BufferSize];
+        var write = stackalloc byte[list.BufferSize];
+
+        // reads: every slot must match what the single property path returns
+        GetSingle(handle, hashes, list.Offsets, single);
+        list.GetObject(handle, bulk);
+
+        var readOk = new Span<byte>(single, list.BufferSize).SequenceEqual(new Span<byte>(bulk, list.BufferSize));
+
+        // writes: objects and structs go in by handle, primitives by value
+        for (var index = 0; index < hashes.Length; ++index)
+        {
+            var slot = list.Offsets[index];
+
+            if (properties[index].PropertyType.IsPrimitive || properties[index].PropertyType.IsEnum)
+            {
+                *(long*)(write + slot) = *(long*)(bulk + slot);
+            }
+            else
+            {
+                var value = *(object*)(bulk + slot);
+
+                *(nint*)(write + slot) =
+                    value is IGarbageCollectionHandle owner ? owner.GarbageCollectionHandle : nint.Zero;
+            }
+        }
+
+        list.SetObject(target.GarbageCollectionHandle, write);
+
+        var writeOk = true;
+
+        foreach (var property in properties)
+        {
+            writeOk &= Equals(property.GetValue(source), property.GetValue(target));
+        }
+
+        var stopwatch = Stopwatch.StartNew();
+
+        for (var iteration = 0; iteration < iterations; ++iteration)
+        {
+            GetSingle(handle, hashes, list.Offsets, single);
+        }
+
+        var singleMs = stopwatch.Elapsed.TotalMilliseconds;
+
+        stopwatch.Restart();
+
+        for (var iteration = 0; iteration < iterations; ++iteration)
+        {
+            list.GetObject(handle, bulk);
+        }
+
+        var bulkMs = stopwatch.Elapsed.TotalMilliseconds;
+
+        Console.WriteLine(
+            $"[PropertyListCompare] properties={hashes.Length} iterations={iterations} " +
+            $"single={singleMs:F3}ms bulk={bulkMs:F3}ms " +
+            $"singleNsPerSync={singleMs * 1_000_000.0 / iterations:F1} " +
+            $"bulkNsPerSync={bulkMs * 1_000_000.0 / iterations:F1} " +
+            $"speedup={singleMs / Math.Max(0.000001, bulkMs):F2}x readOk={readOk} writeOk={writeOk} shared={shared}");
+    }
+
+    private static void GetSingle(nint handle, uint[] hashes, int[] offsets, byte* buffer)
+    {
+        for (var index = 0; index < hashes.Length; ++index)
+        {
+            FPropertyImplementation.FProperty_GetObjectPropertyImplementation(handle, hashes[index],
+                buffer + offsets[index]);
+        }
+    }
+
+    private static uint FindPropertyHash(Type type, string propertyName, out PropertyInfo property)
+    {
+        for (var current = type; current != null; current = current.BaseType)
+        {
+            var field = current.GetField("__" + propertyName,
+                BindingFlags.NonPublic | BindingFlags.Static | BindingFlags.DeclaredOnly);
+
+            if (field == null)
+            {
+                continue;
+            }
+
+            property = current.GetProperty(propertyName,
+                BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.DeclaredOnly)!;
+
+            return (uint)field.GetValue(null)!;
+        }
+
+        throw new ArgumentException($"{type.Name} has no bound property {propertyName}.", nameof(propertyName));
+    }
+}
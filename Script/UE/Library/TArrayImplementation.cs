@@ -1,4 +1,5 @@
-﻿using System.Runtime.CompilerServices;
+﻿using System;
+using System.Runtime.CompilerServices;
 using Script.CoreUObject;
 
 namespace Script.Library
@@ -32,6 +33,10 @@ namespace Script.Library
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern int TArray_MaxImplementation(nint InArray);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public static extern bool TArray_GetDataImplementation(nint InArray, Type InElementType, int InTypeSize,
+            void** OutData, int* OutNum);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern void TArray_GetImplementation(nint InArray, int InIndex, byte* ReturnBuffer);
 
@@ -0,0 +1,126 @@
+using System;
+using System.Diagnostics;
+using Script.CoreUObject;
+
+namespace Script.Library;
+
+public static class TArraySpanPerfRunner
+{
+    public static void Run(int count = 100_000, int iterations = 20)
+    {
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count));
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+        var array = new TArray<int>();
+
+        array.AddZeroed(count);
+
+        var span = array.AsSpan<int>();
+
+        Check(span.Length == count, "span length");
+
+        for (var i = 0; i < count; i++)
+        {
+            span[i] = i % 1000 - 500;
+        }
+
+        long indexerSum = 0;
+        var sw = Stopwatch.StartNew();
+        for (var iteration = 0; iteration < iterations; iteration++)
+        {
+            var num = array.Num();
+            for (var i = 0; i < num; i++)
+            {
+                indexerSum += array[i];
+            }
+        }
+        var indexerMs = sw.Elapsed.TotalMilliseconds;
+
+        long enumeratorSum = 0;
+        sw.Restart();
+        for (var iteration = 0; iteration < iterations; iteration++)
+        {
+            foreach (var value in array)
+            {
+                enumeratorSum += value;
+            }
+        }
+        var enumeratorMs = sw.Elapsed.TotalMilliseconds;
+
+        long spanSum = 0;
+        sw.Restart();
+        for (var iteration = 0; iteration < iterations; iteration++)
+        {
+            foreach (var value in (ReadOnlySpan<int>)array.AsSpan<int>())
+            {
+                spanSum += value;
+            }
+        }
+        var spanMs = sw.Elapsed.TotalMilliseconds;
+
+        Check(indexerSum == enumeratorSum && indexerSum == spanSum, "sums match");
+
+        // writes through the span are visible to the indexer
+        array.AsSpan<int>()[count - 1] = 12345;
+
+        Check(array[count - 1] == 12345, "span write");
+
+        CheckThrows(() => _ = array.AsSpan<long>().Length, "wrong element size");
+
+        CheckThrows(() => _ = array.AsSpan<float>().Length, "wrong element type");
+
+        var vectors = new TArray<FVector>();
+
+        vectors.Add(new FVector(1.0, 2.0, 3.0));
+
+        Check(vectors.AsSpan<FVectorValue>()[0] == new FVectorValue(1.0, 2.0, 3.0), "value struct elements");
+
+        CheckThrows(() => _ = vectors.AsSpan<FRotatorValue>().Length, "wrong value struct");
+
+        var objects = new TArray<UObject>();
+
+        CheckThrows(() => _ = objects.AsSpan<nint>().Length, "object elements");
+
+#if DEBUG
+        CheckThrows(() =>
+        {
+            var stale = array.AsSpan<int>();
+
+            array.Add(0);
+
+            _ = stale[0];
+        }, "stale span detected");
+#endif
+
+        GC.KeepAlive(array);
+
+        var elements = (double)count * iterations;
+
+        Console.WriteLine(
+            $"[TArraySpan] count={count} iterations={iterations} indexer={indexerMs:F3}ms " +
+            $"enumerator={enumeratorMs:F3}ms span={spanMs:F3}ms " +
+            $"indexerNsPerElement={indexerMs * 1_000_000.0 / elements:F2} " +
+            $"enumeratorNsPerElement={enumeratorMs * 1_000_000.0 / elements:F2} " +
+            $"spanNsPerElement={spanMs * 1_000_000.0 / elements:F2}");
+    }
+
+    private static void CheckThrows(Action action, string what)
+    {
+        var threw = false;
+        try
+        {
+            action();
+        }
+        catch (InvalidOperationException)
+        {
+            threw = true;
+        }
+
+        Check(threw, what);
+    }
+
+    private static void Check(bool condition, string what)
+    {
+        if (!condition) throw new InvalidOperationException($"TArraySpanPerfRunner check failed: {what}");
+    }
+}
@@ -0,0 +1,95 @@
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace Script.Library;
+
+/// <summary>
+/// A batch launched through UETasksBatch.Launch. It runs once its prerequisites have finished, cancelled ones included.
+/// Awaiting it resumes on the captured SynchronizationContext, the game thread when awaited from game thread code.
+/// </summary>
+public sealed class UETaskHandle
+{
+    private const int Active = 0;
+    private const int CancelRequested = 1;
+    private const int Completed = 2;
+    private const int Cancelled = 3;
+
+    private int status;
+
+    private Action<int>? executeIndex;
+
+    private readonly TaskCompletionSource completion = new(TaskCreationOptions.RunContinuationsAsynchronously);
+
+    internal UETaskHandle(Action<int> executeIndex)
+    {
+        this.executeIndex = executeIndex;
+    }
+
+    internal GCHandle StateHandle;
+
+    internal ulong NativeHandle;
+
+    public bool IsCompleted => Volatile.Read(ref status) >= Completed;
+
+    public bool IsCancelled => Volatile.Read(ref status) == Cancelled;
+
+    public Task Task => completion.Task;
+
+    /// <summary>
+    /// Indexes that have not started yet are skipped. Returns true when the batch ends up cancelled,
+    /// false when it had already completed.
+    /// </summary>
+    public bool Cancel() => Interlocked.CompareExchange(ref status, CancelRequested, Active) == Active;
+
+    /// <summary>
+    /// Blocks until the batch has finished, prefer awaiting on the game thread.
+    /// </summary>
+    public void Wait()
+    {
+        if (!IsCompleted && !FTasksImplementation.FTasks_WaitImplementation(NativeHandle))
+        {
+            CompleteCancelled();
+        }
+    }
+
+    public TaskAwaiter GetAwaiter() => completion.Task.GetAwaiter();
+
+    internal void ExecuteIndex(int index)
+    {
+        if (Volatile.Read(ref status) == Active)
+        {
+            executeIndex!(index);
+        }
+    }
+
+    internal void CompleteCancelled()
+    {
+        Cancel();
+
+        Complete();
+    }
+
+    internal void Complete()
+    {
+        executeIndex = null;
+
+        if (StateHandle.IsAllocated)
+        {
+            StateHandle.Free();
+        }
+
+        if (Interlocked.CompareExchange(ref status, Completed, Active) == Active)
+        {
+            completion.SetResult();
+        }
+        else
+        {
+            Volatile.Write(ref status, Cancelled);
+
+            completion.SetCanceled();
+        }
+    }
+}
@@ -35,15 +35,87 @@ public static class UETasksBatch
         }
     }
 
+    /// <summary>
+    /// Launches the batch without waiting, it starts once every prerequisite has finished.
+    /// </summary>
+    public static unsafe UETaskHandle Launch(Action<int> executeIndex, int taskCount,
+        params UETaskHandle[] prerequisites)
+    {
+        if (executeIndex == null) throw new ArgumentNullException(nameof(executeIndex));
+        if (taskCount < 0) throw new ArgumentOutOfRangeException(nameof(taskCount));
+        if (prerequisites == null) throw new ArgumentNullException(nameof(prerequisites));
+
+        var prerequisiteHandles = stackalloc ulong[prerequisites.Length];
+
+        for (var index = 0; index < prerequisites.Length; index++)
+        {
+            prerequisiteHandles[index] = prerequisites[index]?.NativeHandle ??
+                                         throw new ArgumentNullException(nameof(prerequisites));
+        }
+
+        var task = new UETaskHandle(executeIndex);
+
+        task.StateHandle = GCHandle.Alloc(task);
+
+        var nativeHandle = FTasksImplementation.FTasks_LaunchBatchImplementation(
+            (nint)GCHandle.ToIntPtr(task.StateHandle),
+            taskCount,
+            prerequisiteHandles,
+            prerequisites.Length);
+
+        if (nativeHandle == 0)
+        {
+            task.StateHandle.Free();
+
+            throw new InvalidOperationException("UETasksBatch could not launch, managed jobs are not available.");
+        }
+
+        task.NativeHandle = nativeHandle;
+
+        return task;
+    }
+
     public static void ExecuteTask(nint stateHandle, int index)
     {
         var handle = GCHandle.FromIntPtr((IntPtr)stateHandle);
 
-        if (handle.Target is not BatchState state)
+        switch (handle.Target)
+        {
+            case BatchState state:
+                state.ExecuteIndex(index);
+                break;
+            case UETaskHandle task:
+                task.ExecuteIndex(index);
+                break;
+            default:
+                throw new InvalidOperationException("UETasksBatch state handle is invalid.");
+        }
+    }
+
+    public static void CompleteTask(nint stateHandle)
+    {
+        var handle = GCHandle.FromIntPtr((IntPtr)stateHandle);
+
+        if (handle.Target is not UETaskHandle task)
+        {
+            throw new InvalidOperationException("UETasksBatch state handle is invalid.");
+        }
+
+        task.Complete();
+    }
+
+    /// <summary>
+    /// Called instead of CompleteTask when the batch could not run, for example while the domain shuts down.
+    /// </summary>
+    public static void CancelTask(nint stateHandle)
+    {
+        var handle = GCHandle.FromIntPtr((IntPtr)stateHandle);
+
+        if (handle.Target is not UETaskHandle task)
         {
             throw new InvalidOperationException("UETasksBatch state handle is invalid.");
         }
 
-        state.ExecuteIndex(index);
+        task.CompleteCancelled();
     }
 }
@@ -0,0 +1,194 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace Script.Library;
+
+public static class UETasksHandleRunner
+{
+    public static void RunAll(int iterations = 200)
+    {
+        RunDependencyOrdering(iterations);
+        RunCancelBeforeStart(iterations);
+        RunCancellationRace(iterations);
+    }
+
+    /// <summary>
+    /// A -> B -> C over the same data, every stage must see the whole previous stage.
+    /// </summary>
+    public static void RunDependencyOrdering(int iterations = 200, int count = 4096)
+    {
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count));
+
+        var stageA = new int[count];
+        var stageB = new int[count];
+        var failures = 0;
+        var launchMs = 0.0;
+
+        for (var iteration = 0; iteration < iterations; iteration++)
+        {
+            Array.Clear(stageA);
+            Array.Clear(stageB);
+
+            var sw = Stopwatch.StartNew();
+
+            var a = UETasksBatch.Launch(index => stageA[index] = index + iteration, count);
+
+            var b = UETasksBatch.Launch(index =>
+            {
+                if (!a.IsCompleted || stageA[index] != index + iteration) Interlocked.Increment(ref failures);
+
+                stageB[index] = stageA[(index + 1) % count] * 2;
+            }, count, a);
+
+            long sum = 0;
+
+            var c = UETasksBatch.Launch(index =>
+            {
+                if (!b.IsCompleted) Interlocked.Increment(ref failures);
+
+                Interlocked.Add(ref sum, stageB[index]);
+            }, count, a, b);
+
+            launchMs += sw.Elapsed.TotalMilliseconds;
+
+            c.Wait();
+
+            long expected = 0;
+            for (var index = 0; index < count; index++)
+            {
+                expected += ((index + 1) % count + iteration) * 2L;
+            }
+
+            Check(a.IsCompleted && b.IsCompleted && c.IsCompleted, "dependency stages completed");
+            Check(Interlocked.Read(ref sum) == expected, "dependency sum");
+        }
+
+        Check(failures == 0, "dependency ordering");
+
+        Console.WriteLine(
+            $"[UETasksHandleOrdering] iterations={iterations} count={count} " +
+            $"launchUsPerChain={launchMs * 1000.0 / iterations:F2} failures={failures}");
+    }
+
+    /// <summary>
+    /// A batch cancelled while its prerequisite still runs never executes, its dependents still do.
+    /// </summary>
+    public static void RunCancelBeforeStart(int iterations = 200, int count = 256)
+    {
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count));
+
+        for (var iteration = 0; iteration < iterations; iteration++)
+        {
+            var release = 0;
+            var executed = 0;
+            var dependentExecuted = 0;
+
+            var gate = UETasksBatch.Launch(_ =>
+            {
+                var sw = Stopwatch.StartNew();
+                while (Volatile.Read(ref release) == 0 && sw.ElapsedMilliseconds < 10_000)
+                {
+                    Thread.Yield();
+                }
+            }, 1);
+
+            var cancelled = UETasksBatch.Launch(_ => Interlocked.Increment(ref executed), count, gate);
+
+            var dependent = UETasksBatch.Launch(_ => Interlocked.Increment(ref dependentExecuted), count, cancelled);
+
+            Check(cancelled.Cancel(), "cancel before start accepted");
+            Check(!cancelled.Cancel(), "second cancel rejected");
+
+            Volatile.Write(ref release, 1);
+
+            dependent.Wait();
+            cancelled.Wait();
+
+            Check(cancelled.IsCancelled && cancelled.Task.IsCanceled, "cancelled state");
+            Check(executed == 0, "cancelled batch did not run");
+            Check(dependentExecuted == count && !dependent.IsCancelled, "dependent of cancelled batch ran");
+            Check(!gate.Cancel() && !gate.IsCancelled, "cancel after completion rejected");
+        }
+
+        Console.WriteLine($"[UETasksHandleCancelBeforeStart] iterations={iterations} count={count} ok=True");
+    }
+
+    /// <summary>
+    /// Cancel races the running batch, the outcome must agree with what Cancel returned.
+    /// </summary>
+    public static void RunCancellationRace(int iterations = 200, int count = 100_000)
+    {
+        if (iterations <= 0) throw new ArgumentOutOfRangeException(nameof(iterations));
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count));
+
+        var random = new Random(1234);
+        var cancelledRuns = 0;
+        var partialRuns = 0;
+
+        for (var iteration = 0; iteration < iterations; iteration++)
+        {
+            var executed = 0;
+
+            var task = UETasksBatch.Launch(_ =>
+            {
+                Thread.SpinWait(20);
+
+                Interlocked.Increment(ref executed);
+            }, count);
+
+            Thread.SpinWait(random.Next(0, 200_000));
+
+            var accepted = task.Cancel();
+
+            task.Wait();
+
+            Check(task.IsCompleted, "race completed");
+            Check(accepted == task.IsCancelled, "cancel result matches state");
+            Check(accepted == task.Task.IsCanceled, "cancel result matches task");
+            Check(accepted ? executed <= count : executed == count, "executed count");
+
+            if (accepted) cancelledRuns++;
+            if (accepted && executed > 0 && executed < count) partialRuns++;
+        }
+
+        Console.WriteLine(
+            $"[UETasksHandleCancellationRace] iterations={iterations} count={count} " +
+            $"cancelled={cancelledRuns} partial={partialRuns} ok=True");
+    }
+
+    /// <summary>
+    /// Call from game thread code, the continuation comes back through the SynchronizationContext on a later tick
+    /// while the game thread keeps ticking in between.
+    /// </summary>
+    public static async Task RunAwaitAsync(int count = 100_000)
+    {
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count));
+
+        var data = new int[count];
+        var threadId = Environment.CurrentManagedThreadId;
+
+        var fill = UETasksBatch.Launch(index => data[index] = 1, count);
+
+        long sum = 0;
+        var reduce = UETasksBatch.Launch(index => Interlocked.Add(ref sum, data[index]), count, fill);
+
+        var sw = Stopwatch.StartNew();
+
+        await reduce;
+
+        Check(sum == count, "awaited sum");
+
+        Console.WriteLine(
+            $"[UETasksHandleAwait] count={count} awaited={sw.Elapsed.TotalMilliseconds:F3}ms " +
+            $"sameThread={Environment.CurrentManagedThreadId == threadId}");
+    }
+
+    private static void Check(bool condition, string what)
+    {
+        if (!condition) throw new InvalidOperationException($"UETasksHandleRunner check failed: {what}");
+    }
+}
@@ -7,6 +7,12 @@ namespace Script.Library;
 
 public static class UETasksSlicePerfRunner
 {
+    // 1M 元素 + 极简 body：调度开销占主导，用来对比常驻 worker 池与 PF/TR。
+    public static void RunMillionElementTrivialBodyCompare(int taskCount = 16, int iterations = 64)
+    {
+        RunManagedPinnedAddOneAndSumCompare(length: 1_000_000, taskCount: taskCount, iterations: iterations);
+    }
+
     public static void RunNativeBufferAddOneAndSumCompareByHandler(
         int length = 500_000,
         int taskCount = 16,
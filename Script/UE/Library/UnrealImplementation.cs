@@ -9,7 +9,7 @@ namespace Script.Library
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern T Unreal_NewObjectImplementation<T>(nint Outer,
             nint Class,
-            nint Name,
+            in FName Name,
             EObjectFlags Flags,
             nint Template,
             bool bCopyTransientsFromClassDefaults
@@ -18,7 +18,7 @@ namespace Script.Library
         [MethodImpl(MethodImplOptions.InternalCall)]
         public static extern T Unreal_DuplicateObjectImplementation<T>(nint SourceObject,
             nint Outer,
-            nint Name
+            in FName Name
         );
 
         [MethodImpl(MethodImplOptions.InternalCall)]
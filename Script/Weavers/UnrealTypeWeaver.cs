@@ -50,6 +50,17 @@ namespace Weavers
 
         private TypeDefinition _overrideAttributeType;
 
+        // 与 FBindingManifest.cpp 中的 BindingManifestVersion 保持一致
+        private const int BindingManifestVersion = 1;
+
+        private static readonly string[] _dynamicAttributeNames =
+        {
+            "Script.Dynamic.UClassAttribute",
+            "Script.Dynamic.UStructAttribute",
+            "Script.Dynamic.UEnumAttribute",
+            "Script.Dynamic.UInterfaceAttribute"
+        };
+
         public override void Execute()
         {
             GetAllMeta();
@@ -77,6 +88,8 @@ namespace Weavers
             _structTypes.ForEach(ProcessUStructType);
 
             _classTypes.ForEach(ProcessRpcMethods);
+
+            AddBindingManifest();
         }
 
         public override IEnumerable<string> GetAssembliesForScanning()
@@ -737,6 +750,11 @@ namespace Weavers
                         return GetTypeStind(Type.Resolve().GetEnumUnderlyingType());
                     }
 
+                    if (Type.Resolve().IsValueType)
+                    {
+                        return Instruction.Create(OpCodes.Stobj, Type);
+                    }
+
                     break;
                 }
             }
@@ -777,6 +795,11 @@ namespace Weavers
                         return GetTypeLdind(Type.Resolve().GetEnumUnderlyingType());
                     }
 
+                    if (Type.Resolve().IsValueType)
+                    {
+                        return Instruction.Create(OpCodes.Ldobj, Type);
+                    }
+
                     break;
                 }
             }
@@ -816,6 +839,13 @@ namespace Weavers
                         return GetTypeSize(Type.Resolve().GetEnumUnderlyingType());
                     }
 
+                    // blittable structs such as FName, laid out without padding
+                    if (Type.Resolve().IsValueType)
+                    {
+                        return (sbyte)Type.Resolve().Fields.Where(Field => !Field.IsStatic)
+                            .Sum(Field => GetTypeSize(Field.FieldType));
+                    }
+
                     break;
                 }
             }
@@ -1060,6 +1090,85 @@ namespace Weavers
             }
         }
 
+        private void AddBindingManifest()
+        {
+            var types = ModuleDefinition.GetTypes().ToList();
+
+            // 嵌套类型无法在运行时按命名空间和名字查找, 这种情况保留反射查找
+            if (types.Any(Type => Type.IsNested && (IsOverrideType(Type) ||
+                                                    Type.Methods.Any(IsOverrideMethod) ||
+                                                    _dynamicAttributeNames.Any(Name => HasAttribute(Type, Name)))))
+            {
+                return;
+            }
+
+            var manifestType = new TypeDefinition("Script.CoreUObject", "BindingManifest",
+                TypeAttributes.NotPublic | TypeAttributes.Abstract | TypeAttributes.Sealed |
+                TypeAttributes.BeforeFieldInit, ModuleDefinition.TypeSystem.Object);
+
+            AddBindingManifestField(manifestType, "Version", ModuleDefinition.TypeSystem.Int32,
+                BindingManifestVersion);
+
+            foreach (var name in _dynamicAttributeNames)
+            {
+                AddBindingManifestField(manifestType, name.Substring(name.LastIndexOf('.') + 1),
+                    ModuleDefinition.TypeSystem.String,
+                    string.Join("\n", types.Where(Type => HasAttribute(Type, name)).Select(Type => Type.FullName)));
+            }
+
+            AddBindingManifestField(manifestType, "OverrideAttribute", ModuleDefinition.TypeSystem.String,
+                string.Join("\n", types.Where(IsOverrideType).Select(Type => Type.FullName)));
+
+            AddBindingManifestField(manifestType, "OverrideMethods", ModuleDefinition.TypeSystem.String,
+                string.Join("\n", types.SelectMany(Type => Type.Methods.Where(IsOverrideMethod)
+                    .Select(Method => Type.FullName + ":" + Method.Name))));
+
+            ModuleDefinition.Types.Add(manifestType);
+        }
+
+        private static void AddBindingManifestField(TypeDefinition Type, string Name, TypeReference FieldType,
+            object Value)
+        {
+            Type.Fields.Add(new FieldDefinition(Name,
+                FieldAttributes.Public | FieldAttributes.Static | FieldAttributes.Literal |
+                FieldAttributes.HasDefault, FieldType)
+            {
+                Constant = Value
+            });
+        }
+
+        private static bool HasAttribute(ICustomAttributeProvider Provider, string Name)
+        {
+            return Provider.CustomAttributes.Any(Attribute => Attribute.AttributeType.FullName == Name);
+        }
+
+        private static bool IsOverrideMethod(MethodDefinition Method)
+        {
+            return HasAttribute(Method, "Script.CoreUObject.OverrideAttribute");
+        }
+
+        private static bool IsOverrideType(TypeDefinition Type)
+        {
+            while (Type != null)
+            {
+                if (HasAttribute(Type, "Script.CoreUObject.OverrideAttribute"))
+                {
+                    return true;
+                }
+
+                try
+                {
+                    Type = Type.BaseType?.Resolve();
+                }
+                catch (AssemblyResolutionException)
+                {
+                    return false;
+                }
+            }
+
+            return false;
+        }
+
         private void GetAllMeta()
         {
             var definition = ModuleDefinition;
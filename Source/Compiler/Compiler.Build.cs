@@ -40,6 +40,7 @@ public class Compiler : ModuleRules
 				"Slate",
 				"SlateCore",
 				"Json",
+				"Sockets",
 				"UnrealCSharpCore",
 				"CrossVersion",
 				"EditorStyle"
@@ -68,3 +68,11 @@ bool FCSharpCompiler::IsCompiling() const
 {
 	return Runnable != nullptr ? Runnable->IsCompiling() : false;
 }
+
+void FCSharpCompiler::MeasureLatency(const int32 InCycles) const
+{
+	if (Runnable != nullptr)
+	{
+		Runnable->MeasureLatency(InCycles);
+	}
+}
@@ -1,11 +1,17 @@
 ﻿#include "FCSharpCompilerRunnable.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
+#include "CoreMacro/Macro.h"
 #include "Delegate/FUnrealCSharpCoreModuleDelegates.h"
 #include "Dynamic/FDynamicGenerator.h"
 #include "Log/UnrealCSharpLog.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Setting/UnrealCSharpEditorSetting.h"
 #include "Widgets/Notifications/SNotificationList.h"
+#include "IPAddress.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
 #include "UEVersion.h"
 #if UE_F_APP_STYLE_GET_BRUSH
 #include "Styling/AppStyle.h"
@@ -15,9 +21,14 @@
 
 FCSharpCompilerRunnable::FCSharpCompilerRunnable():
 	Event(nullptr),
-	bIsCompiling(false),
+	PublishEvent(FPlatformProcess::GetSynchEventFromPool(false)),
+	CompilingCount(0),
+	bIsPublishing(false),
+	PendingLatencyCycles(INDEX_NONE),
 	bIsGenerating(false),
-	bIsStopped(false)
+	bIsStopped(false),
+	bIsCompileServerBuilt(false),
+	CompileServerSocket(nullptr)
 {
 	OnBeginGeneratorDelegateHandle = FUnrealCSharpCoreModuleDelegates::OnBeginGenerator.AddRaw(
 		this, &FCSharpCompilerRunnable::OnBeginGenerator);
@@ -37,53 +48,56 @@ FCSharpCompilerRunnable::~FCSharpCompilerRunnable()
 	{
 		FUnrealCSharpCoreModuleDelegates::OnBeginGenerator.Remove(OnBeginGeneratorDelegateHandle);
 	}
+
+	if (PublishEvent != nullptr)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(PublishEvent);
+
+		PublishEvent = nullptr;
+	}
 }
 
 bool FCSharpCompilerRunnable::Init()
 {
-	Event = FPlatformProcess::GetSynchEventFromPool(true);
+	Event = FPlatformProcess::GetSynchEventFromPool(false);
 
 	return FRunnable::Init();
 }
 
 uint32 FCSharpCompilerRunnable::Run()
 {
-	while (true)
+	while (!bIsStopped)
 	{
-		if (bIsStopped)
-		{
-			return 0;
-		}
+		bool Task = false;
+
+		auto LatencyCycles = INDEX_NONE;
 
 		if (!bIsGenerating)
 		{
-			if (!Tasks.IsEmpty())
-			{
-				bool Task = false;
+			FScopeLock ScopeLock(&CriticalSection);
 
-				{
-					FScopeLock ScopeLock(&CriticalSection);
-
-					if (!Tasks.IsEmpty())
-					{
-						Tasks.Dequeue(Task);
-					}
-				}
-
-				if (Task == true)
-				{
-					DoWork();
-				}
-			}
-			else
+			if (!Tasks.Dequeue(Task))
 			{
-				if (Event != nullptr)
-				{
-					Event->Wait();
-				}
+				LatencyCycles = PendingLatencyCycles.exchange(INDEX_NONE);
 			}
 		}
+
+		if (Task == true)
+		{
+			DoWork();
+		}
+		else if (LatencyCycles != INDEX_NONE)
+		{
+			DoMeasureLatency(LatencyCycles);
+		}
+		else if (Event != nullptr)
+		{
+			// auto-reset: EnqueueTask, OnEndGenerator and Stop each wake us exactly once
+			Event->Wait();
+		}
 	}
+
+	return 0;
 }
 
 void FCSharpCompilerRunnable::Stop()
@@ -98,6 +112,16 @@ void FCSharpCompilerRunnable::Stop()
 
 void FCSharpCompilerRunnable::Exit()
 {
+	// during exit purge the socket subsystem may already be gone, the server then exits once its connection closes
+	if (!GExitPurge)
+	{
+		BeginPublish();
+
+		StopCompileServer(true);
+
+		EndPublish();
+	}
+
 	if (Event != nullptr)
 	{
 		FPlatformProcess::ReturnSynchEventToPool(Event);
@@ -142,7 +166,7 @@ void FCSharpCompilerRunnable::EnqueueTask(const TArray<FFileChangeData>& InFileC
 
 bool FCSharpCompilerRunnable::IsCompiling() const
 {
-	return bIsCompiling == true || !Tasks.IsEmpty();
+	return CompilingCount.load() > 0 || !Tasks.IsEmpty();
 }
 
 void FCSharpCompilerRunnable::DoWork()
@@ -170,9 +194,22 @@ void FCSharpCompilerRunnable::Compile(const TFunction<void()>& InFunction)
 	{
 		if (UnrealCSharpEditorSetting->EnableCompiled())
 		{
-			bIsCompiling = true;
+			++CompilingCount;
+
+			TArray<FFileChangeData> FileChangeData;
+
+			{
+				FScopeLock ScopeLock(&CriticalSection);
+
+				FileChangeData = FileChanges;
+			}
+
+			BeginPublish();
+
+			Compile(FileChangeData);
 
-			Compile();
+			// released before the game thread part, a game thread waiting in BeginPublish can then never block it
+			EndPublish();
 
 			const auto Task = FFunctionGraphTask::CreateAndDispatchWhenReady(
 				[InFunction, this]()
@@ -190,16 +227,88 @@ void FCSharpCompilerRunnable::Compile(const TFunction<void()>& InFunction)
 
 			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 
-			bIsCompiling = false;
+			--CompilingCount;
 		}
 	}
 }
 
-void FCSharpCompilerRunnable::Compile()
+void FCSharpCompilerRunnable::MeasureLatency(const int32 InCycles)
+{
+	// measured on the compiler thread, so it never overlaps another publish
+	PendingLatencyCycles = FMath::Max(InCycles, 0);
+
+	if (Event != nullptr)
+	{
+		Event->Trigger();
+	}
+}
+
+void FCSharpCompilerRunnable::BeginPublish()
+{
+	// one publish at a time, they share the output directory, the log file and the compile server connection
+	for (auto bExpected = false; !bIsPublishing.compare_exchange_strong(bExpected, true); bExpected = false)
+	{
+		PublishEvent->Wait();
+	}
+}
+
+void FCSharpCompilerRunnable::EndPublish()
+{
+	bIsPublishing = false;
+
+	// auto-reset: wakes one waiter, which triggers the next one when it is done in turn
+	PublishEvent->Trigger();
+}
+
+void FCSharpCompilerRunnable::DoMeasureLatency(const int32 InCycles)
+{
+	BeginPublish();
+
+	const auto bEnableCompileServer = IsCompileServerEnabled();
+
+	// cold: nothing kept warm, no compile server, no reused build node and no shared compiler
+	StopCompileServer(true);
+
+	auto StartTime = FPlatformTime::Seconds();
+
+	PublishWithProcess(true);
+
+	const auto ColdTime = FPlatformTime::Seconds() - StartTime;
+
+	// first: what the first publish of an editor session costs, the compile server included when enabled
+	StartTime = FPlatformTime::Seconds();
+
+	Publish(GetCompileServerChanges({}));
+
+	const auto FirstTime = FPlatformTime::Seconds() - StartTime;
+
+	auto WarmTime = 0.0;
+
+	for (auto Index = 0; Index < InCycles; ++Index)
+	{
+		StartTime = FPlatformTime::Seconds();
+
+		Publish({});
+
+		WarmTime += FPlatformTime::Seconds() - StartTime;
+	}
+
+	EndPublish();
+
+	UE_LOG(LogUnrealCSharp, Log,
+	       TEXT("Compile latency: cold %.3fs, first %.3fs, warm %.3fs (average of %d), compile server %s"),
+	       ColdTime,
+	       FirstTime,
+	       InCycles > 0 ? WarmTime / InCycles : 0.0,
+	       InCycles,
+	       bEnableCompileServer ? TEXT("enabled") : TEXT("disabled"));
+}
+
+bool FCSharpCompilerRunnable::Compile(const TArray<FFileChangeData>& InFileChangeData)
 {
 	if (!IFileManager::Get().FileExists(*FUnrealCSharpFunctionLibrary::GetGameProjectPath()))
 	{
-		return;
+		return false;
 	}
 
 	AsyncTask(ENamedThreads::GameThread, [this]()
@@ -232,49 +341,15 @@ void FCSharpCompilerRunnable::Compile()
 		NotificationItem = FSlateNotificationManager::Get().AddNotification(NotificationInfo);
 	});
 
-	static auto CompileTool = FUnrealCSharpFunctionLibrary::GetDotNet();
+	const auto StartTime = FPlatformTime::Seconds();
 
-	const auto CompileParam = FString::Printf(TEXT(
-		"publish \"%s\" --nologo -c Debug -o \"%s\""
-	),
-	                                          *FUnrealCSharpFunctionLibrary::GetGameProjectPath(),
-	                                          *FUnrealCSharpFunctionLibrary::GetFullPublishDirectory()
-	);
-
-	void* ReadPipe = nullptr;
+	const auto ReturnCode = Publish(GetCompileServerChanges(InFileChangeData));
 
-	void* WritePipe = nullptr;
-
-	auto OutProcessID = 0u;
-
-	FString Result;
-
-	FPlatformProcess::CreatePipe(ReadPipe, WritePipe, true);
-
-	auto ProcessHandle = FPlatformProcess::CreateProc(
-		*CompileTool,
-		*CompileParam,
-		false,
-		true,
-		true,
-		&OutProcessID,
-		1,
-		nullptr,
-		nullptr,
-		ReadPipe);
-
-	while (ProcessHandle.IsValid() && FPlatformProcess::IsApplicationRunning(OutProcessID))
-	{
-		FPlatformProcess::Sleep(0.01f);
-
-		Result.Append(FPlatformProcess::ReadPipe(ReadPipe));
-	}
+	UE_LOG(LogUnrealCSharp, Verbose, TEXT("Publish took %.3fs"), FPlatformTime::Seconds() - StartTime);
 
 	FNotificationInfo* NotificationInfo{};
 
-	auto ReturnCode = 0;
-
-	if (FPlatformProcess::GetProcReturnCode(ProcessHandle, &ReturnCode))
+	if (ReturnCode != INDEX_NONE)
 	{
 		[[maybe_unused]] static const FName CompileStatusUnknown("Blueprint.CompileStatus.Overlay.Unknown");
 
@@ -308,14 +383,14 @@ void FCSharpCompilerRunnable::Compile()
 			NotificationInfo->Image = FEditorStyle::GetBrush(CompileStatusError);
 #endif
 
+			FString Result;
+
+			FFileHelper::LoadFileToString(Result, *GetLogFile());
+
 			UE_LOG(LogUnrealCSharp, Error, TEXT("%s"), *Result);
 		}
 	}
 
-	FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
-
-	FPlatformProcess::CloseProc(ProcessHandle);
-
 	AsyncTask(ENamedThreads::GameThread, [this, NotificationInfo]()
 	{
 		if (GExitPurge)
@@ -341,6 +416,386 @@ void FCSharpCompilerRunnable::Compile()
 			FSlateNotificationManager::Get().QueueNotification(NotificationInfo);
 		}
 	});
+
+	return ReturnCode == 0;
+}
+
+int32 FCSharpCompilerRunnable::Publish(const TArray<FString>& InChanges)
+{
+	if (IsCompileServerEnabled())
+	{
+		if (const auto ReturnCode = PublishWithCompileServer(InChanges); ReturnCode != INDEX_NONE)
+		{
+			return ReturnCode;
+		}
+
+		UE_LOG(LogUnrealCSharp, Warning, TEXT("Compile server is unavailable, publishing with dotnet instead"));
+	}
+	else
+	{
+		StopCompileServer(true);
+	}
+
+	return PublishWithProcess(false);
+}
+
+int32 FCSharpCompilerRunnable::PublishWithProcess(const bool bInIsCold) const
+{
+	static auto CompileTool = FUnrealCSharpFunctionLibrary::GetDotNet();
+
+	const auto CompileParam = FString::Printf(TEXT(
+		"publish \"%s\" --nologo -c Debug -o \"%s\" -noConsoleLogger -flp:\"LogFile=%s;Verbosity=minimal\"%s"
+	),
+	                                          *FUnrealCSharpFunctionLibrary::GetGameProjectPath(),
+	                                          *FUnrealCSharpFunctionLibrary::GetFullPublishDirectory(),
+	                                          *GetLogFile(),
+	                                          bInIsCold ? TEXT(" -nodeReuse:false -p:UseSharedCompilation=false") : TEXT("")
+	);
+
+	auto ProcessHandle = FPlatformProcess::CreateProc(
+		*CompileTool,
+		*CompileParam,
+		false,
+		true,
+		true,
+		nullptr,
+		1,
+		nullptr,
+		nullptr,
+		nullptr);
+
+	auto ReturnCode = INDEX_NONE;
+
+	if (ProcessHandle.IsValid())
+	{
+		FPlatformProcess::WaitForProc(ProcessHandle);
+
+		if (!FPlatformProcess::GetProcReturnCode(ProcessHandle, &ReturnCode))
+		{
+			ReturnCode = INDEX_NONE;
+		}
+	}
+
+	FPlatformProcess::CloseProc(ProcessHandle);
+
+	return ReturnCode;
+}
+
+int32 FCSharpCompilerRunnable::PublishWithCompileServer(const TArray<FString>& InChanges)
+{
+	if (!StartCompileServer())
+	{
+		return INDEX_NONE;
+	}
+
+	FString Request;
+
+	for (const auto& Change : InChanges)
+	{
+		Request += Change + TEXT("\n");
+	}
+
+	Request += TEXT("Publish\n");
+
+	const FTCHARToUTF8 Utf8Request(*Request);
+
+	for (auto Offset = 0; Offset < Utf8Request.Length();)
+	{
+		auto BytesSent = 0;
+
+		if (!CompileServerSocket->Send(reinterpret_cast<const uint8*>(Utf8Request.Get()) + Offset,
+		                               Utf8Request.Length() - Offset, BytesSent) || BytesSent <= 0)
+		{
+			StopCompileServer(false);
+
+			return INDEX_NONE;
+		}
+
+		Offset += BytesSent;
+	}
+
+	if (FString Response; ReadCompileServerLine(Response) && Response.IsNumeric())
+	{
+		return FCString::Atoi(*Response);
+	}
+
+	StopCompileServer(false);
+
+	return INDEX_NONE;
+}
+
+bool FCSharpCompilerRunnable::StartCompileServer()
+{
+	if (CompileServerSocket != nullptr)
+	{
+		return true;
+	}
+
+	StopCompileServer(false);
+
+	const auto ProjectPath = FUnrealCSharpFunctionLibrary::GetCompileServerProjectPath();
+
+	if (!IFileManager::Get().FileExists(*ProjectPath))
+	{
+		return false;
+	}
+
+	static auto CompileTool = FUnrealCSharpFunctionLibrary::GetDotNet();
+
+	// built once per editor session, it bakes in the MSBuild of the SDK that is also used to publish
+	if (!bIsCompileServerBuilt)
+	{
+		const auto BuildParam = FString::Printf(TEXT(
+			"build \"%s\" --nologo -c Release -noConsoleLogger -flp:\"LogFile=%s;Verbosity=minimal\""
+		),
+		                                        *ProjectPath,
+		                                        *GetLogFile()
+		);
+
+		auto ProcessHandle = FPlatformProcess::CreateProc(
+			*CompileTool,
+			*BuildParam,
+			false,
+			true,
+			true,
+			nullptr,
+			1,
+			nullptr,
+			nullptr,
+			nullptr);
+
+		auto ReturnCode = INDEX_NONE;
+
+		if (ProcessHandle.IsValid())
+		{
+			FPlatformProcess::WaitForProc(ProcessHandle);
+
+			FPlatformProcess::GetProcReturnCode(ProcessHandle, &ReturnCode);
+		}
+
+		FPlatformProcess::CloseProc(ProcessHandle);
+
+		if (ReturnCode != 0)
+		{
+			return false;
+		}
+
+		bIsCompileServerBuilt = true;
+	}
+
+	const auto SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+
+	if (SocketSubsystem == nullptr)
+	{
+		return false;
+	}
+
+	const auto ListenSocket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("CSharpCompileServer"), false);
+
+	if (ListenSocket == nullptr)
+	{
+		return false;
+	}
+
+	const auto Address = SocketSubsystem->CreateInternetAddr();
+
+	Address->SetLoopbackAddress();
+
+	Address->SetPort(0);
+
+	if (ListenSocket->Bind(*Address) && ListenSocket->Listen(1))
+	{
+		const auto Program = FPaths::Combine(FUnrealCSharpFunctionLibrary::GetCompileServerCSProjPath(),
+		                                     FString::Printf(TEXT(
+			                                     "%s%s"
+		                                     ),
+		                                                     *COMPILE_SERVER_NAME,
+#if PLATFORM_WINDOWS
+		                                                     TEXT(".exe")
+#else
+		                                                     TEXT("")
+#endif
+		                                     ));
+
+		const auto ServerParam = FString::Printf(TEXT(
+			"%d \"%s\" \"%s\" \"%s\""
+		),
+		                                         ListenSocket->GetPortNo(),
+		                                         *FUnrealCSharpFunctionLibrary::GetGameProjectPath(),
+		                                         *FUnrealCSharpFunctionLibrary::GetFullPublishDirectory(),
+		                                         *GetLogFile()
+		);
+
+		CompileServerHandle = FPlatformProcess::CreateProc(
+			*Program,
+			*ServerParam,
+			false,
+			true,
+			true,
+			nullptr,
+			1,
+			nullptr,
+			nullptr,
+			nullptr);
+
+		// the server connects once its runtime is up, give up early if it exits instead
+		for (auto Second = 0; Second < 30 && FPlatformProcess::IsProcRunning(CompileServerHandle); ++Second)
+		{
+			if (auto bHasPendingConnection = false;
+				ListenSocket->WaitForPendingConnection(bHasPendingConnection, FTimespan::FromSeconds(1)) &&
+				bHasPendingConnection)
+			{
+				CompileServerSocket = ListenSocket->Accept(TEXT("CSharpCompileServer"));
+
+				break;
+			}
+		}
+	}
+
+	ListenSocket->Close();
+
+	SocketSubsystem->DestroySocket(ListenSocket);
+
+	if (CompileServerSocket == nullptr)
+	{
+		StopCompileServer(false);
+
+		// a newer SDK may have replaced the MSBuild the server was built against
+		bIsCompileServerBuilt = false;
+
+		return false;
+	}
+
+	return true;
+}
+
+void FCSharpCompilerRunnable::StopCompileServer(const bool bInIsGraceful)
+{
+	if (CompileServerSocket != nullptr)
+	{
+		if (bInIsGraceful)
+		{
+			const FTCHARToUTF8 Utf8Shutdown(TEXT("Shutdown\n"));
+
+			auto BytesSent = 0;
+
+			CompileServerSocket->Send(reinterpret_cast<const uint8*>(Utf8Shutdown.Get()), Utf8Shutdown.Length(),
+			                          BytesSent);
+		}
+
+		CompileServerSocket->Close();
+
+		if (const auto SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM))
+		{
+			SocketSubsystem->DestroySocket(CompileServerSocket);
+		}
+
+		CompileServerSocket = nullptr;
+	}
+
+	CompileServerBuffer.Empty();
+
+	if (CompileServerHandle.IsValid())
+	{
+		if (bInIsGraceful)
+		{
+			// an idle server exits as soon as it reads Shutdown or sees its connection close
+			FPlatformProcess::WaitForProc(CompileServerHandle);
+		}
+		else
+		{
+			FPlatformProcess::TerminateProc(CompileServerHandle, true);
+		}
+
+		FPlatformProcess::CloseProc(CompileServerHandle);
+
+		CompileServerHandle.Reset();
+	}
+}
+
+bool FCSharpCompilerRunnable::ReadCompileServerLine(FString& OutLine)
+{
+	while (true)
+	{
+		if (const auto Index = CompileServerBuffer.Find('\n'); Index != INDEX_NONE)
+		{
+			OutLine = FString(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(CompileServerBuffer.GetData()), Index));
+
+			CompileServerBuffer.RemoveAt(0, Index + 1);
+
+			return true;
+		}
+
+		// a publish takes as long as it takes, the timeout only notices a server that died without closing the socket
+		if (!CompileServerSocket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(1)))
+		{
+			if (!FPlatformProcess::IsProcRunning(CompileServerHandle))
+			{
+				return false;
+			}
+
+			continue;
+		}
+
+		uint8 Data[256];
+
+		auto BytesRead = 0;
+
+		if (!CompileServerSocket->Recv(Data, sizeof(Data), BytesRead) || BytesRead <= 0)
+		{
+			return false;
+		}
+
+		CompileServerBuffer.Append(Data, BytesRead);
+	}
+}
+
+TArray<FString> FCSharpCompilerRunnable::GetCompileServerChanges(const TArray<FFileChangeData>& InFileChangeData)
+{
+	TArray<FString> Changes;
+
+	for (const auto& FileChangeData : InFileChangeData)
+	{
+		Changes.Add(FString::Printf(TEXT(
+			"%s\t%s"
+		),
+		                            FileChangeData.Action == FFileChangeData::FCA_Added
+			                            ? TEXT("Added")
+			                            : FileChangeData.Action == FFileChangeData::FCA_Modified
+			                            ? TEXT("Modified")
+			                            : FileChangeData.Action == FFileChangeData::FCA_Removed
+			                            ? TEXT("Removed")
+			                            : TEXT("Unknown"),
+		                            *FileChangeData.Filename
+		));
+	}
+
+	// nothing reported means anything may have changed, generated code for example
+	if (Changes.IsEmpty())
+	{
+		Changes.Add(TEXT("Unknown\t"));
+	}
+
+	return Changes;
+}
+
+FString FCSharpCompilerRunnable::GetLogFile()
+{
+	static auto LogFile = FPaths::ConvertRelativePathToFull(
+		FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("UnrealCSharp_Compile.log")));
+
+	return LogFile;
+}
+
+bool FCSharpCompilerRunnable::IsCompileServerEnabled()
+{
+	if (const auto UnrealCSharpEditorSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
+		UUnrealCSharpEditorSetting>())
+	{
+		return UnrealCSharpEditorSetting->EnableCompileServer();
+	}
+
+	return false;
 }
 
 void FCSharpCompilerRunnable::OnBeginGenerator()
@@ -359,4 +814,9 @@ void FCSharpCompilerRunnable::OnEndGenerator()
 	Tasks.Empty();
 
 	FileChanges.Empty();
+
+	if (Event != nullptr)
+	{
+		Event->Trigger();
+	}
 }
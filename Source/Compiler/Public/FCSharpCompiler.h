@@ -23,6 +23,8 @@ public:
 
 	bool IsCompiling() const;
 
+	void MeasureLatency(int32 InCycles) const;
+
 private:
 	class FCSharpCompilerRunnable* Runnable;
 
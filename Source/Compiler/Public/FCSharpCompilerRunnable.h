@@ -1,6 +1,9 @@
 ﻿#pragma once
 
 #include "IDirectoryWatcher.h"
+#include <atomic>
+
+class FSocket;
 
 class FCSharpCompilerRunnable final : public FRunnable
 {
@@ -31,8 +34,34 @@ public:
 
 	void Compile(const TFunction<void()>& InFunction);
 
+	void MeasureLatency(int32 InCycles);
+
 private:
-	void Compile();
+	bool Compile(const TArray<FFileChangeData>& InFileChangeData);
+
+	int32 Publish(const TArray<FString>& InChanges);
+
+	int32 PublishWithProcess(bool bInIsCold) const;
+
+	int32 PublishWithCompileServer(const TArray<FString>& InChanges);
+
+	bool StartCompileServer();
+
+	void StopCompileServer(bool bInIsGraceful);
+
+	bool ReadCompileServerLine(FString& OutLine);
+
+	void BeginPublish();
+
+	void EndPublish();
+
+	void DoMeasureLatency(int32 InCycles);
+
+	static TArray<FString> GetCompileServerChanges(const TArray<FFileChangeData>& InFileChangeData);
+
+	static FString GetLogFile();
+
+	static bool IsCompileServerEnabled();
 
 private:
 	void OnBeginGenerator();
@@ -52,11 +81,25 @@ private:
 
 	FEvent* Event;
 
-	bool bIsCompiling;
+	FEvent* PublishEvent;
+
+	std::atomic<int32> CompilingCount;
+
+	std::atomic<bool> bIsPublishing;
+
+	std::atomic<int32> PendingLatencyCycles;
 
 	bool bIsGenerating;
 
 	bool bIsStopped;
 
+	bool bIsCompileServerBuilt;
+
+	FProcHandle CompileServerHandle;
+
+	FSocket* CompileServerSocket;
+
+	TArray<uint8> CompileServerBuffer;
+
 	TSharedPtr<SNotificationItem> NotificationItem;
 };
@@ -182,5 +182,5 @@ void FAssetGenerator::GeneratorAsset(const FAssetData& InAssetData)
 		                                     InAssetData, FUnrealCSharpFunctionLibrary::GetFullClass(SuperClass))
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FUnrealCSharpFunctionLibrary::GetFileName(InAssetData), Content);
+	FGeneratorCore::SaveStringToFile(FUnrealCSharpFunctionLibrary::GetFileName(InAssetData), Content);
 }
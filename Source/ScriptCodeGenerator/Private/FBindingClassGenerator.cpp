@@ -335,6 +335,9 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 
 		FString FunctionDefaultParamBody;
 
+		// value type parameters whose default is not a constant are declared nullable and resolved in place
+		TMap<int32, FString> FunctionNullableDefaultParam;
+
 		const auto& DefaultArguments = Function.GetDefaultArguments();
 
 		if (!Function.GetParamNames().IsEmpty())
@@ -356,7 +359,13 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 
 				if (Params.Num() - Index <= DefaultArguments.Num())
 				{
-					if (Params[Index]->IsPrimitive())
+					if (Params[Index]->IsPrimitive() && DefaultArguments[DefaultArgumentIndex].StartsWith(TEXT("new ")))
+					{
+						DefaultParam = TEXT(" = null");
+
+						FunctionNullableDefaultParam.Add(Index, DefaultArguments[DefaultArgumentIndex]);
+					}
+					else if (Params[Index]->IsPrimitive())
 					{
 						DefaultParam = FString::Printf(TEXT(
 							" = %s"),
@@ -384,9 +393,12 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 				}
 
 				FunctionDeclarationBody += FString::Printf(TEXT(
-					"%s %s%s%s"
+					"%s%s %s%s%s"
 				),
 				                                           *Params[Index]->GetName(),
+				                                           FunctionNullableDefaultParam.Contains(Index)
+					                                           ? TEXT("?")
+					                                           : TEXT(""),
 				                                           *FunctionParamName[Index],
 				                                           *DefaultParam,
 				                                           Index == Params.Num() - 1 ? TEXT("") : TEXT(", ")
@@ -482,7 +494,13 @@ void FBindingClassGenerator::GeneratorPartial(const FBindingClass* InClass)
 					                                : *FString::Printf(TEXT(
 						                                " + %d"),
 					                                                   BufferSize),
-				                                Params[Index]->IsPrimitive()
+				                                FunctionNullableDefaultParam.Contains(Index)
+					                                ? *FString::Printf(TEXT(
+						                                "%s ?? %s"),
+					                                                   *FunctionParamName[Index],
+					                                                   *FunctionNullableDefaultParam[Index]
+					                                )
+					                                : Params[Index]->IsPrimitive()
 					                                ? *FunctionParamName[Index]
 					                                : *FString::Printf(TEXT(
 						                                "%s?.%s ?? nint.Zero"),
@@ -15,13 +15,20 @@
 
 void FClassGenerator::Generator()
 {
+	TArray<const UClass*> Classes;
+
 	for (TObjectIterator<UClass> ClassIterator; ClassIterator; ++ClassIterator)
 	{
 		if (!Cast<UBlueprintGeneratedClass>(*ClassIterator))
 		{
-			Generator(*ClassIterator);
+			Classes.Add(*ClassIterator);
 		}
 	}
+
+	FGeneratorCore::ParallelGenerator(Classes, [](const UClass* InClass)
+	{
+		Generator(InClass);
+	});
 }
 
 void FClassGenerator::Generator(const UClass* InClass)
@@ -511,6 +518,18 @@ void FClassGenerator::Generator(const UClass* InClass)
 				FunctionOutParamIndex, FunctionRefParamIndex);
 		}
 
+		TArray<FString> FunctionNameDefaultParam;
+
+		FunctionNameDefaultParam.AddDefaulted(FunctionParams.Num());
+
+		if (bGeneratorFunctionDefaultParam)
+		{
+			for (auto Index = 0; Index < FunctionParams.Num(); ++Index)
+			{
+				FunctionNameDefaultParam[Index] = GetNameFunctionDefaultParam(Function, FunctionParams[Index]);
+			}
+		}
+
 		for (auto Index = 0; Index < FunctionParams.Num(); ++Index)
 		{
 			if (FunctionOutParamIndex.Contains(Index))
@@ -523,10 +542,15 @@ void FClassGenerator::Generator(const UClass* InClass)
 			}
 
 			FunctionDeclarationBody += FString::Printf(TEXT(
-				"%s %s%s%s"),
+				"%s%s %s%s%s"),
 			                                           *FGeneratorCore::GetPropertyType(FunctionParams[Index]),
+			                                           FunctionNameDefaultParam[Index].IsEmpty()
+				                                           ? TEXT("")
+				                                           : TEXT("?"),
 			                                           *FUnrealCSharpFunctionLibrary::Encode(FunctionParams[Index]),
-			                                           bGeneratorFunctionDefaultParam
+			                                           !FunctionNameDefaultParam[Index].IsEmpty()
+				                                           ? TEXT(" = null")
+				                                           : bGeneratorFunctionDefaultParam
 				                                           ? *GetFunctionDefaultParam(
 					                                           Function, FunctionParams[Index])
 				                                           : TEXT(""),
@@ -589,7 +613,13 @@ void FClassGenerator::Generator(const UClass* InClass)
 						                                : *FString::Printf(TEXT(
 							                                " + %d"),
 						                                                   BufferSize),
-					                                *FGeneratorCore::GetParamName(FunctionParams[Index])
+					                                FunctionNameDefaultParam[Index].IsEmpty()
+						                                ? *FGeneratorCore::GetParamName(FunctionParams[Index])
+						                                : *FString::Printf(TEXT(
+							                                "%s ?? %s"),
+						                                                   *FGeneratorCore::GetParamName(
+							                                                   FunctionParams[Index]),
+						                                                   *FunctionNameDefaultParam[Index])
 					);
 
 					BufferSize += FGeneratorCore::GetBufferSize(FunctionParams[Index]);
@@ -865,7 +895,7 @@ void FClassGenerator::Generator(const UClass* InClass)
 	                               *IInterfaceContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InClass), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InClass), Content);
 }
 
 bool FClassGenerator::GeneratorFunctionDefaultParam(const TArray<int32>& InFunctionOutParamIndex,
@@ -1012,9 +1042,7 @@ FString FClassGenerator::GetCppFunctionDefaultParam(const UFunction* InFunction,
 
 	if (CastField<FNameProperty>(InProperty))
 	{
-		// @TODO
-
-		return FString::Printf(TEXT(" = null"));
+		return FString::Printf(TEXT(" = default"));
 	}
 
 	if (CastField<FStructProperty>(InProperty))
@@ -1153,9 +1181,7 @@ FString FClassGenerator::GetBlueprintFunctionDefaultParam(const UFunction* InFun
 
 	if (CastField<FNameProperty>(InProperty))
 	{
-		// @TODO
-
-		return FString::Printf(TEXT(" = null"));
+		return FString::Printf(TEXT(" = default"));
 	}
 
 	if (CastField<FDelegateProperty>(InProperty))
@@ -1251,6 +1277,27 @@ FString FClassGenerator::GetBlueprintFunctionDefaultParam(const UFunction* InFun
 	return TEXT("");
 }
 
+FString FClassGenerator::GetNameFunctionDefaultParam(const UFunction* InFunction, FProperty* InProperty)
+{
+	if (!CastField<FNameProperty>(InProperty) || !HasFunctionDefaultParam(InFunction, InProperty))
+	{
+		return TEXT("");
+	}
+
+	const auto Key = Cast<UBlueprintGeneratedClass>(InFunction->GetOuter())
+		                 ? InProperty->GetName()
+		                 : FString::Printf(TEXT("CPP_Default_%s"), *InProperty->GetName());
+
+	const auto MetaData = InFunction->GetMetaData(*Key);
+
+	if (MetaData.IsEmpty() || MetaData == TEXT("None"))
+	{
+		return TEXT("");
+	}
+
+	return FString::Printf(TEXT("new FName(\"%s\")"), *MetaData);
+}
+
 FString FClassGenerator::GeneratorFunctionDefaultParam(const UFunction* InFunction, FProperty* InProperty)
 {
 	if (InFunction == nullptr || InProperty == nullptr)
@@ -1306,16 +1353,6 @@ FString FClassGenerator::GeneratorBlueprintFunctionDefaultParam(const UFunction*
 
 FString FClassGenerator::GeneratorFunctionDefaultParam(FProperty* InProperty, const FString& InMetaData)
 {
-	if (CastField<FNameProperty>(InProperty))
-	{
-		return FString::Printf(TEXT(
-			"\t\t\t\t%s \?\?= new FName(\"%s\");\n\n"
-		),
-		                       *FUnrealCSharpFunctionLibrary::Encode(InProperty),
-		                       *InMetaData
-		);
-	}
-
 	if (const auto StructProperty = CastField<FStructProperty>(InProperty))
 	{
 		if (StructProperty->Struct == TBaseStructure<FRotator>::Get())
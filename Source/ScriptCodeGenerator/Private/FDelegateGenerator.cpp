@@ -7,6 +7,8 @@
 
 TSet<TPair<FString, FString>> FDelegateGenerator::Delegate;
 
+FCriticalSection FDelegateGenerator::DelegateCriticalSection;
+
 void FDelegateGenerator::Generator(FProperty* InProperty)
 {
 	if (InProperty == nullptr)
@@ -39,12 +41,18 @@ void FDelegateGenerator::Generator(FDelegateProperty* InDelegateProperty)
 
 	auto ClassContent = FUnrealCSharpFunctionLibrary::GetFullClass(InDelegateProperty);
 
-	if (Delegate.Contains({NameSpaceContent, ClassContent}))
 	{
-		return;
-	}
+		FScopeLock ScopeLock(&DelegateCriticalSection);
+
+		auto bIsAlreadyInSet = false;
 
-	Delegate.Add({NameSpaceContent, ClassContent});
+		Delegate.Add({NameSpaceContent, ClassContent}, &bIsAlreadyInSet);
+
+		if (bIsAlreadyInSet)
+		{
+			return;
+		}
+	}
 
 	FString DelegateDeclarationContent;
 
@@ -401,7 +409,7 @@ void FDelegateGenerator::Generator(FDelegateProperty* InDelegateProperty)
 	                               *GCHandleContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InDelegateProperty), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InDelegateProperty), Content);
 }
 
 void FDelegateGenerator::Generator(FMulticastDelegateProperty* InMulticastDelegateProperty)
@@ -419,12 +427,18 @@ void FDelegateGenerator::Generator(FMulticastDelegateProperty* InMulticastDelega
 
 	auto ClassContent = FUnrealCSharpFunctionLibrary::GetFullClass(InMulticastDelegateProperty);
 
-	if (Delegate.Contains({NameSpaceContent, ClassContent}))
 	{
-		return;
-	}
+		FScopeLock ScopeLock(&DelegateCriticalSection);
+
+		auto bIsAlreadyInSet = false;
+
+		Delegate.Add({NameSpaceContent, ClassContent}, &bIsAlreadyInSet);
 
-	Delegate.Add({NameSpaceContent, ClassContent});
+		if (bIsAlreadyInSet)
+		{
+			return;
+		}
+	}
 
 	FString DelegateDeclarationContent;
 
@@ -754,5 +768,5 @@ void FDelegateGenerator::Generator(FMulticastDelegateProperty* InMulticastDelega
 	                               *GCHandleContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InMulticastDelegateProperty), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InMulticastDelegateProperty), Content);
 }
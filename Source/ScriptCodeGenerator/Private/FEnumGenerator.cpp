@@ -7,16 +7,25 @@
 
 TMap<const UEnum*, EEnumUnderlyingType> FEnumGenerator::EnumUnderlyingType;
 
+FRWLock FEnumGenerator::EnumUnderlyingTypeLock;
+
 void FEnumGenerator::Generator()
 {
+	TArray<const UEnum*> Enums;
+
 	for (TObjectIterator<UEnum> EnumIterator; EnumIterator; ++EnumIterator)
 	{
 		if (!Cast<UUserDefinedEnum>(*EnumIterator))
 		{
-			Generator(*EnumIterator);
+			Enums.Add(*EnumIterator);
 		}
 	}
 
+	FGeneratorCore::ParallelGenerator(Enums, [](const UEnum* InEnum)
+	{
+		Generator(InEnum);
+	});
+
 	GeneratorCollisionChannel();
 }
 
@@ -106,7 +115,7 @@ void FEnumGenerator::Generator(const UEnum* InEnum)
 	                                     *EnumeratorContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InEnum), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InEnum), Content);
 }
 
 void FEnumGenerator::AddEnumUnderlyingType(const UEnum* InEnum, const FNumericProperty* InNumericProperty)
@@ -116,9 +125,13 @@ void FEnumGenerator::AddEnumUnderlyingType(const UEnum* InEnum, const FNumericPr
 		return;
 	}
 
-	if (EnumUnderlyingType.Contains(InEnum))
 	{
-		return;
+		FReadScopeLock ReadScopeLock(EnumUnderlyingTypeLock);
+
+		if (EnumUnderlyingType.Contains(InEnum))
+		{
+			return;
+		}
 	}
 
 	auto UnderlyingType = EEnumUnderlyingType::None;
@@ -156,7 +169,13 @@ void FEnumGenerator::AddEnumUnderlyingType(const UEnum* InEnum, const FNumericPr
 		UnderlyingType = EEnumUnderlyingType::UInt64;
 	}
 
-	EnumUnderlyingType.Emplace(InEnum, UnderlyingType);
+	FWriteScopeLock WriteScopeLock(EnumUnderlyingTypeLock);
+
+	// an enum always has the same underlying type, so whichever property registers it first wins
+	if (!EnumUnderlyingType.Contains(InEnum))
+	{
+		EnumUnderlyingType.Emplace(InEnum, UnderlyingType);
+	}
 }
 
 void FEnumGenerator::GeneratorCollisionChannel()
@@ -229,7 +248,7 @@ void FEnumGenerator::GeneratorCollisionChannel()
 	                                     *EnumeratorContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InEnum), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InEnum), Content);
 }
 
 FString FEnumGenerator::GetEnumUnderlyingTypeName(const UEnum* InEnum)
@@ -247,6 +266,8 @@ FString FEnumGenerator::GetEnumUnderlyingTypeName(const UEnum* InEnum)
 		{EEnumUnderlyingType::UInt64, TEXT("ulong")}
 	};
 
+	FReadScopeLock ReadScopeLock(EnumUnderlyingTypeLock);
+
 	if (const auto FoundEnumUnderlyingType = EnumUnderlyingType.Find(InEnum))
 	{
 		return EnumUnderlyingTypeName[*FoundEnumUnderlyingType];
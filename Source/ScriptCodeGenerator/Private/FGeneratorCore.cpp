@@ -9,6 +9,7 @@
 #include "CoreMacro/PropertyMacro.h"
 #include "Setting/UnrealCSharpEditorSetting.h"
 #include "UEVersion.h"
+#include "Hash/CityHash.h"
 #if UE_F_OPTIONAL_PROPERTY
 #include "UObject/PropertyOptional.h"
 #endif
@@ -25,6 +26,16 @@ TArray<FString> FGeneratorCore::SupportedAssetPath;
 
 TMap<TWeakObjectPtr<const UObject>, bool> FGeneratorCore::SupportedMap;
 
+FRWLock FGeneratorCore::SupportedMapLock;
+
+bool FGeneratorCore::bIsParallelGenerator;
+
+TMap<FString, uint64> FGeneratorCore::GeneratedFileHash;
+
+FCriticalSection FGeneratorCore::GeneratedFileHashCriticalSection;
+
+std::atomic<int32> FGeneratorCore::SavedFileNum;
+
 TArray<FName> FGeneratorCore::SupportedAssetClassName;
 
 FString FGeneratorCore::GetPathNameAttribute(const UField* InField)
@@ -455,6 +466,8 @@ FString FGeneratorCore::GetBufferCast(FProperty* Property)
 
 	if (CastField<FDoubleProperty>(Property)) return TEXT("double");
 
+	if (CastField<FNameProperty>(Property)) return TName<FName, FName>::Get();
+
 	return TEXT("nint");
 }
 
@@ -571,7 +584,8 @@ bool FGeneratorCore::IsPrimitiveProperty(FProperty* Property)
 		CastField<FInt8Property>(Property) || CastField<FInt16Property>(Property) ||
 		CastField<FIntProperty>(Property) || CastField<FInt64Property>(Property) ||
 		CastField<FBoolProperty>(Property) || CastField<FFloatProperty>(Property) ||
-		CastField<FEnumProperty>(Property) || CastField<FDoubleProperty>(Property))
+		CastField<FEnumProperty>(Property) || CastField<FDoubleProperty>(Property) ||
+		CastField<FNameProperty>(Property))
 	{
 		return true;
 	}
@@ -794,14 +808,14 @@ bool FGeneratorCore::IsSupported(const UClass* InClass)
 {
 	if (bIsGenerateAllModules && InClass->IsNative()) return true;
 
-	if (const auto FoundSupported = SupportedMap.Find(InClass))
+	if (bool bIsSupported; FindSupported(InClass, bIsSupported))
 	{
-		return *FoundSupported;
+		return bIsSupported;
 	}
 
 	if (!IsSupported(InClass->GetPackage()))
 	{
-		SupportedMap.Add(InClass, false);
+		AddSupported(InClass, false);
 
 		return false;
 	}
@@ -810,7 +824,7 @@ bool FGeneratorCore::IsSupported(const UClass* InClass)
 	{
 		if (!IsSupported(SuperClass))
 		{
-			SupportedMap.Add(InClass, false);
+			AddSupported(InClass, false);
 
 			return false;
 		}
@@ -820,13 +834,13 @@ bool FGeneratorCore::IsSupported(const UClass* InClass)
 	{
 		if (!IsSupported(Interface.Class))
 		{
-			SupportedMap.Add(InClass, false);
+			AddSupported(InClass, false);
 
 			return false;
 		}
 	}
 
-	SupportedMap.Add(InClass, true);
+	AddSupported(InClass, true);
 
 	return true;
 }
@@ -835,9 +849,9 @@ bool FGeneratorCore::IsSupported(const UFunction* InFunction)
 {
 	if (bIsGenerateAllModules && InFunction->IsNative()) return true;
 
-	if (const auto FoundSupported = SupportedMap.Find(InFunction))
+	if (bool bIsSupported; FindSupported(InFunction, bIsSupported))
 	{
-		return *FoundSupported;
+		return bIsSupported;
 	}
 
 	for (TFieldIterator<FProperty> ParamIterator(InFunction); ParamIterator && (ParamIterator->PropertyFlags
@@ -845,13 +859,13 @@ bool FGeneratorCore::IsSupported(const UFunction* InFunction)
 	{
 		if (!IsSupported(*ParamIterator))
 		{
-			SupportedMap.Add(InFunction, false);
+			AddSupported(InFunction, false);
 
 			return false;
 		}
 	}
 
-	SupportedMap.Add(InFunction, true);
+	AddSupported(InFunction, true);
 
 	return true;
 }
@@ -860,14 +874,14 @@ bool FGeneratorCore::IsSupported(const UScriptStruct* InScriptStruct)
 {
 	if (bIsGenerateAllModules && InScriptStruct->IsNative()) return true;
 
-	if (const auto FoundSupported = SupportedMap.Find(InScriptStruct))
+	if (bool bIsSupported; FindSupported(InScriptStruct, bIsSupported))
 	{
-		return *FoundSupported;
+		return bIsSupported;
 	}
 
 	if (!IsSupported(InScriptStruct->GetPackage()))
 	{
-		SupportedMap.Add(InScriptStruct, false);
+		AddSupported(InScriptStruct, false);
 
 		return false;
 	}
@@ -876,13 +890,13 @@ bool FGeneratorCore::IsSupported(const UScriptStruct* InScriptStruct)
 	{
 		if (!IsSupported(SuperStruct))
 		{
-			SupportedMap.Add(InScriptStruct, false);
+			AddSupported(InScriptStruct, false);
 
 			return false;
 		}
 	}
 
-	SupportedMap.Add(InScriptStruct, true);
+	AddSupported(InScriptStruct, true);
 
 	return true;
 }
@@ -891,23 +905,44 @@ bool FGeneratorCore::IsSupported(const UEnum* InEnum)
 {
 	if (bIsGenerateAllModules && InEnum->IsNative()) return true;
 
-	if (const auto FoundSupported = SupportedMap.Find(InEnum))
+	if (bool bIsSupported; FindSupported(InEnum, bIsSupported))
 	{
-		return *FoundSupported;
+		return bIsSupported;
 	}
 
 	if (!IsSupported(InEnum->GetPackage()))
 	{
-		SupportedMap.Add(InEnum, false);
+		AddSupported(InEnum, false);
 
 		return false;
 	}
 
-	SupportedMap.Add(InEnum, true);
+	AddSupported(InEnum, true);
 
 	return true;
 }
 
+bool FGeneratorCore::FindSupported(const UObject* InObject, bool& OutSupported)
+{
+	FReadScopeLock ReadScopeLock(SupportedMapLock);
+
+	if (const auto FoundSupported = SupportedMap.Find(InObject))
+	{
+		OutSupported = *FoundSupported;
+
+		return true;
+	}
+
+	return false;
+}
+
+void FGeneratorCore::AddSupported(const UObject* InObject, const bool bInSupported)
+{
+	FWriteScopeLock WriteScopeLock(SupportedMapLock);
+
+	SupportedMap.Add(InObject, bInSupported);
+}
+
 bool FGeneratorCore::IsSupported(const FAssetData& InAssetData)
 {
 	return IsSupported(InAssetData.GetPackage());
@@ -918,8 +953,77 @@ const TArray<FName>& FGeneratorCore::GetSupportedAssetClassName()
 	return SupportedAssetClassName;
 }
 
-void FGeneratorCore::BeginGenerator()
+EParallelForFlags FGeneratorCore::GetParallelForFlags()
+{
+	return bIsParallelGenerator ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread;
+}
+
+bool FGeneratorCore::SaveStringToFile(const FString& InFileName, const FString& InString)
+{
+	const FTCHARToUTF8 Content(*InString);
+
+	const auto Hash = CityHash64(Content.Get(), Content.Length());
+
+	{
+		FScopeLock ScopeLock(&GeneratedFileHashCriticalSection);
+
+		GeneratedFileHash.Add(InFileName, Hash);
+	}
+
+	if (TArray<uint8> Result; FFileHelper::LoadFileToArray(Result, *InFileName, FILEREAD_Silent))
+	{
+		// FFileHelper::EEncodingOptions::ForceUTF8 writes a BOM in front of the content
+		const auto Offset = Result.Num() >= 3 && Result[0] == 0xEF && Result[1] == 0xBB && Result[2] == 0xBF ? 3 : 0;
+
+		if (Result.Num() - Offset == Content.Length() &&
+			CityHash64(reinterpret_cast<const char*>(Result.GetData() + Offset), Result.Num() - Offset) == Hash)
+		{
+			return true;
+		}
+	}
+
+	++SavedFileNum;
+
+	return FUnrealCSharpFunctionLibrary::SaveStringToFile(InFileName, InString);
+}
+
+TMap<FString, uint64> FGeneratorCore::GetGeneratedFileHash()
+{
+	FScopeLock ScopeLock(&GeneratedFileHashCriticalSection);
+
+	return GeneratedFileHash;
+}
+
+int32 FGeneratorCore::GetSavedFileNum()
+{
+	return SavedFileNum;
+}
+
+void FGeneratorCore::BeginGenerator(const bool bInIsParallel)
 {
+	bIsParallelGenerator = bInIsParallel;
+
+	SavedFileNum = 0;
+
+	// lazily initialized on first use, so fill them before any worker reads them
+	FUnrealCSharpFunctionLibrary::GetEngineModuleList();
+
+	FUnrealCSharpFunctionLibrary::GetProjectModuleList();
+
+	if (bIsParallelGenerator)
+	{
+		// metadata is created on first access, which has to happen on the game thread
+		for (TObjectIterator<UStruct> StructIterator; StructIterator; ++StructIterator)
+		{
+			StructIterator->HasMetaData(TEXT("ToolTip"));
+		}
+
+		for (TObjectIterator<UEnum> EnumIterator; EnumIterator; ++EnumIterator)
+		{
+			EnumIterator->HasMetaData(TEXT("ToolTip"));
+		}
+	}
+
 	if (const auto UnrealCSharpEditorSetting = FUnrealCSharpFunctionLibrary::GetMutableDefaultSafe<
 		UUnrealCSharpEditorSetting>())
 	{
@@ -972,6 +1076,8 @@ void FGeneratorCore::EndGenerator()
 
 	SupportedAssetClassName.Empty();
 
+	GeneratedFileHash.Empty();
+
 	FDelegateGenerator::Delegate.Empty();
 
 	FEnumGenerator::EnumUnderlyingType.Empty();
@@ -22,6 +22,21 @@ void FSolutionGenerator::Generator()
 		FPaths::Combine(FUnrealCSharpFunctionLibrary::GetCodeAnalysisCSProjPath(), CODE_ANALYSIS_NAME + CSHARP_SUFFIX),
 		ScriptPath / CODE_ANALYSIS_NAME / CODE_ANALYSIS_NAME + CSHARP_SUFFIX);
 
+	CopyTemplate(
+		FUnrealCSharpFunctionLibrary::GetCompileServerProjectPath(),
+		ScriptPath / COMPILE_SERVER_NAME / COMPILE_SERVER_NAME + PROJECT_SUFFIX,
+		TArray<TFunction<void(FString& OutResult)>>
+		{
+			&FSolutionGenerator::ReplaceTargetFramework
+		});
+
+	// always refreshed, the editor and the compile server have to speak the same protocol
+	CopyTemplate(
+		FPaths::Combine(FUnrealCSharpFunctionLibrary::GetCompileServerCSProjPath(),
+		                COMPILE_SERVER_NAME + CSHARP_SUFFIX),
+		ScriptPath / COMPILE_SERVER_NAME / COMPILE_SERVER_NAME + CSHARP_SUFFIX,
+		TArray<TFunction<void(FString& OutResult)>>{});
+
 	CopyTemplate(
 		FPaths::Combine(FUnrealCSharpFunctionLibrary::GetSourceGeneratorPath(), SOURCE_GENERATOR_NAME + PROJECT_SUFFIX),
 		ScriptPath / SOURCE_GENERATOR_NAME / SOURCE_GENERATOR_NAME + PROJECT_SUFFIX);
@@ -13,13 +13,20 @@
 
 void FStructGenerator::Generator()
 {
+	TArray<const UScriptStruct*> ScriptStructs;
+
 	for (TObjectIterator<UScriptStruct> ScriptStructIterator; ScriptStructIterator; ++ScriptStructIterator)
 	{
 		if (!Cast<UUserDefinedStruct>(*ScriptStructIterator))
 		{
-			Generator(*ScriptStructIterator);
+			ScriptStructs.Add(*ScriptStructIterator);
 		}
 	}
+
+	FGeneratorCore::ParallelGenerator(ScriptStructs, [](const UScriptStruct* InScriptStruct)
+	{
+		Generator(InScriptStruct);
+	});
 }
 
 void FStructGenerator::Generator(const UScriptStruct* InScriptStruct)
@@ -336,5 +343,5 @@ void FStructGenerator::Generator(const UScriptStruct* InScriptStruct)
 	                               *GCHandleContent
 	);
 
-	FUnrealCSharpFunctionLibrary::SaveStringToFile(FGeneratorCore::GetFileName(InScriptStruct), Content);
+	FGeneratorCore::SaveStringToFile(FGeneratorCore::GetFileName(InScriptStruct), Content);
 }
@@ -25,6 +25,8 @@ private:
 
 	static FString GetBlueprintFunctionDefaultParam(const UFunction* InFunction, FProperty* InProperty);
 
+	static FString GetNameFunctionDefaultParam(const UFunction* InFunction, FProperty* InProperty);
+
 	static FString GeneratorFunctionDefaultParam(const UFunction* InFunction, FProperty* InProperty);
 
 	static FString GeneratorCppFunctionDefaultParam(const UFunction* InFunction, FProperty* InProperty);
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include <atomic>
+
 class FGeneratorCore
 {
 public:
@@ -30,6 +32,15 @@ public:
 	template <typename T>
 	static auto GetFileName(const T* InField);
 
+	template <typename T, typename F>
+	static void ParallelGenerator(const TArray<const T*>& InFields, F&& InFunction);
+
+	static bool SaveStringToFile(const FString& InFileName, const FString& InString);
+
+	static SCRIPTCODEGENERATOR_API TMap<FString, uint64> GetGeneratedFileHash();
+
+	static SCRIPTCODEGENERATOR_API int32 GetSavedFileNum();
+
 	static TArray<FString> GetOverrideFunctions(const FString& InNameSpace, const FString& InClass);
 
 	static bool IsSkip(const UField* InField);
@@ -50,10 +61,17 @@ public:
 
 	static SCRIPTCODEGENERATOR_API const TArray<FName>& GetSupportedAssetClassName();
 
-	static SCRIPTCODEGENERATOR_API void BeginGenerator();
+	static SCRIPTCODEGENERATOR_API void BeginGenerator(bool bInIsParallel = true);
 
 	static SCRIPTCODEGENERATOR_API void EndGenerator();
 
+private:
+	static bool FindSupported(const UObject* InObject, bool& OutSupported);
+
+	static void AddSupported(const UObject* InObject, bool bInSupported);
+
+	static EParallelForFlags GetParallelForFlags();
+
 private:
 	static TMap<FString, TArray<FString>> OverrideFunctionsMap;
 
@@ -67,6 +85,16 @@ private:
 
 	static TMap<TWeakObjectPtr<const UObject>, bool> SupportedMap;
 
+	static FRWLock SupportedMapLock;
+
+	static bool bIsParallelGenerator;
+
+	static TMap<FString, uint64> GeneratedFileHash;
+
+	static FCriticalSection GeneratedFileHashCriticalSection;
+
+	static std::atomic<int32> SavedFileNum;
+
 	static TArray<FName> SupportedAssetClassName;
 };
 
@@ -3,6 +3,7 @@
 #include "UEVersion.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
 #include "CoreMacro/Macro.h"
+#include "Async/ParallelFor.h"
 
 template <typename T>
 auto FGeneratorCore::GetFileName(const T* InField)
@@ -41,3 +42,12 @@ auto FGeneratorCore::GetFileName(const T* InField)
 		return FPaths::Combine(DirectoryName, ModuleRelativePath, FileName);
 	}
 }
+
+template <typename T, typename F>
+void FGeneratorCore::ParallelGenerator(const TArray<const T*>& InFields, F&& InFunction)
+{
+	ParallelFor(InFields.Num(), [&InFields, &InFunction](const int32 Index)
+	{
+		InFunction(InFields[Index]);
+	}, GetParallelForFlags());
+}
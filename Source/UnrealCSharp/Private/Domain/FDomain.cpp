@@ -1,5 +1,7 @@
 #include "Domain/FDomain.h"
+#include "Domain/FReleaseQueue.h"
 #include "Log/FMonoLog.h"
+#include "Common/FUnrealCSharpFunctionLibrary.h"
 #include "Template/TGetArrayLength.inl"
 #include "CoreMacro/ClassMacro.h"
 #include "CoreMacro/NamespaceMacro.h"
@@ -7,7 +9,8 @@
 #include "Macro/FunctionMacro.h"
 
 FDomain::FDomain(const FMonoDomainInitializeParams& InParams):
-	SynchronizationContextTick{nullptr}
+	SynchronizationContextTick{nullptr},
+	ReleaseQueueTimeBudget{FUnrealCSharpFunctionLibrary::GetReleaseQueueTimeBudget() / 1000.0}
 {
 	Initialize(InParams);
 }
@@ -22,10 +25,26 @@ void FDomain::Initialize(const FMonoDomainInitializeParams& InParams)
 	FMonoDomain::Initialize(InParams);
 
 	InitializeSynchronizationContext();
+
+	// drained from the core ticker so releases keep flowing in the editor and while the game is paused
+	ReleaseQueueTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateLambda([this](float)
+		{
+			FReleaseQueue::Drain(ReleaseQueueTimeBudget);
+
+			return true;
+		}));
 }
 
 void FDomain::Deinitialize()
 {
+	if (ReleaseQueueTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ReleaseQueueTickerHandle);
+
+		ReleaseQueueTickerHandle.Reset();
+	}
+
 	DeinitializeSynchronizationContext();
 
 	FMonoDomain::Deinitialize();
@@ -461,6 +480,13 @@ MonoGCHandle FDomain::GCHandle_New_V2(MonoObject* InMonoObject, MonoClass* InMon
 {
 	auto GarbageCollectionHandle = FMonoDomain::GCHandle_New_V2(InMonoObject, bPinned);
 
+	if (const auto Offset = FMonoDomain::Class_Get_Garbage_Collection_Handle_Offset(InMonoClass))
+	{
+		*reinterpret_cast<MonoGCHandle*>(reinterpret_cast<uint8*>(InMonoObject) + Offset) = GarbageCollectionHandle;
+
+		return GarbageCollectionHandle;
+	}
+
 	void* InParams[] = {&GarbageCollectionHandle};
 
 	if (const auto FoundProperty = Class_Get_Property_From_Name(InMonoClass, PROPERTY_GARBAGE_COLLECTION_HANDLE))
@@ -481,6 +507,13 @@ MonoGCHandle FDomain::GCHandle_New_WeakRef_V2(MonoObject* InMonoObject, MonoClas
 {
 	auto GarbageCollectionHandle = FMonoDomain::GCHandle_New_WeakRef_V2(InMonoObject, bTrackResurrection);
 
+	if (const auto Offset = FMonoDomain::Class_Get_Garbage_Collection_Handle_Offset(InMonoClass))
+	{
+		*reinterpret_cast<MonoGCHandle*>(reinterpret_cast<uint8*>(InMonoObject) + Offset) = GarbageCollectionHandle;
+
+		return GarbageCollectionHandle;
+	}
+
 	void* InParams[] = {&GarbageCollectionHandle};
 
 	if (const auto FoundProperty = Class_Get_Property_From_Name(InMonoClass, PROPERTY_GARBAGE_COLLECTION_HANDLE))
@@ -0,0 +1,83 @@
+#include "Domain/FReleaseQueue.h"
+
+DECLARE_STATS_GROUP(TEXT("UnrealCSharp"), STATGROUP_UnrealCSharp, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Release Queue Depth"), STAT_ReleaseQueueDepth, STATGROUP_UnrealCSharp);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Release Queue Drained"), STAT_ReleaseQueueDrained, STATGROUP_UnrealCSharp);
+
+DECLARE_CYCLE_STAT(TEXT("Release Queue Drain"), STAT_ReleaseQueueDrain, STATGROUP_UnrealCSharp);
+
+TQueue<FReleaseQueue::FRelease, EQueueMode::Mpsc> FReleaseQueue::Queue;
+
+std::atomic<int32> FReleaseQueue::Depth{0};
+
+double FReleaseQueue::LastDrainTime = 0.0;
+
+int32 FReleaseQueue::LastDrainCount = 0;
+
+void FReleaseQueue::Enqueue(const FGarbageCollectionHandle& InGarbageCollectionHandle,
+                            const FReleaseFunction InFunction)
+{
+	Queue.Enqueue({InGarbageCollectionHandle, InFunction});
+
+	Depth.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FReleaseQueue::Drain(const double InTimeBudget)
+{
+	check(IsInGameThread());
+
+	SCOPE_CYCLE_COUNTER(STAT_ReleaseQueueDrain);
+
+	const auto StartTime = FPlatformTime::Seconds();
+
+	const auto EndTime = InTimeBudget > 0.0 ? StartTime + InTimeBudget : TNumericLimits<double>::Max();
+
+	auto Count = 0;
+
+	FRelease Release;
+
+	while (Queue.Dequeue(Release))
+	{
+		Release.Function(Release.GarbageCollectionHandle);
+
+		++Count;
+
+		// the budget is checked every few releases to keep the clock reads off the hot path
+		if ((Count & 31) == 0 && FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
+	}
+
+	Depth.fetch_sub(Count, std::memory_order_relaxed);
+
+	LastDrainTime = FPlatformTime::Seconds() - StartTime;
+
+	LastDrainCount = Count;
+
+	SET_DWORD_STAT(STAT_ReleaseQueueDepth, Depth.load(std::memory_order_relaxed));
+
+	SET_DWORD_STAT(STAT_ReleaseQueueDrained, Count);
+}
+
+void FReleaseQueue::Flush()
+{
+	Drain(0.0);
+}
+
+int32 FReleaseQueue::GetDepth()
+{
+	return Depth.load(std::memory_order_relaxed);
+}
+
+double FReleaseQueue::GetLastDrainTime()
+{
+	return LastDrainTime;
+}
+
+int32 FReleaseQueue::GetLastDrainCount()
+{
+	return LastDrainCount;
+}
@@ -0,0 +1,170 @@
+#if !UE_BUILD_SHIPPING
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "Environment/FAsyncLoadingObjectSet.h"
+#include "Misc/TextBuffer.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	struct FAsyncLoadingObjectSetPerf
+	{
+		static bool IsAsyncLoading(const UObject* InObject)
+		{
+			return InObject->HasAnyInternalFlags(EInternalObjectFlags::Async);
+		}
+
+		static bool CompareImplementation(const int32 InPackageCount, const int32 InObjectsPerPackage,
+		                                  double* OutArrayMilliseconds, double* OutSetMilliseconds)
+		{
+			if (InPackageCount <= 0 || InObjectsPerPackage <= 0 ||
+				InPackageCount * static_cast<int64>(InObjectsPerPackage) > MAX_int32)
+			{
+				return false;
+			}
+
+			TArray<UPackage*> Packages;
+
+			TArray<UObject*> Objects;
+
+			Packages.Reserve(InPackageCount);
+
+			Objects.Reserve(InPackageCount * InObjectsPerPackage);
+
+			for (auto PackageIndex = 0; PackageIndex < InPackageCount; ++PackageIndex)
+			{
+				const auto Package = NewObject<UPackage>(nullptr,
+				                                         *FString::Printf(
+					                                         TEXT("/Temp/AsyncLoadingObjectSetPerf_%d"),
+					                                         PackageIndex), RF_Transient);
+
+				Packages.Add(Package);
+
+				for (auto ObjectIndex = 0; ObjectIndex < InObjectsPerPackage; ++ObjectIndex)
+				{
+					Objects.Add(NewObject<UTextBuffer>(Package, NAME_None, RF_Transient));
+				}
+			}
+
+			const auto SetStreaming = [&](const int32 InPackageIndex, const bool bInStreaming)
+			{
+				TArray<UObject*, TInlineAllocator<1>> PackageObjects{Packages[InPackageIndex]};
+
+				PackageObjects.Append(Objects.GetData() + InPackageIndex * InObjectsPerPackage, InObjectsPerPackage);
+
+				for (const auto Object : PackageObjects)
+				{
+					if (bInStreaming)
+					{
+						Object->SetInternalFlags(EInternalObjectFlags::Async);
+					}
+					else
+					{
+						Object->ClearInternalFlags(EInternalObjectFlags::Async);
+					}
+				}
+			};
+
+			// one package finishes streaming per flush, every fourth object is destroyed before it finishes
+			auto ArrayBoundNum = 0;
+
+			{
+				for (auto PackageIndex = 0; PackageIndex < InPackageCount; ++PackageIndex)
+				{
+					SetStreaming(PackageIndex, true);
+				}
+
+				TArray<FWeakObjectPtr> Array;
+
+				const auto StartTime = FPlatformTime::Seconds();
+
+				for (const auto Object : Objects)
+				{
+					Array.Add(Object);
+				}
+
+				for (auto PackageIndex = 0; PackageIndex < InPackageCount; ++PackageIndex)
+				{
+					for (auto ObjectIndex = 0; ObjectIndex < InObjectsPerPackage; ObjectIndex += 4)
+					{
+						Array.Remove(Objects[PackageIndex * InObjectsPerPackage + ObjectIndex]);
+					}
+
+					SetStreaming(PackageIndex, false);
+
+					for (auto Index = Array.Num() - 1; Index >= 0; --Index)
+					{
+						if (const auto Object = Array[Index].Get(); Object == nullptr || !IsAsyncLoading(Object))
+						{
+							ArrayBoundNum += Object != nullptr;
+
+							Array.RemoveAt(Index);
+						}
+					}
+				}
+
+				*OutArrayMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			}
+
+			auto SetBoundNum = 0;
+
+			{
+				for (auto PackageIndex = 0; PackageIndex < InPackageCount; ++PackageIndex)
+				{
+					SetStreaming(PackageIndex, true);
+				}
+
+				FAsyncLoadingObjectSet Set;
+
+				TArray<UObject*> FinishedObjects;
+
+				const auto StartTime = FPlatformTime::Seconds();
+
+				for (const auto Object : Objects)
+				{
+					Set.Add(Object, Object->GetUniqueID());
+				}
+
+				for (auto PackageIndex = 0; PackageIndex < InPackageCount; ++PackageIndex)
+				{
+					for (auto ObjectIndex = 0; ObjectIndex < InObjectsPerPackage; ObjectIndex += 4)
+					{
+						Set.Remove(Objects[PackageIndex * InObjectsPerPackage + ObjectIndex]->GetUniqueID());
+					}
+
+					SetStreaming(PackageIndex, false);
+
+					FinishedObjects.Reset();
+
+					Set.Flush(IsAsyncLoading, FinishedObjects);
+
+					SetBoundNum += FinishedObjects.Num();
+				}
+
+				*OutSetMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			}
+
+			for (const auto Object : Objects)
+			{
+				Object->MarkAsGarbage();
+			}
+
+			for (const auto Package : Packages)
+			{
+				Package->MarkAsGarbage();
+			}
+
+			return ArrayBoundNum == SetBoundNum &&
+				SetBoundNum == InPackageCount * (InObjectsPerPackage - (InObjectsPerPackage + 3) / 4);
+		}
+
+		FAsyncLoadingObjectSetPerf()
+		{
+			FClassBuilder(TEXT("FAsyncLoadingObjectSetPerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Compare"), CompareImplementation);
+		}
+	};
+
+	[[maybe_unused]] FAsyncLoadingObjectSetPerf AsyncLoadingObjectSetPerf;
+}
+#endif
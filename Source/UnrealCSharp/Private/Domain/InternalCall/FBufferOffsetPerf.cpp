@@ -0,0 +1,176 @@
+#include "Binding/Class/FClassBuilder.h"
+#include "Binding/Function/TBufferOffset.inl"
+#include "CoreMacro/NamespaceMacro.h"
+
+namespace
+{
+	static_assert(TBufferOffset<>::Value.size() == 0);
+
+	static_assert(TBufferOffset<>::Size == 0);
+
+	static_assert(TBufferOffset<int32>::Value[0] == 0);
+
+	static_assert(TBufferOffset<int32>::Size == 4);
+
+	static_assert(TBufferOffset<bool, double, const int16&, float&>::Value[0] == 0);
+
+	static_assert(TBufferOffset<bool, double, const int16&, float&>::Value[1] == 1);
+
+	static_assert(TBufferOffset<bool, double, const int16&, float&>::Value[2] == 9);
+
+	static_assert(TBufferOffset<bool, double, const int16&, float&>::Value[3] == 11);
+
+	static_assert(TBufferOffset<bool, double, const int16&, float&>::Size == 15);
+
+	constexpr int32 PointerSize = sizeof(void*);
+
+	// compound arguments travel as a garbage collection handle
+	static_assert(TBufferOffset<uint8, FString, const FVector&, int64>::Value[1] == 1);
+
+	static_assert(TBufferOffset<uint8, FString, const FVector&, int64>::Value[2] == 1 + PointerSize);
+
+	static_assert(TBufferOffset<uint8, FString, const FVector&, int64>::Value[3] == 1 + 2 * PointerSize);
+
+	static_assert(TBufferOffset<uint8, FString, const FVector&, int64>::Size == 9 + 2 * PointerSize);
+
+#if !UE_BUILD_SHIPPING
+	struct FBufferOffsetPerf
+	{
+		// the table as it was built before, once per binding call through the type info
+		template <typename... Args0>
+		struct TRuntimeBufferOffset
+		{
+			TRuntimeBufferOffset():
+				Offset(0)
+			{
+				Get<0, Args0...>();
+			}
+
+			template <auto Index>
+			static auto Get()
+			{
+			}
+
+			template <auto Index, typename T, typename... Args1>
+			auto Get()
+			{
+				Value[Index] = Offset;
+
+				Offset += TTypeInfo<std::decay_t<T>>::Get()->GetBufferSize();
+
+				Get<Index + 1, Args1...>();
+			}
+
+			int32 Offset;
+
+			int32 Value[sizeof...(Args0) > 0 ? sizeof...(Args0) : 1];
+		};
+
+		template <typename T>
+		static double Read(const uint8* InBuffer)
+		{
+			return static_cast<double>(*reinterpret_cast<const T*>(InBuffer));
+		}
+
+		template <typename... Args, auto... Index>
+		static double CallRuntime(const uint8* InBuffer, std::index_sequence<Index...>)
+		{
+			const TRuntimeBufferOffset<Args...> Offsets;
+
+			return (0.0 + ... + Read<std::decay_t<Args>>(InBuffer + Offsets.Value[Index]));
+		}
+
+		template <typename... Args, auto... Index>
+		static double CallConstexpr(const uint8* InBuffer, std::index_sequence<Index...>)
+		{
+			return (0.0 + ... + Read<std::decay_t<Args>>(
+				InBuffer + std::get<Index>(TBufferOffset<Args...>::Value)));
+		}
+
+		template <typename... Args>
+		static bool Run(const int32 InIterations, double* OutRuntimeNanoseconds, double* OutConstexprNanoseconds)
+		{
+			uint8 Buffer[64] = {};
+
+			double RuntimeSum = 0.0;
+
+			{
+				const auto StartTime = FPlatformTime::Seconds();
+
+				for (auto Iteration = 0; Iteration < InIterations; ++Iteration)
+				{
+					Buffer[0] = static_cast<uint8>(Iteration);
+
+					RuntimeSum += CallRuntime<Args...>(Buffer, std::index_sequence_for<Args...>());
+				}
+
+				*OutRuntimeNanoseconds = (FPlatformTime::Seconds() - StartTime) * 1000000000.0 / InIterations;
+			}
+
+			double ConstexprSum = 0.0;
+
+			{
+				const auto StartTime = FPlatformTime::Seconds();
+
+				for (auto Iteration = 0; Iteration < InIterations; ++Iteration)
+				{
+					Buffer[0] = static_cast<uint8>(Iteration);
+
+					ConstexprSum += CallConstexpr<Args...>(Buffer, std::index_sequence_for<Args...>());
+				}
+
+				*OutConstexprNanoseconds = (FPlatformTime::Seconds() - StartTime) * 1000000000.0 / InIterations;
+			}
+
+			return RuntimeSum == ConstexprSum;
+		}
+
+		static bool CompareImplementation(const int32 InArgumentCount, const int32 InIterations,
+		                                  double* OutRuntimeNanoseconds, double* OutConstexprNanoseconds)
+		{
+			if (InIterations <= 0)
+			{
+				return false;
+			}
+
+			switch (InArgumentCount)
+			{
+			case 0:
+				return Run<>(InIterations, OutRuntimeNanoseconds, OutConstexprNanoseconds);
+			case 1:
+				return Run<uint8>(InIterations, OutRuntimeNanoseconds, OutConstexprNanoseconds);
+			case 2:
+				return Run<uint8, double>(InIterations, OutRuntimeNanoseconds, OutConstexprNanoseconds);
+			case 3:
+				return Run<uint8, double, const float&>(InIterations, OutRuntimeNanoseconds,
+				                                        OutConstexprNanoseconds);
+			case 4:
+				return Run<uint8, double, const float&, bool>(InIterations, OutRuntimeNanoseconds,
+				                                              OutConstexprNanoseconds);
+			case 5:
+				return Run<uint8, double, const float&, bool, int64>(InIterations, OutRuntimeNanoseconds,
+				                                                     OutConstexprNanoseconds);
+			case 6:
+				return Run<uint8, double, const float&, bool, int64, int16&>(InIterations, OutRuntimeNanoseconds,
+				                                                             OutConstexprNanoseconds);
+			case 7:
+				return Run<uint8, double, const float&, bool, int64, int16&, int32>(
+					InIterations, OutRuntimeNanoseconds, OutConstexprNanoseconds);
+			case 8:
+				return Run<uint8, double, const float&, bool, int64, int16&, int32, uint32>(
+					InIterations, OutRuntimeNanoseconds, OutConstexprNanoseconds);
+			default:
+				return false;
+			}
+		}
+
+		FBufferOffsetPerf()
+		{
+			FClassBuilder(TEXT("FBufferOffsetPerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Compare"), CompareImplementation);
+		}
+	};
+
+	[[maybe_unused]] FBufferOffsetPerf BufferOffsetPerf;
+#endif
+}
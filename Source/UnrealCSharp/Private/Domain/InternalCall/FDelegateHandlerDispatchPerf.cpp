@@ -0,0 +1,61 @@
+#if !UE_BUILD_SHIPPING
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "Macro/FunctionMacro.h"
+#include "Reflection/Delegate/MulticastDelegateHandler.h"
+
+namespace
+{
+	struct FDelegateHandlerDispatchPerf
+	{
+		/**
+		 * Checks that the cached callback is the UFunction found by name,
+		 * then times ProcessEvent on a handler without listeners where the callback check is all that runs.
+		 */
+		static bool DispatchImplementation(const int32 InIterations, double* OutDispatchNanoseconds)
+		{
+			if (InIterations <= 0)
+			{
+				return false;
+			}
+
+			const auto Handler = NewObject<UMulticastDelegateHandler>();
+
+			Handler->AddToRoot();
+
+			Handler->Initialize(nullptr, Handler->GetCallBack());
+
+			const auto CallBack = Handler->GetCallBack();
+
+			const auto bCallBackMatches = CallBack != nullptr &&
+				CallBack == Handler->FindFunction(*FUNCTION_CSHARP_CALLBACK);
+
+			if (bCallBackMatches)
+			{
+				const auto StartTime = FPlatformTime::Seconds();
+
+				for (auto Iteration = 0; Iteration < InIterations; ++Iteration)
+				{
+					Handler->ProcessEvent(CallBack, nullptr);
+				}
+
+				*OutDispatchNanoseconds = (FPlatformTime::Seconds() - StartTime) * 1000000000.0 / InIterations;
+			}
+
+			Handler->Deinitialize();
+
+			Handler->RemoveFromRoot();
+
+			return bCallBackMatches;
+		}
+
+		FDelegateHandlerDispatchPerf()
+		{
+			FClassBuilder(TEXT("FDelegateHandlerDispatchPerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Dispatch"), DispatchImplementation);
+		}
+	};
+
+	[[maybe_unused]] FDelegateHandlerDispatchPerf DelegateHandlerDispatchPerf;
+}
+#endif
@@ -0,0 +1,230 @@
+#if !UE_BUILD_SHIPPING
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "Reflection/Delegate/FDelegateWrapperList.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+	struct FDelegateWrapperListPerf
+	{
+		// the array baseline is quadratic, above this only the list is timed
+		static constexpr auto MaxArraySubscriberCount = 1000;
+
+		// never called, the list only hashes and compares them
+		static MonoMethod* MakeMethod(const int32 InId)
+		{
+			return reinterpret_cast<MonoMethod*>(static_cast<UPTRINT>(InId));
+		}
+
+		static int32 GetId(const FDelegateWrapper& InDelegateWrapper)
+		{
+			return static_cast<int32>(reinterpret_cast<UPTRINT>(InDelegateWrapper.Method));
+		}
+
+		static TArray<int32> Collect(FDelegateWrapperList& InDelegateWrappers)
+		{
+			TArray<int32> Ids;
+
+			InDelegateWrappers.Broadcast([&Ids](const FDelegateWrapper& InDelegateWrapper)
+			{
+				Ids.Add(GetId(InDelegateWrapper));
+			});
+
+			return Ids;
+		}
+
+		static bool CheckOrdering(const TArray<UObject*>& InObjects, const int32 InSubscriberCount)
+		{
+			FDelegateWrapperList DelegateWrappers;
+
+			for (auto Id = 1; Id <= InSubscriberCount; ++Id)
+			{
+				DelegateWrappers.AddUnique({InObjects[Id % InObjects.Num()], MakeMethod(Id)});
+			}
+
+			DelegateWrappers.AddUnique({InObjects[1], MakeMethod(1)});
+
+			auto Ids = Collect(DelegateWrappers);
+
+			if (Ids.Num() != InSubscriberCount)
+			{
+				return false;
+			}
+
+			for (auto Index = 0; Index < Ids.Num(); ++Index)
+			{
+				if (Ids[Index] != Index + 1)
+				{
+					return false;
+				}
+			}
+
+			for (auto Id = 3; Id <= InSubscriberCount; Id += 3)
+			{
+				DelegateWrappers.Remove({InObjects[Id % InObjects.Num()], MakeMethod(Id)});
+			}
+
+			DelegateWrappers.RemoveAll(InObjects[0]);
+
+			Ids = Collect(DelegateWrappers);
+
+			if (Ids.Num() != DelegateWrappers.Num())
+			{
+				return false;
+			}
+
+			for (auto Index = 0; Index < Ids.Num(); ++Index)
+			{
+				if (Ids[Index] % 3 == 0 || Ids[Index] % InObjects.Num() == 0 ||
+					(Index > 0 && Ids[Index - 1] >= Ids[Index]))
+				{
+					return false;
+				}
+			}
+
+			return !DelegateWrappers.Contains({InObjects[3 % InObjects.Num()], MakeMethod(3)}) &&
+				DelegateWrappers.Contains({InObjects[1], MakeMethod(1)});
+		}
+
+		static bool CheckReentrancy(const TArray<UObject*>& InObjects)
+		{
+			FDelegateWrapperList DelegateWrappers;
+
+			for (auto Id = 1; Id <= 8; ++Id)
+			{
+				DelegateWrappers.Add({InObjects[0], MakeMethod(Id)});
+			}
+
+			TArray<int32> Ids;
+
+			TArray<int32> NestedIds;
+
+			DelegateWrappers.Broadcast([&](const FDelegateWrapper& InDelegateWrapper)
+			{
+				Ids.Add(GetId(InDelegateWrapper));
+
+				if (GetId(InDelegateWrapper) == 2)
+				{
+					// the one already called, the current one and the next one
+					DelegateWrappers.Remove({InObjects[0], MakeMethod(1)});
+
+					DelegateWrappers.Remove(InDelegateWrapper);
+
+					DelegateWrappers.Remove({InObjects[0], MakeMethod(3)});
+
+					DelegateWrappers.Add({InObjects[1], MakeMethod(100)});
+
+					NestedIds = Collect(DelegateWrappers);
+				}
+			});
+
+			const TArray<int32> ExpectedIds = {1, 2, 4, 5, 6, 7, 8};
+
+			const TArray<int32> ExpectedNextIds = {4, 5, 6, 7, 8, 100};
+
+			return Ids == ExpectedIds && NestedIds == ExpectedNextIds && Collect(DelegateWrappers) == ExpectedNextIds;
+		}
+
+		static bool RunImplementation(const int32 InSubscriberCount, double* OutArrayMilliseconds,
+		                              double* OutListMilliseconds)
+		{
+			if (InSubscriberCount <= 0)
+			{
+				return false;
+			}
+
+			TArray<UObject*> Objects;
+
+			for (TObjectIterator<UClass> It; It && Objects.Num() < 100; ++It)
+			{
+				Objects.Add(*It);
+			}
+
+			if (Objects.Num() < 2 || !CheckOrdering(Objects, InSubscriberCount) || !CheckReentrancy(Objects))
+			{
+				return false;
+			}
+
+			// subscribe everyone uniquely, then unsubscribe in a different order and finish with RemoveAll
+			const auto Stride = 7919;
+
+			*OutArrayMilliseconds = -1.0;
+
+			if (InSubscriberCount <= MaxArraySubscriberCount)
+			{
+				TArray<FDelegateWrapper> DelegateWrappers;
+
+				const auto StartTime = FPlatformTime::Seconds();
+
+				for (auto Id = 1; Id <= InSubscriberCount; ++Id)
+				{
+					DelegateWrappers.AddUnique({Objects[Id % Objects.Num()], MakeMethod(Id)});
+				}
+
+				for (auto Index = 0; Index < InSubscriberCount / 2; ++Index)
+				{
+					const auto Id = static_cast<int32>(static_cast<int64>(Index) * Stride % InSubscriberCount) + 1;
+
+					DelegateWrappers.Remove({Objects[Id % Objects.Num()], MakeMethod(Id)});
+				}
+
+				for (const auto Object : Objects)
+				{
+					DelegateWrappers.RemoveAll([Object](const FDelegateWrapper& Element)
+					{
+						return Element.Object == Object;
+					});
+				}
+
+				*OutArrayMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+				if (!DelegateWrappers.IsEmpty())
+				{
+					return false;
+				}
+			}
+
+			{
+				FDelegateWrapperList DelegateWrappers;
+
+				const auto StartTime = FPlatformTime::Seconds();
+
+				for (auto Id = 1; Id <= InSubscriberCount; ++Id)
+				{
+					DelegateWrappers.AddUnique({Objects[Id % Objects.Num()], MakeMethod(Id)});
+				}
+
+				for (auto Index = 0; Index < InSubscriberCount / 2; ++Index)
+				{
+					const auto Id = static_cast<int32>(static_cast<int64>(Index) * Stride % InSubscriberCount) + 1;
+
+					DelegateWrappers.Remove({Objects[Id % Objects.Num()], MakeMethod(Id)});
+				}
+
+				for (const auto Object : Objects)
+				{
+					DelegateWrappers.RemoveAll(Object);
+				}
+
+				*OutListMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+				if (!DelegateWrappers.IsEmpty())
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		FDelegateWrapperListPerf()
+		{
+			FClassBuilder(TEXT("FDelegateWrapperListPerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Run"), RunImplementation);
+		}
+	};
+
+	[[maybe_unused]] FDelegateWrapperListPerf DelegateWrapperListPerf;
+}
+#endif
@@ -0,0 +1,256 @@
+#include "FEcsChunkStore.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	constexpr int32 ColumnAlignment = 16;
+
+	constexpr int32 ChunkAlignment = 64;
+
+	int32 Layout(const TArray<int32>& InComponentSizes, const int32 InCapacity, TArray<int32>& OutColumnOffsets)
+	{
+		OutColumnOffsets.Reset();
+
+		int32 Offset = 0;
+		for (const int32 ComponentSize : InComponentSizes)
+		{
+			Offset = Align(Offset, ColumnAlignment);
+
+			OutColumnOffsets.Add(Offset);
+
+			Offset += ComponentSize * InCapacity;
+		}
+
+		Offset = Align(Offset, ColumnAlignment);
+
+		OutColumnOffsets.Add(Offset);
+
+		return Offset + static_cast<int32>(sizeof(int32)) * InCapacity;
+	}
+}
+
+FEcsChunkStore::FEcsChunkStore(const TConstArrayView<int32> InComponentSizes, const int32 InChunkBytes):
+	ChunkBytes(InChunkBytes),
+	ChunkCapacity(0),
+	ComponentSizes(InComponentSizes),
+	NumEntities(0)
+{
+	int32 RowBytes = sizeof(int32);
+	for (const int32 ComponentSize : ComponentSizes)
+	{
+		check(ComponentSize > 0);
+
+		RowBytes += ComponentSize;
+	}
+
+	ChunkCapacity = FMath::Max(1, ChunkBytes / RowBytes);
+
+	while (ChunkCapacity > 1 && Layout(ComponentSizes, ChunkCapacity, ColumnOffsets) > ChunkBytes)
+	{
+		--ChunkCapacity;
+	}
+
+	// a single row that does not fit gets a chunk of its own size
+	ChunkBytes = FMath::Max(ChunkBytes, Layout(ComponentSizes, ChunkCapacity, ColumnOffsets));
+}
+
+FEcsChunkStore::~FEcsChunkStore()
+{
+	for (const FChunk& Chunk : Chunks)
+	{
+		FMemory::Free(Chunk.Data);
+	}
+}
+
+uint64 FEcsChunkStore::Add()
+{
+	if (Chunks.IsEmpty() || Chunks.Last().Length == ChunkCapacity)
+	{
+		Chunks.Add({static_cast<uint8*>(FMemory::Malloc(ChunkBytes, ChunkAlignment)), 0});
+	}
+
+	const int32 ChunkIndex = Chunks.Num() - 1;
+
+	FChunk& Chunk = Chunks[ChunkIndex];
+
+	const int32 Row = Chunk.Length++;
+
+	for (int32 Component = 0; Component < ComponentSizes.Num(); ++Component)
+	{
+		FMemory::Memzero(Chunk.Data + ColumnOffsets[Component] + Row * ComponentSizes[Component],
+		                 ComponentSizes[Component]);
+	}
+
+	int32 Index;
+	if (!FreeEntities.IsEmpty())
+	{
+		Index = FreeEntities.Pop();
+	}
+	else
+	{
+		Index = Entities.Add({1, INDEX_NONE, INDEX_NONE});
+	}
+
+	FEntity& Entity = Entities[Index];
+
+	Entity.Chunk = ChunkIndex;
+	Entity.Row = Row;
+
+	GetEntityColumn(Chunk)[Row] = Index;
+
+	++NumEntities;
+
+	return MakeHandle(Index, Entity.Generation);
+}
+
+bool FEcsChunkStore::Remove(const uint64 InHandle)
+{
+	if (FindEntity(InHandle) == nullptr)
+	{
+		return false;
+	}
+
+	const int32 Index = static_cast<int32>(InHandle & 0xFFFFFFFF);
+
+	FEntity& Entity = Entities[Index];
+
+	FChunk& Target = Chunks[Entity.Chunk];
+
+	const int32 LastChunkIndex = Chunks.Num() - 1;
+
+	FChunk& Last = Chunks[LastChunkIndex];
+
+	const int32 LastRow = Last.Length - 1;
+
+	// swap back, the last entity of the last chunk fills the hole
+	if (Entity.Chunk != LastChunkIndex || Entity.Row != LastRow)
+	{
+		for (int32 Component = 0; Component < ComponentSizes.Num(); ++Component)
+		{
+			const int32 ComponentSize = ComponentSizes[Component];
+
+			FMemory::Memcpy(Target.Data + ColumnOffsets[Component] + Entity.Row * ComponentSize,
+			                Last.Data + ColumnOffsets[Component] + LastRow * ComponentSize,
+			                ComponentSize);
+		}
+
+		const int32 MovedIndex = GetEntityColumn(Last)[LastRow];
+
+		GetEntityColumn(Target)[Entity.Row] = MovedIndex;
+
+		Entities[MovedIndex].Chunk = Entity.Chunk;
+		Entities[MovedIndex].Row = Entity.Row;
+	}
+
+	if (--Last.Length == 0)
+	{
+		FMemory::Free(Last.Data);
+
+		Chunks.Pop();
+	}
+
+	Entity.Generation = Entity.Generation == MAX_int32 ? 1 : Entity.Generation + 1;
+	Entity.Chunk = INDEX_NONE;
+	Entity.Row = INDEX_NONE;
+
+	FreeEntities.Push(Index);
+
+	--NumEntities;
+
+	return true;
+}
+
+bool FEcsChunkStore::IsValid(const uint64 InHandle) const
+{
+	return FindEntity(InHandle) != nullptr;
+}
+
+void* FEcsChunkStore::GetComponent(const uint64 InHandle, const int32 InComponent) const
+{
+	if (!ComponentSizes.IsValidIndex(InComponent))
+	{
+		return nullptr;
+	}
+
+	const FEntity* Entity = FindEntity(InHandle);
+	if (Entity == nullptr)
+	{
+		return nullptr;
+	}
+
+	return Chunks[Entity->Chunk].Data + ColumnOffsets[InComponent] + Entity->Row * ComponentSizes[InComponent];
+}
+
+int32 FEcsChunkStore::Num() const
+{
+	return NumEntities;
+}
+
+int32 FEcsChunkStore::GetNumComponents() const
+{
+	return ComponentSizes.Num();
+}
+
+int32 FEcsChunkStore::GetComponentSize(const int32 InComponent) const
+{
+	return ComponentSizes.IsValidIndex(InComponent) ? ComponentSizes[InComponent] : 0;
+}
+
+int32 FEcsChunkStore::GetChunkCapacity() const
+{
+	return ChunkCapacity;
+}
+
+int32 FEcsChunkStore::GetNumChunks() const
+{
+	return Chunks.Num();
+}
+
+int32 FEcsChunkStore::GetChunkLength(const int32 InChunk) const
+{
+	return Chunks.IsValidIndex(InChunk) ? Chunks[InChunk].Length : 0;
+}
+
+void* FEcsChunkStore::GetColumn(const int32 InChunk, const int32 InComponent) const
+{
+	if (!Chunks.IsValidIndex(InChunk) || !ComponentSizes.IsValidIndex(InComponent))
+	{
+		return nullptr;
+	}
+
+	return Chunks[InChunk].Data + ColumnOffsets[InComponent];
+}
+
+void FEcsChunkStore::ParallelForEachChunk(const TFunctionRef<void(int32 InChunk)> InFunction) const
+{
+	ParallelFor(Chunks.Num(), [&InFunction](const int32 InChunk)
+	{
+		InFunction(InChunk);
+	});
+}
+
+uint64 FEcsChunkStore::MakeHandle(const int32 InIndex, const int32 InGeneration)
+{
+	return static_cast<uint64>(static_cast<uint32>(InGeneration)) << 32 | static_cast<uint32>(InIndex);
+}
+
+const FEcsChunkStore::FEntity* FEcsChunkStore::FindEntity(const uint64 InHandle) const
+{
+	const int32 Index = static_cast<int32>(InHandle & 0xFFFFFFFF);
+
+	const int32 Generation = static_cast<int32>(InHandle >> 32);
+
+	if (!Entities.IsValidIndex(Index))
+	{
+		return nullptr;
+	}
+
+	const FEntity& Entity = Entities[Index];
+
+	return Entity.Generation == Generation && Entity.Chunk != INDEX_NONE ? &Entity : nullptr;
+}
+
+int32* FEcsChunkStore::GetEntityColumn(const FChunk& InChunk) const
+{
+	return reinterpret_cast<int32*>(InChunk.Data + ColumnOffsets.Last());
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Entities of one archetype stored as SoA component columns inside fixed-size chunks.
+ * Handles stay valid until the entity is removed, removal swaps the last entity into the hole so chunks stay dense.
+ * Structural changes are not thread safe, chunks may be iterated from any number of threads in between.
+ */
+class FEcsChunkStore
+{
+public:
+	static constexpr int32 DefaultChunkBytes = 16 * 1024;
+
+	static constexpr uint64 InvalidHandle = 0;
+
+public:
+	explicit FEcsChunkStore(TConstArrayView<int32> InComponentSizes, int32 InChunkBytes = DefaultChunkBytes);
+
+	~FEcsChunkStore();
+
+	FEcsChunkStore(const FEcsChunkStore&) = delete;
+
+	FEcsChunkStore& operator=(const FEcsChunkStore&) = delete;
+
+public:
+	/**
+	 * Adds an entity with zeroed components.
+	 */
+	uint64 Add();
+
+	bool Remove(uint64 InHandle);
+
+	bool IsValid(uint64 InHandle) const;
+
+	void* GetComponent(uint64 InHandle, int32 InComponent) const;
+
+	int32 Num() const;
+
+	int32 GetNumComponents() const;
+
+	/**
+	 * Returns 0 for an unknown component.
+	 */
+	int32 GetComponentSize(int32 InComponent) const;
+
+	int32 GetChunkCapacity() const;
+
+	int32 GetNumChunks() const;
+
+	int32 GetChunkLength(int32 InChunk) const;
+
+	void* GetColumn(int32 InChunk, int32 InComponent) const;
+
+	/**
+	 * Runs InFunction once per chunk on the task graph and returns when every chunk is done.
+	 */
+	void ParallelForEachChunk(TFunctionRef<void(int32 InChunk)> InFunction) const;
+
+private:
+	struct FEntity
+	{
+		int32 Generation;
+
+		int32 Chunk;
+
+		int32 Row;
+	};
+
+	struct FChunk
+	{
+		uint8* Data;
+
+		int32 Length;
+	};
+
+	static uint64 MakeHandle(int32 InIndex, int32 InGeneration);
+
+	const FEntity* FindEntity(uint64 InHandle) const;
+
+	int32* GetEntityColumn(const FChunk& InChunk) const;
+
+private:
+	int32 ChunkBytes;
+
+	int32 ChunkCapacity;
+
+	TArray<int32> ComponentSizes;
+
+	// byte offset of every column inside a chunk, the entity index column comes last
+	TArray<int32> ColumnOffsets;
+
+	TArray<FChunk> Chunks;
+
+	TArray<FEntity> Entities;
+
+	TArray<int32> FreeEntities;
+
+	int32 NumEntities;
+};
@@ -0,0 +1,122 @@
+#if !UE_BUILD_SHIPPING
+#include "Async/ParallelFor.h"
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "GameFramework/Actor.h"
+#include "Reflection/Function/FFunctionParamBufferAllocator.h"
+
+namespace
+{
+	struct FFunctionParamBufferAllocatorPerf
+	{
+		static constexpr int32 Depth = 3;
+
+		// nested calls like a UFunction whose implementation calls back into script, each level checks its buffer
+		static bool Nest(FFunctionParamBufferAllocator& InAllocator, const int32 InParamSize, const uint64 InTag,
+		                 const int32 InDepth)
+		{
+			if (InDepth == 0)
+			{
+				return true;
+			}
+
+			const auto Buffer = static_cast<uint8*>(InAllocator.Malloc());
+
+			const auto Tag = InTag + InDepth;
+
+			FMemory::Memcpy(Buffer, &Tag, sizeof(Tag));
+
+			FMemory::Memcpy(Buffer + InParamSize - sizeof(Tag), &Tag, sizeof(Tag));
+
+			auto bIntact = Nest(InAllocator, InParamSize, InTag, InDepth - 1);
+
+			uint64 Head;
+
+			uint64 Tail;
+
+			FMemory::Memcpy(&Head, Buffer, sizeof(Head));
+
+			FMemory::Memcpy(&Tail, Buffer + InParamSize - sizeof(Tail), sizeof(Tail));
+
+			bIntact &= Head == Tag && Tail == Tag;
+
+			InAllocator.Free(Buffer);
+
+			return bIntact;
+		}
+
+		static bool Stress(FFunctionParamBufferAllocator& InAllocator, const int32 InParamSize,
+		                   const int32 InThreadCount, const int32 InIterations, const int32 InGameThreadDepth)
+		{
+			TAtomic<bool> bIntact{true};
+
+			ParallelFor(InThreadCount, [&](const int32 InThread)
+			{
+				for (auto Iteration = 0; Iteration < InIterations; ++Iteration)
+				{
+					const auto Tag = static_cast<uint64>(InThread) << 48 | static_cast<uint64>(Iteration) << 8;
+
+					if (!Nest(InAllocator, InParamSize, Tag, IsInGameThread() ? InGameThreadDepth : Depth))
+					{
+						bIntact = false;
+					}
+				}
+			});
+
+			return bIntact;
+		}
+
+		static bool StressImplementation(const int32 InThreadCount, const int32 InIterations,
+		                                 double* OutPoolMilliseconds, double* OutPersistentMilliseconds)
+		{
+			if (InThreadCount <= 0 || InIterations <= 0)
+			{
+				return false;
+			}
+
+			const TWeakObjectPtr<UFunction> Function = AActor::StaticClass()->FindFunctionByName(
+				TEXT("K2_SetActorLocation"));
+
+			if (!Function.IsValid() || Function->ParmsSize < static_cast<int32>(sizeof(uint64)))
+			{
+				return false;
+			}
+
+			const int32 ParamSize = Function->ParmsSize;
+
+			auto bIntact = true;
+
+			{
+				FFunctionParamPoolBufferAllocator Allocator(Function);
+
+				const auto StartTime = FPlatformTime::Seconds();
+
+				bIntact &= Stress(Allocator, ParamSize, InThreadCount, InIterations, Depth);
+
+				*OutPoolMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			}
+
+			{
+				FFunctionParamPersistentBufferAllocator Allocator(Function);
+
+				const auto StartTime = FPlatformTime::Seconds();
+
+				// the game thread owns a single persistent buffer, keep it to one level there
+				bIntact &= Stress(Allocator, ParamSize, InThreadCount, InIterations, 1);
+
+				*OutPersistentMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			}
+
+			return bIntact;
+		}
+
+		FFunctionParamBufferAllocatorPerf()
+		{
+			FClassBuilder(TEXT("FFunctionParamBufferAllocatorPerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Stress"), StressImplementation);
+		}
+	};
+
+	[[maybe_unused]] FFunctionParamBufferAllocatorPerf FunctionParamBufferAllocatorPerf;
+}
+#endif
@@ -0,0 +1,56 @@
+#if !UE_BUILD_SHIPPING
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "CoreMacro/PropertyMacro.h"
+#include "GarbageCollection/FGarbageCollectionHandle.h"
+
+namespace
+{
+	struct FGarbageCollectionHandlePerf
+	{
+		static int64 ResolveByPropertyImplementation(MonoObject* InMonoObject, const int32 InIterations)
+		{
+			int64 Sum = 0;
+
+			for (auto Index = 0; Index < InIterations; ++Index)
+			{
+				const auto FoundProperty = FMonoDomain::Class_Get_Property_From_Name(
+					FMonoDomain::Object_Get_Class(InMonoObject), PROPERTY_GARBAGE_COLLECTION_HANDLE);
+
+				if (const auto GarbageCollectionHandle = FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(
+					InMonoObject, FoundProperty))
+				{
+					Sum += reinterpret_cast<int64>(*GarbageCollectionHandle);
+				}
+			}
+
+			return Sum;
+		}
+
+		static int64 ResolveByFieldImplementation(MonoObject* InMonoObject, const int32 InIterations)
+		{
+			int64 Sum = 0;
+
+			for (auto Index = 0; Index < InIterations; ++Index)
+			{
+				if (const auto GarbageCollectionHandle = FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(
+					InMonoObject))
+				{
+					Sum += reinterpret_cast<int64>(*GarbageCollectionHandle);
+				}
+			}
+
+			return Sum;
+		}
+
+		FGarbageCollectionHandlePerf()
+		{
+			FClassBuilder(TEXT("FGarbageCollectionHandlePerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("ResolveByProperty"), ResolveByPropertyImplementation)
+				.Function(TEXT("ResolveByField"), ResolveByFieldImplementation);
+		}
+	};
+
+	[[maybe_unused]] FGarbageCollectionHandlePerf GarbageCollectionHandlePerf;
+}
+#endif
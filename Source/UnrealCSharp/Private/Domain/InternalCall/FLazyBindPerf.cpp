@@ -0,0 +1,96 @@
+#if !UE_BUILD_SHIPPING
+#include "Binding/Class/FClassBuilder.h"
+#include "Environment/FCSharpEnvironment.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+namespace
+{
+	struct FLazyBindPerf
+	{
+		static bool SpawnImplementation(const FGarbageCollectionHandle WorldContextObject,
+		                                const FGarbageCollectionHandle Class, const int32 InActorCount,
+		                                const bool bInEnableLazyBind, double* OutMilliseconds,
+		                                int32* OutBoundNum)
+		{
+			if (InActorCount <= 0)
+			{
+				return false;
+			}
+
+			const auto World = GEngine->GetWorldFromContextObject(
+				FCSharpEnvironment::GetEnvironment().GetObject(WorldContextObject),
+				EGetWorldErrorMode::LogAndReturnNull);
+
+			const auto ActorClass = FCSharpEnvironment::GetEnvironment().GetObject<UClass>(Class);
+
+			if (World == nullptr || ActorClass == nullptr || !ActorClass->IsChildOf(AActor::StaticClass()))
+			{
+				return false;
+			}
+
+			const auto bEnableLazyBind = FCSharpEnvironment::GetEnvironment().IsEnableLazyBind();
+
+			// switched for the spawn loop only, so one session can compare both modes
+			FCSharpEnvironment::GetEnvironment().SetEnableLazyBind(bInEnableLazyBind);
+
+			FActorSpawnParameters SpawnParameters;
+
+			SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			SpawnedActors.Reserve(SpawnedActors.Num() + InActorCount);
+
+			const auto StartTime = FPlatformTime::Seconds();
+
+			for (auto Index = 0; Index < InActorCount; ++Index)
+			{
+				SpawnedActors.Add(World->SpawnActor(ActorClass, &FTransform::Identity, SpawnParameters));
+			}
+
+			*OutMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			FCSharpEnvironment::GetEnvironment().SetEnableLazyBind(bEnableLazyBind);
+
+			*OutBoundNum = 0;
+
+			for (const auto& SpawnedActor : SpawnedActors)
+			{
+				if (SpawnedActor.IsValid() && FCSharpEnvironment::GetEnvironment().GetObject(SpawnedActor.Get()))
+				{
+					++*OutBoundNum;
+				}
+			}
+
+			return true;
+		}
+
+		static void DestroyImplementation()
+		{
+			for (const auto& SpawnedActor : SpawnedActors)
+			{
+				if (SpawnedActor.IsValid())
+				{
+					SpawnedActor->Destroy();
+				}
+			}
+
+			SpawnedActors.Empty();
+		}
+
+		FLazyBindPerf()
+		{
+			FClassBuilder(TEXT("FLazyBindPerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Spawn"), SpawnImplementation)
+				.Function(TEXT("Destroy"), DestroyImplementation);
+		}
+
+		static TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+	};
+
+	TArray<TWeakObjectPtr<AActor>> FLazyBindPerf::SpawnedActors;
+
+	[[maybe_unused]] FLazyBindPerf LazyBindPerf;
+}
+#endif
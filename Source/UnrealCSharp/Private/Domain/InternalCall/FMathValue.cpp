@@ -0,0 +1,85 @@
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+
+namespace
+{
+	struct FMathValue
+	{
+		template <typename T>
+		static int32 SizeOfImplementation()
+		{
+			return sizeof(T);
+		}
+
+		static void MakeTransformImplementation(const FQuat* InRotation, const FVector* InTranslation,
+		                                        const FVector* InScale3D, FTransform* OutValue)
+		{
+			*OutValue = FTransform(*InRotation, *InTranslation, *InScale3D);
+		}
+
+		static void VectorGetSafeNormalImplementation(const FVector* InVector, FVector* OutValue)
+		{
+			*OutValue = InVector->GetSafeNormal();
+		}
+
+		static void RotatorQuaternionImplementation(const FRotator* InRotator, FQuat* OutValue)
+		{
+			*OutValue = InRotator->Quaternion();
+		}
+
+		static void RotatorNormalizeImplementation(const FRotator* InRotator, FRotator* OutValue)
+		{
+			*OutValue = InRotator->GetNormalized();
+		}
+
+		static void QuatMultipliesImplementation(const FQuat* InA, const FQuat* InB, FQuat* OutValue)
+		{
+			*OutValue = *InA * *InB;
+		}
+
+		static void QuatRotateVectorImplementation(const FQuat* InQuat, const FVector* InVector, FVector* OutValue)
+		{
+			*OutValue = InQuat->RotateVector(*InVector);
+		}
+
+		static void TransformPositionImplementation(const FTransform* InTransform, const FVector* InVector,
+		                                            FVector* OutValue)
+		{
+			*OutValue = InTransform->TransformPosition(*InVector);
+		}
+
+		static void InverseTransformPositionImplementation(const FTransform* InTransform, const FVector* InVector,
+		                                                   FVector* OutValue)
+		{
+			*OutValue = InTransform->InverseTransformPosition(*InVector);
+		}
+
+		static void LinearColorLerpImplementation(const FLinearColor* InA, const FLinearColor* InB,
+		                                          const float InAlpha, FLinearColor* OutValue)
+		{
+			*OutValue = FMath::Lerp(*InA, *InB, InAlpha);
+		}
+
+		FMathValue()
+		{
+			FClassBuilder(TEXT("FMathValue"), NAMESPACE_LIBRARY)
+				.Function(TEXT("SizeOfVector"), SizeOfImplementation<FVector>)
+				.Function(TEXT("SizeOfVector2D"), SizeOfImplementation<FVector2D>)
+				.Function(TEXT("SizeOfRotator"), SizeOfImplementation<FRotator>)
+				.Function(TEXT("SizeOfQuat"), SizeOfImplementation<FQuat>)
+				.Function(TEXT("SizeOfTransform"), SizeOfImplementation<FTransform>)
+				.Function(TEXT("SizeOfLinearColor"), SizeOfImplementation<FLinearColor>)
+				.Function(TEXT("MakeTransform"), MakeTransformImplementation)
+				.Function(TEXT("VectorGetSafeNormal"), VectorGetSafeNormalImplementation)
+				.Function(TEXT("RotatorQuaternion"), RotatorQuaternionImplementation)
+				.Function(TEXT("RotatorNormalize"), RotatorNormalizeImplementation)
+				.Function(TEXT("QuatMultiplies"), QuatMultipliesImplementation)
+				.Function(TEXT("QuatRotateVector"), QuatRotateVectorImplementation)
+				.Function(TEXT("TransformPosition"), TransformPositionImplementation)
+				.Function(TEXT("InverseTransformPosition"), InverseTransformPositionImplementation)
+				.Function(TEXT("LinearColorLerp"), LinearColorLerpImplementation);
+		}
+	};
+
+	[[maybe_unused]] FMathValue MathValue;
+}
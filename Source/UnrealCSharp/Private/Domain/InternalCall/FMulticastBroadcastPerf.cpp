@@ -0,0 +1,112 @@
+#if !UE_BUILD_SHIPPING
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "Domain/FMonoDomain.h"
+#include "GameFramework/Actor.h"
+#include "Reflection/Delegate/MulticastDelegateHandler.h"
+#include "Reflection/Function/FCSharpDelegateDescriptor.h"
+
+namespace
+{
+	struct FMulticastBroadcastPerf
+	{
+		/**
+		 * InListener must be a static void(UObject, float, UObject, UObject, UObject) method, it is bound
+		 * InListenerCount times to AActor::OnTakeAnyDamage and every broadcast passes a damage of one.
+		 */
+		static bool CompareImplementation(MonoObject* InListener, const int32 InListenerCount,
+		                                  const int32 InIterations, double* OutPerListenerMilliseconds,
+		                                  double* OutPerBroadcastMilliseconds)
+		{
+			if (InListener == nullptr || InListenerCount <= 0 || InIterations <= 0)
+			{
+				return false;
+			}
+
+			const auto Method = FMonoDomain::Delegate_Get_Method(InListener);
+
+			const auto DelegateProperty = FindFProperty<FMulticastDelegateProperty>(
+				AActor::StaticClass(), TEXT("OnTakeAnyDamage"));
+
+			if (Method == nullptr || DelegateProperty == nullptr || DelegateProperty->SignatureFunction == nullptr)
+			{
+				return false;
+			}
+
+			const auto Signature = DelegateProperty->SignatureFunction.Get();
+
+			const auto DamageProperty = CastField<FFloatProperty>(Signature->FindPropertyByName(TEXT("Damage")));
+
+			if (DamageProperty == nullptr)
+			{
+				return false;
+			}
+
+			const auto Params = static_cast<uint8*>(FMemory::Malloc(Signature->ParmsSize, 16));
+
+			Signature->InitializeStruct(Params);
+
+			DamageProperty->SetPropertyValue_InContainer(Params, 1.f);
+
+			// every listener converts the arguments again, the way broadcasts were handled before
+			{
+				FCSharpDelegateDescriptor DelegateDescriptor(Signature);
+
+				const auto StartTime = FPlatformTime::Seconds();
+
+				for (auto Iteration = 0; Iteration < InIterations; ++Iteration)
+				{
+					for (auto Listener = 0; Listener < InListenerCount; ++Listener)
+					{
+						DelegateDescriptor.CallDelegate(nullptr, Method, Params);
+					}
+				}
+
+				*OutPerListenerMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			}
+
+			{
+				const auto Handler = NewObject<UMulticastDelegateHandler>();
+
+				Handler->AddToRoot();
+
+				Handler->Initialize(nullptr, Signature);
+
+				for (auto Listener = 0; Listener < InListenerCount; ++Listener)
+				{
+					Handler->Add(nullptr, Method);
+				}
+
+				const auto CallBack = Handler->GetCallBack();
+
+				const auto StartTime = FPlatformTime::Seconds();
+
+				for (auto Iteration = 0; Iteration < InIterations; ++Iteration)
+				{
+					Handler->ProcessEvent(CallBack, Params);
+				}
+
+				*OutPerBroadcastMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+				Handler->Deinitialize();
+
+				Handler->RemoveFromRoot();
+			}
+
+			Signature->DestroyStruct(Params);
+
+			FMemory::Free(Params);
+
+			return true;
+		}
+
+		FMulticastBroadcastPerf()
+		{
+			FClassBuilder(TEXT("FMulticastBroadcastPerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Compare"), CompareImplementation);
+		}
+	};
+
+	[[maybe_unused]] FMulticastBroadcastPerf MulticastBroadcastPerf;
+}
+#endif
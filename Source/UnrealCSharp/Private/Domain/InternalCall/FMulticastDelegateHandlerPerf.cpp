@@ -0,0 +1,162 @@
+#if !UE_BUILD_SHIPPING
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "Environment/FCSharpEnvironment.h"
+#include "GameFramework/Actor.h"
+#include "Registry/FDelegateRegistry.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+	struct FMulticastDelegateHandlerPerf
+	{
+		static void CountHandlers(int32& OutNum, int32& OutRootedNum)
+		{
+			OutNum = 0;
+
+			OutRootedNum = 0;
+
+			for (TObjectIterator<UMulticastDelegateHandler> It; It; ++It)
+			{
+				++OutNum;
+
+				if (It->IsRooted())
+				{
+					++OutRootedNum;
+				}
+			}
+		}
+
+		static double CollectGarbageMilliseconds()
+		{
+			const auto StartTime = FPlatformTime::Seconds();
+
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+			return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		}
+
+		static bool CheckHandlers(const int32 InBaselineNum, const int32 InBaselineRootedNum, const int32 InNum,
+		                          const int32 InRootedNum)
+		{
+			int32 Num;
+
+			int32 RootedNum;
+
+			CountHandlers(Num, RootedNum);
+
+			return Num == InBaselineNum + InNum && RootedNum == InBaselineRootedNum + InRootedNum;
+		}
+
+		/**
+		 * Creates InCount multicast delegates of the AActor::OnTakeAnyDamage signature three times and times a full
+		 * collection with each: rooting a handler per delegate the way helpers used to, through the registry without
+		 * listeners, where no handler is created, and through the registry with one listener each.
+		 */
+		static bool RunImplementation(const int32 InCount, double* OutBaselineMilliseconds,
+		                              double* OutRootedMilliseconds, double* OutUnboundMilliseconds,
+		                              double* OutBoundMilliseconds)
+		{
+			const auto DelegateRegistry = FCSharpEnvironment::GetEnvironment().GetRegistry<FDelegateRegistry>();
+
+			const auto DelegateProperty = FindFProperty<FMulticastDelegateProperty>(
+				AActor::StaticClass(), TEXT("OnTakeAnyDamage"));
+
+			if (InCount <= 0 || DelegateRegistry == nullptr || DelegateProperty == nullptr)
+			{
+				return false;
+			}
+
+			const auto Signature = DelegateProperty->SignatureFunction.Get();
+
+			// never called, nothing is broadcast
+			const auto Method = reinterpret_cast<MonoMethod*>(static_cast<UPTRINT>(1));
+
+			auto bSuccess = true;
+
+			*OutBaselineMilliseconds = CollectGarbageMilliseconds();
+
+			int32 BaselineNum;
+
+			int32 BaselineRootedNum;
+
+			CountHandlers(BaselineNum, BaselineRootedNum);
+
+			const auto BaselineDescriptorNum = DelegateRegistry->GetDelegateDescriptorNum();
+
+			{
+				TArray<UMulticastDelegateHandler*> Handlers;
+
+				for (auto Index = 0; Index < InCount; ++Index)
+				{
+					const auto Handler = NewObject<UMulticastDelegateHandler>();
+
+					Handler->AddToRoot();
+
+					Handler->Initialize(nullptr, Signature);
+
+					Handlers.Add(Handler);
+				}
+
+				*OutRootedMilliseconds = CollectGarbageMilliseconds();
+
+				bSuccess &= CheckHandlers(BaselineNum, BaselineRootedNum, InCount, InCount);
+
+				for (const auto Handler : Handlers)
+				{
+					Handler->Deinitialize();
+
+					Handler->RemoveFromRoot();
+				}
+			}
+
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+			for (const auto bIsBound : {false, true})
+			{
+				TArray<FMulticastDelegateHelper*> Helpers;
+
+				for (auto Index = 0; Index < InCount; ++Index)
+				{
+					const auto Helper = new FMulticastDelegateHelper(nullptr, Signature);
+
+					if (bIsBound)
+					{
+						Helper->Add(nullptr, Method);
+					}
+
+					Helpers.Add(Helper);
+				}
+
+				*(bIsBound ? OutBoundMilliseconds : OutUnboundMilliseconds) = CollectGarbageMilliseconds();
+
+				// a handler only for delegates with listeners, never on the root set and all sharing one descriptor
+				bSuccess &= CheckHandlers(BaselineNum, BaselineRootedNum, bIsBound ? InCount : 0, 0);
+
+				bSuccess &= DelegateRegistry->GetDelegateDescriptorNum() <= BaselineDescriptorNum + 1;
+
+				for (const auto Helper : Helpers)
+				{
+					delete Helper;
+				}
+
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+				bSuccess &= CheckHandlers(BaselineNum, BaselineRootedNum, 0, 0);
+
+				bSuccess &= DelegateRegistry->GetDelegateDescriptorNum() == BaselineDescriptorNum;
+			}
+
+			return bSuccess;
+		}
+
+		FMulticastDelegateHandlerPerf()
+		{
+			FClassBuilder(TEXT("FMulticastDelegateHandlerPerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Run"), RunImplementation);
+		}
+	};
+
+	[[maybe_unused]] FMulticastDelegateHandlerPerf MulticastDelegateHandlerPerf;
+}
+#endif
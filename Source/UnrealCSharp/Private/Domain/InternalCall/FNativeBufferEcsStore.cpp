@@ -0,0 +1,148 @@
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "FEcsChunkStore.h"
+
+namespace
+{
+	struct FNativeBufferEcsStore
+	{
+		static void* CreateImplementation(const int32* InComponentSizes, const int32 InComponentCount,
+		                                  const int32 InChunkBytes)
+		{
+			if (InComponentSizes == nullptr || InComponentCount <= 0)
+			{
+				return nullptr;
+			}
+
+			for (int32 Component = 0; Component < InComponentCount; ++Component)
+			{
+				if (InComponentSizes[Component] <= 0)
+				{
+					return nullptr;
+				}
+			}
+
+			return new FEcsChunkStore(TConstArrayView<int32>(InComponentSizes, InComponentCount),
+			                          InChunkBytes > 0 ? InChunkBytes : FEcsChunkStore::DefaultChunkBytes);
+		}
+
+		static void DestroyImplementation(const void* InStore)
+		{
+			delete static_cast<const FEcsChunkStore*>(InStore);
+		}
+
+		static int32 AddImplementation(const void* InStore, const int32 InCount, uint64* OutHandles)
+		{
+			if (InStore == nullptr || InCount <= 0)
+			{
+				return 0;
+			}
+
+			FEcsChunkStore* Store = static_cast<FEcsChunkStore*>(const_cast<void*>(InStore));
+
+			for (int32 i = 0; i < InCount; ++i)
+			{
+				const uint64 Handle = Store->Add();
+
+				if (OutHandles != nullptr)
+				{
+					OutHandles[i] = Handle;
+				}
+			}
+
+			return InCount;
+		}
+
+		static bool RemoveImplementation(const void* InStore, const uint64 InHandle)
+		{
+			if (InStore == nullptr)
+			{
+				return false;
+			}
+
+			return static_cast<FEcsChunkStore*>(const_cast<void*>(InStore))->Remove(InHandle);
+		}
+
+		static void* GetComponentImplementation(const void* InStore, const uint64 InHandle, const int32 InComponent)
+		{
+			if (InStore == nullptr)
+			{
+				return nullptr;
+			}
+
+			return static_cast<const FEcsChunkStore*>(InStore)->GetComponent(InHandle, InComponent);
+		}
+
+		static int32 NumImplementation(const void* InStore)
+		{
+			return InStore != nullptr ? static_cast<const FEcsChunkStore*>(InStore)->Num() : 0;
+		}
+
+		static int64 UpdatePosVelParallelImplementation(const void* InStore, const int32 InPositionComponent,
+		                                                const int32 InVelocityComponent, const int32 InDt)
+		{
+			if (InStore == nullptr)
+			{
+				return 0;
+			}
+
+			const FEcsChunkStore* Store = static_cast<const FEcsChunkStore*>(InStore);
+
+			// both columns are read and written as int32
+			if (Store->GetComponentSize(InPositionComponent) != sizeof(int32) ||
+				Store->GetComponentSize(InVelocityComponent) != sizeof(int32))
+			{
+				return 0;
+			}
+
+			if (Store->GetNumChunks() == 0 ||
+				Store->GetColumn(0, InPositionComponent) == nullptr ||
+				Store->GetColumn(0, InVelocityComponent) == nullptr)
+			{
+				return 0;
+			}
+
+			TArray<int64> PartialSums;
+			PartialSums.SetNumZeroed(Store->GetNumChunks());
+
+			Store->ParallelForEachChunk([Store, InPositionComponent, InVelocityComponent, InDt, &PartialSums](const int32 InChunk)
+			{
+				int32* Position = static_cast<int32*>(Store->GetColumn(InChunk, InPositionComponent));
+				const int32* Velocity = static_cast<const int32*>(Store->GetColumn(InChunk, InVelocityComponent));
+
+				const int32 Length = Store->GetChunkLength(InChunk);
+
+				int64 LocalSum = 0;
+				for (int32 i = 0; i < Length; ++i)
+				{
+					Position[i] += Velocity[i] * InDt;
+					LocalSum += Position[i];
+				}
+
+				PartialSums[InChunk] = LocalSum;
+			});
+
+			int64 Sum = 0;
+			for (const int64 Value : PartialSums)
+			{
+				Sum += Value;
+			}
+
+			return Sum;
+		}
+
+		FNativeBufferEcsStore()
+		{
+			FClassBuilder(TEXT("FNativeBufferEcsStore"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Create"), CreateImplementation)
+				.Function(TEXT("Destroy"), DestroyImplementation)
+				.Function(TEXT("Add"), AddImplementation)
+				.Function(TEXT("Remove"), RemoveImplementation)
+				.Function(TEXT("GetComponent"), GetComponentImplementation)
+				.Function(TEXT("Num"), NumImplementation)
+				.Function(TEXT("UpdatePosVelParallel"), UpdatePosVelParallelImplementation);
+		}
+	};
+
+	[[maybe_unused]] FNativeBufferEcsStore NativeBufferEcsStore;
+}
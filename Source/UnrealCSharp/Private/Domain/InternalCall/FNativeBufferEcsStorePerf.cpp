@@ -0,0 +1,223 @@
+#if !UE_BUILD_SHIPPING
+#include "Async/TaskGraphInterfaces.h"
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "FEcsChunkStore.h"
+
+namespace
+{
+	struct FNativeBufferEcsStorePerf
+	{
+		struct FArchetypeDesc
+		{
+			int32* Position;
+
+			int32* Velocity;
+
+			int32 Length;
+		};
+
+		struct FSliceDesc
+		{
+			int32 ArchetypeIndex;
+
+			int32 Start;
+
+			int32 Length;
+		};
+
+		// same shape as FNativeBufferTaskGraphEcs::UpdatePosVelSlicesParallel, one task per slice
+		static int64 UpdateSlices(const FArchetypeDesc* InArchetypes, const TArray<FSliceDesc>& InSlices,
+		                          const int32 InDt)
+		{
+			TArray<int64> PartialSums;
+
+			PartialSums.SetNumZeroed(InSlices.Num());
+
+			FGraphEventArray Events;
+
+			Events.Reserve(InSlices.Num());
+
+			for (auto SliceIndex = 0; SliceIndex < InSlices.Num(); ++SliceIndex)
+			{
+				Events.Add(FFunctionGraphTask::CreateAndDispatchWhenReady(
+					[InArchetypes, &InSlices, InDt, SliceIndex, &PartialSums]()
+					{
+						const auto& Slice = InSlices[SliceIndex];
+
+						const auto& Archetype = InArchetypes[Slice.ArchetypeIndex];
+
+						const auto End = FMath::Min(Slice.Start + Slice.Length, Archetype.Length);
+
+						int64 LocalSum = 0;
+
+						for (auto Index = Slice.Start; Index < End; ++Index)
+						{
+							Archetype.Position[Index] += Archetype.Velocity[Index] * InDt;
+
+							LocalSum += Archetype.Position[Index];
+						}
+
+						PartialSums[SliceIndex] = LocalSum;
+					}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask));
+			}
+
+			FTaskGraphInterface::Get().WaitUntilTasksComplete(
+				Events,
+				IsInGameThread() ? ENamedThreads::GameThread : ENamedThreads::AnyThread
+			);
+
+			int64 Sum = 0;
+
+			for (const auto Value : PartialSums)
+			{
+				Sum += Value;
+			}
+
+			return Sum;
+		}
+
+		static int64 UpdateChunks(const FEcsChunkStore& InStore, const int32 InDt)
+		{
+			TArray<int64> PartialSums;
+
+			PartialSums.SetNumZeroed(InStore.GetNumChunks());
+
+			InStore.ParallelForEachChunk([&InStore, InDt, &PartialSums](const int32 InChunk)
+			{
+				const auto Position = static_cast<int32*>(InStore.GetColumn(InChunk, 0));
+
+				const auto Velocity = static_cast<const int32*>(InStore.GetColumn(InChunk, 1));
+
+				const auto Length = InStore.GetChunkLength(InChunk);
+
+				int64 LocalSum = 0;
+
+				for (auto Index = 0; Index < Length; ++Index)
+				{
+					Position[Index] += Velocity[Index] * InDt;
+
+					LocalSum += Position[Index];
+				}
+
+				PartialSums[InChunk] = LocalSum;
+			});
+
+			int64 Sum = 0;
+
+			for (const auto Value : PartialSums)
+			{
+				Sum += Value;
+			}
+
+			return Sum;
+		}
+
+		static bool CompareImplementation(const int32 InEntityCount, const int32 InIterations,
+		                                  double* OutSliceMilliseconds, double* OutChunkMilliseconds,
+		                                  int32* OutChunkCapacity)
+		{
+			if (InEntityCount <= 0 || InIterations <= 0)
+			{
+				return false;
+			}
+
+			const int32 ComponentSizes[] = {sizeof(int32), sizeof(int32)};
+
+			FEcsChunkStore Store(ComponentSizes);
+
+			TArray<uint64> Handles;
+
+			Handles.Reserve(InEntityCount);
+
+			TArray<int32> Positions;
+
+			TArray<int32> Velocities;
+
+			Positions.SetNumZeroed(InEntityCount);
+
+			Velocities.SetNumUninitialized(InEntityCount);
+
+			for (auto Index = 0; Index < InEntityCount; ++Index)
+			{
+				const auto Handle = Store.Add();
+
+				Velocities[Index] = Index % 7 - 3;
+
+				*static_cast<int32*>(Store.GetComponent(Handle, 1)) = Velocities[Index];
+
+				Handles.Add(Handle);
+			}
+
+			*OutChunkCapacity = Store.GetChunkCapacity();
+
+			int64 SliceSum = 0;
+
+			{
+				const FArchetypeDesc Archetype{Positions.GetData(), Velocities.GetData(), InEntityCount};
+
+				// slices as large as a chunk, rebuilt every call like the descriptors marshalled from C#
+				const auto SliceLength = Store.GetChunkCapacity();
+
+				const auto StartTime = FPlatformTime::Seconds();
+
+				for (auto Iteration = 0; Iteration < InIterations; ++Iteration)
+				{
+					TArray<FSliceDesc> Slices;
+
+					for (auto Start = 0; Start < InEntityCount; Start += SliceLength)
+					{
+						Slices.Add({0, Start, SliceLength});
+					}
+
+					SliceSum += UpdateSlices(&Archetype, Slices, 1);
+				}
+
+				*OutSliceMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			}
+
+			int64 ChunkSum = 0;
+
+			{
+				const auto StartTime = FPlatformTime::Seconds();
+
+				for (auto Iteration = 0; Iteration < InIterations; ++Iteration)
+				{
+					ChunkSum += UpdateChunks(Store, 1);
+				}
+
+				*OutChunkMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			}
+
+			// every third entity goes away, the survivors must keep their handles and values
+			auto bHandlesStable = true;
+
+			for (auto Index = 0; Index < InEntityCount; Index += 3)
+			{
+				bHandlesStable &= Store.Remove(Handles[Index]);
+			}
+
+			for (auto Index = 0; Index < InEntityCount; ++Index)
+			{
+				const auto Position = static_cast<const int32*>(Store.GetComponent(Handles[Index], 0));
+
+				bHandlesStable &= Index % 3 == 0
+					                  ? Position == nullptr
+					                  : Position != nullptr && *Position == Positions[Index];
+			}
+
+			bHandlesStable &= Store.Num() == InEntityCount - (InEntityCount + 2) / 3;
+
+			return SliceSum == ChunkSum && bHandlesStable;
+		}
+
+		FNativeBufferEcsStorePerf()
+		{
+			FClassBuilder(TEXT("FNativeBufferEcsStorePerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Compare"), CompareImplementation);
+		}
+	};
+
+	[[maybe_unused]] FNativeBufferEcsStorePerf NativeBufferEcsStorePerf;
+}
+#endif
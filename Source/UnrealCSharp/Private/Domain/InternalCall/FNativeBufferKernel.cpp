@@ -1,5 +1,6 @@
 #include "Binding/Class/FClassBuilder.h"
 #include "CoreMacro/NamespaceMacro.h"
+#include "FNativeBufferSimd.h"
 
 namespace
 {
@@ -14,23 +15,123 @@ namespace
 
 			int32* Data = static_cast<int32*>(const_cast<void*>(InData));
 
-			int64 Sum = 0;
-			for (int32 i = 0; i < InLength; ++i)
+			return static_cast<int32>(FNativeBufferSimd::AddOneAndSumInt32(Data, InLength));
+		}
+
+		static void AddInt32Implementation(const void* InData, const int32 InLength, const int32 InValue)
+		{
+			if (InData == nullptr || InLength <= 0)
+			{
+				return;
+			}
+
+			FNativeBufferSimd::AddInt32(static_cast<int32*>(const_cast<void*>(InData)), InLength, InValue);
+		}
+
+		static void AddFloatImplementation(const void* InData, const int32 InLength, const float InValue)
+		{
+			if (InData == nullptr || InLength <= 0)
 			{
-				Data[i] += 1;
-				Sum += Data[i];
+				return;
 			}
 
-			return static_cast<int32>(Sum);
+			FNativeBufferSimd::AddFloat(static_cast<float*>(const_cast<void*>(InData)), InLength, InValue);
+		}
+
+		static void MultiplyAddInt32Implementation(const void* InData, const int32 InLength,
+		                                           const int32 InScale, const int32 InBias)
+		{
+			if (InData == nullptr || InLength <= 0)
+			{
+				return;
+			}
+
+			FNativeBufferSimd::MultiplyAddInt32(static_cast<int32*>(const_cast<void*>(InData)), InLength,
+			                                    InScale, InBias);
+		}
+
+		static void MultiplyAddFloatImplementation(const void* InData, const int32 InLength,
+		                                           const float InScale, const float InBias)
+		{
+			if (InData == nullptr || InLength <= 0)
+			{
+				return;
+			}
+
+			FNativeBufferSimd::MultiplyAddFloat(static_cast<float*>(const_cast<void*>(InData)), InLength,
+			                                    InScale, InBias);
+		}
+
+		static int64 SumInt32Implementation(const void* InData, const int32 InLength)
+		{
+			if (InData == nullptr || InLength <= 0)
+			{
+				return 0;
+			}
+
+			return FNativeBufferSimd::SumInt32(static_cast<const int32*>(InData), InLength);
+		}
+
+		static float SumFloatImplementation(const void* InData, const int32 InLength)
+		{
+			if (InData == nullptr || InLength <= 0)
+			{
+				return 0.f;
+			}
+
+			return FNativeBufferSimd::SumFloat(static_cast<const float*>(InData), InLength);
+		}
+
+		static bool MinMaxInt32Implementation(const void* InData, const int32 InLength,
+		                                      int32* OutMin, int32* OutMax)
+		{
+			return FNativeBufferSimd::MinMaxInt32(static_cast<const int32*>(InData), InLength, *OutMin, *OutMax);
+		}
+
+		static bool MinMaxFloatImplementation(const void* InData, const int32 InLength,
+		                                      float* OutMin, float* OutMax)
+		{
+			return FNativeBufferSimd::MinMaxFloat(static_cast<const float*>(InData), InLength, *OutMin, *OutMax);
+		}
+
+		static void ClampInt32Implementation(const void* InData, const int32 InLength,
+		                                     const int32 InMin, const int32 InMax)
+		{
+			if (InData == nullptr || InLength <= 0)
+			{
+				return;
+			}
+
+			FNativeBufferSimd::ClampInt32(static_cast<int32*>(const_cast<void*>(InData)), InLength, InMin, InMax);
+		}
+
+		static void ClampFloatImplementation(const void* InData, const int32 InLength,
+		                                     const float InMin, const float InMax)
+		{
+			if (InData == nullptr || InLength <= 0)
+			{
+				return;
+			}
+
+			FNativeBufferSimd::ClampFloat(static_cast<float*>(const_cast<void*>(InData)), InLength, InMin, InMax);
 		}
 
 		FNativeBufferKernel()
 		{
 			FClassBuilder(TEXT("FNativeBufferKernel"), NAMESPACE_LIBRARY)
-				.Function(TEXT("AddOneAndSumInt32"), AddOneAndSumInt32Implementation);
+				.Function(TEXT("AddOneAndSumInt32"), AddOneAndSumInt32Implementation)
+				.Function(TEXT("AddInt32"), AddInt32Implementation)
+				.Function(TEXT("AddFloat"), AddFloatImplementation)
+				.Function(TEXT("MultiplyAddInt32"), MultiplyAddInt32Implementation)
+				.Function(TEXT("MultiplyAddFloat"), MultiplyAddFloatImplementation)
+				.Function(TEXT("SumInt32"), SumInt32Implementation)
+				.Function(TEXT("SumFloat"), SumFloatImplementation)
+				.Function(TEXT("MinMaxInt32"), MinMaxInt32Implementation)
+				.Function(TEXT("MinMaxFloat"), MinMaxFloatImplementation)
+				.Function(TEXT("ClampInt32"), ClampInt32Implementation)
+				.Function(TEXT("ClampFloat"), ClampFloatImplementation);
 		}
 	};
 
 	[[maybe_unused]] FNativeBufferKernel NativeBufferKernel;
 }
-
@@ -0,0 +1,266 @@
+#if !UE_BUILD_SHIPPING
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "FNativeBufferSimd.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+	struct FNativeBufferKernelPerf
+	{
+		typedef uint64 (*FKernelFunction)(void* InData, int32 InLength);
+
+		struct FKernel
+		{
+			bool bFloat;
+
+			// bytes read and written per element
+			int32 Bytes;
+
+			FKernelFunction Scalar;
+
+			FKernelFunction Vector;
+		};
+
+		static uint64 FloatBits(const float InValue)
+		{
+			uint32 Bits;
+
+			FMemory::Memcpy(&Bits, &InValue, sizeof(Bits));
+
+			return Bits;
+		}
+
+		template <typename T>
+		static uint64 AddInt32(void* InData, const int32 InLength)
+		{
+			T::AddInt32(static_cast<int32*>(InData), InLength, 3);
+
+			return 0;
+		}
+
+		template <typename T>
+		static uint64 AddFloat(void* InData, const int32 InLength)
+		{
+			T::AddFloat(static_cast<float*>(InData), InLength, 0.25f);
+
+			return 0;
+		}
+
+		template <typename T>
+		static uint64 MultiplyAddInt32(void* InData, const int32 InLength)
+		{
+			T::MultiplyAddInt32(static_cast<int32*>(InData), InLength, 3, 1);
+
+			return 0;
+		}
+
+		template <typename T>
+		static uint64 MultiplyAddFloat(void* InData, const int32 InLength)
+		{
+			T::MultiplyAddFloat(static_cast<float*>(InData), InLength, 0.5f, 1.f);
+
+			return 0;
+		}
+
+		template <typename T>
+		static uint64 SumInt32(void* InData, const int32 InLength)
+		{
+			return static_cast<uint64>(T::SumInt32(static_cast<const int32*>(InData), InLength));
+		}
+
+		template <typename T>
+		static uint64 SumFloat(void* InData, const int32 InLength)
+		{
+			return FloatBits(T::SumFloat(static_cast<const float*>(InData), InLength));
+		}
+
+		template <typename T>
+		static uint64 MinMaxInt32(void* InData, const int32 InLength)
+		{
+			int32 Min = 0;
+
+			int32 Max = 0;
+
+			const auto bFound = T::MinMaxInt32(static_cast<const int32*>(InData), InLength, Min, Max);
+
+			return bFound ? static_cast<uint64>(static_cast<uint32>(Min)) << 32 | static_cast<uint32>(Max) : 0;
+		}
+
+		template <typename T>
+		static uint64 MinMaxFloat(void* InData, const int32 InLength)
+		{
+			float Min = 0.f;
+
+			float Max = 0.f;
+
+			const auto bFound = T::MinMaxFloat(static_cast<const float*>(InData), InLength, Min, Max);
+
+			return bFound ? FloatBits(Min) << 32 | FloatBits(Max) : 0;
+		}
+
+		template <typename T>
+		static uint64 ClampInt32(void* InData, const int32 InLength)
+		{
+			T::ClampInt32(static_cast<int32*>(InData), InLength, -(1 << 20), 1 << 20);
+
+			return 0;
+		}
+
+		template <typename T>
+		static uint64 ClampFloat(void* InData, const int32 InLength)
+		{
+			T::ClampFloat(static_cast<float*>(InData), InLength, -100.f, 100.f);
+
+			return 0;
+		}
+
+		template <typename T>
+		static uint64 AddOneAndSumInt32(void* InData, const int32 InLength)
+		{
+			return static_cast<uint64>(T::AddOneAndSumInt32(static_cast<int32*>(InData), InLength));
+		}
+
+		static const FKernel* GetKernel(const int32 InKernel)
+		{
+			// keep in sync with NativeBufferKernelPerfRunner.KernelNames
+			static const FKernel Kernels[] =
+			{
+				{false, 8, &AddInt32<FNativeBufferScalar>, &AddInt32<FNativeBufferSimd>},
+				{true, 8, &AddFloat<FNativeBufferScalar>, &AddFloat<FNativeBufferSimd>},
+				{false, 8, &MultiplyAddInt32<FNativeBufferScalar>, &MultiplyAddInt32<FNativeBufferSimd>},
+				{true, 8, &MultiplyAddFloat<FNativeBufferScalar>, &MultiplyAddFloat<FNativeBufferSimd>},
+				{false, 4, &SumInt32<FNativeBufferScalar>, &SumInt32<FNativeBufferSimd>},
+				{true, 4, &SumFloat<FNativeBufferScalar>, &SumFloat<FNativeBufferSimd>},
+				{false, 4, &MinMaxInt32<FNativeBufferScalar>, &MinMaxInt32<FNativeBufferSimd>},
+				{true, 4, &MinMaxFloat<FNativeBufferScalar>, &MinMaxFloat<FNativeBufferSimd>},
+				{false, 8, &ClampInt32<FNativeBufferScalar>, &ClampInt32<FNativeBufferSimd>},
+				{true, 8, &ClampFloat<FNativeBufferScalar>, &ClampFloat<FNativeBufferSimd>},
+				{false, 8, &AddOneAndSumInt32<FNativeBufferScalar>, &AddOneAndSumInt32<FNativeBufferSimd>}
+			};
+
+			return InKernel >= 0 && InKernel < static_cast<int32>(UE_ARRAY_COUNT(Kernels))
+				       ? &Kernels[InKernel]
+				       : nullptr;
+		}
+
+		static void Fill(const FKernel& InKernel, TArray<uint32>& OutData, const int32 InLength,
+		                 FRandomStream& InRandomStream)
+		{
+			OutData.SetNumUninitialized(InLength);
+
+			for (auto Index = 0; Index < InLength; ++Index)
+			{
+				OutData[Index] = InKernel.bFloat
+					                 ? static_cast<uint32>(FloatBits(InRandomStream.FRandRange(-1000.f, 1000.f)))
+					                 : InRandomStream.GetUnsignedInt();
+			}
+		}
+
+		static bool IsBitExact(const FKernel& InKernel, const TArray<uint32>& InSource, const int32 InOffset)
+		{
+			const auto Length = InSource.Num();
+
+			// the offset moves the data off the 16 byte boundary of the allocation
+			TArray<uint32> ScalarData;
+
+			TArray<uint32> VectorData;
+
+			ScalarData.SetNumZeroed(Length + InOffset);
+
+			VectorData.SetNumZeroed(Length + InOffset);
+
+			FMemory::Memcpy(ScalarData.GetData() + InOffset, InSource.GetData(), Length * sizeof(uint32));
+
+			FMemory::Memcpy(VectorData.GetData() + InOffset, InSource.GetData(), Length * sizeof(uint32));
+
+			const auto ScalarResult = InKernel.Scalar(ScalarData.GetData() + InOffset, Length);
+
+			const auto VectorResult = InKernel.Vector(VectorData.GetData() + InOffset, Length);
+
+			return ScalarResult == VectorResult &&
+				FMemory::Memcmp(ScalarData.GetData(), VectorData.GetData(), ScalarData.Num() * sizeof(uint32)) == 0;
+		}
+
+		static double Measure(const FKernelFunction InFunction, const TArray<uint32>& InSource,
+		                      const int32 InIterations, TArray<uint32>& OutData, uint64& OutResult)
+		{
+			OutData = InSource;
+
+			OutResult = 0;
+
+			const auto StartTime = FPlatformTime::Seconds();
+
+			for (auto Iteration = 0; Iteration < InIterations; ++Iteration)
+			{
+				OutResult ^= InFunction(OutData.GetData(), OutData.Num());
+			}
+
+			return FPlatformTime::Seconds() - StartTime;
+		}
+
+		static bool CompareImplementation(const int32 InKernel, const int32 InLength, const int32 InIterations,
+		                                  double* OutScalarGigabytesPerSecond,
+		                                  double* OutVectorGigabytesPerSecond)
+		{
+			const auto Kernel = GetKernel(InKernel);
+
+			if (Kernel == nullptr || InLength <= 0 || InIterations <= 0)
+			{
+				return false;
+			}
+
+			FRandomStream RandomStream(InKernel + 1);
+
+			TArray<uint32> Source;
+
+			auto bBitExact = true;
+
+			// every tail length, at every misalignment
+			for (auto Length = 0; Length <= 67; ++Length)
+			{
+				Fill(*Kernel, Source, Length, RandomStream);
+
+				for (auto Offset = 0; Offset < 4; ++Offset)
+				{
+					bBitExact &= IsBitExact(*Kernel, Source, Offset);
+				}
+			}
+
+			Fill(*Kernel, Source, InLength, RandomStream);
+
+			bBitExact &= IsBitExact(*Kernel, Source, 1);
+
+			TArray<uint32> ScalarData;
+
+			TArray<uint32> VectorData;
+
+			uint64 ScalarResult;
+
+			uint64 VectorResult;
+
+			const auto ScalarSeconds = Measure(Kernel->Scalar, Source, InIterations, ScalarData, ScalarResult);
+
+			const auto VectorSeconds = Measure(Kernel->Vector, Source, InIterations, VectorData, VectorResult);
+
+			bBitExact &= ScalarResult == VectorResult && ScalarData == VectorData;
+
+			const auto Gigabytes = static_cast<double>(Kernel->Bytes) * InLength * InIterations / 1e9;
+
+			*OutScalarGigabytesPerSecond = ScalarSeconds > 0.0 ? Gigabytes / ScalarSeconds : 0.0;
+
+			*OutVectorGigabytesPerSecond = VectorSeconds > 0.0 ? Gigabytes / VectorSeconds : 0.0;
+
+			return bBitExact;
+		}
+
+		FNativeBufferKernelPerf()
+		{
+			FClassBuilder(TEXT("FNativeBufferKernelPerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Compare"), CompareImplementation);
+		}
+	};
+
+	[[maybe_unused]] FNativeBufferKernelPerf NativeBufferKernelPerf;
+}
+#endif
@@ -0,0 +1,425 @@
+#include "FNativeBufferSimd.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+	constexpr int32 VectorWidth = 4;
+
+	// low halves are at most 0xFFFF, 32768 of them per lane still fit into int32
+	constexpr int32 SumBlockLength = VectorWidth * 32768;
+
+	FORCEINLINE float MinFloat(const float A, const float B)
+	{
+		return A < B ? A : B;
+	}
+
+	FORCEINLINE float MaxFloat(const float A, const float B)
+	{
+		return A > B ? A : B;
+	}
+
+	FORCEINLINE int32 WrapMultiplyAdd(const int32 InValue, const int32 InScale, const int32 InBias)
+	{
+		return static_cast<int32>(static_cast<uint32>(InValue) * static_cast<uint32>(InScale) +
+			static_cast<uint32>(InBias));
+	}
+
+	FORCEINLINE int64 SumLowHigh(const VectorRegister4Int& InLow, const VectorRegister4Int& InHigh)
+	{
+		alignas(16) int32 Low[VectorWidth];
+		alignas(16) int32 High[VectorWidth];
+
+		VectorIntStore(InLow, Low);
+		VectorIntStore(InHigh, High);
+
+		int64 Sum = 0;
+		for (int32 Lane = 0; Lane < VectorWidth; ++Lane)
+		{
+			Sum += static_cast<int64>(High[Lane]) * 65536 + Low[Lane];
+		}
+
+		return Sum;
+	}
+
+	// the add one variant writes back, so only it takes a mutable pointer
+	template <bool bAddOne>
+	FORCEINLINE int64 SumInt32Vectorized(std::conditional_t<bAddOne, int32*, const int32*> InData,
+	                                     const int32 InVectorLength)
+	{
+		const VectorRegister4Int LowMask = VectorIntSet1(0xFFFF);
+		const VectorRegister4Int One = VectorIntSet1(1);
+
+		int64 Sum = 0;
+		int32 i = 0;
+		while (i < InVectorLength)
+		{
+			const int32 BlockEnd = FMath::Min(InVectorLength, i + SumBlockLength);
+
+			VectorRegister4Int Low = VectorIntSet1(0);
+			VectorRegister4Int High = VectorIntSet1(0);
+
+			for (; i < BlockEnd; i += VectorWidth)
+			{
+				VectorRegister4Int Value = VectorIntLoad(InData + i);
+
+				if constexpr (bAddOne)
+				{
+					Value = VectorIntAdd(Value, One);
+					VectorIntStore(Value, InData + i);
+				}
+
+				Low = VectorIntAdd(Low, VectorIntAnd(Value, LowMask));
+				High = VectorIntAdd(High, VectorShiftRightImmArithmetic(Value, 16));
+			}
+
+			Sum += SumLowHigh(Low, High);
+		}
+
+		return Sum;
+	}
+}
+
+void FNativeBufferSimd::AddInt32(int32* InData, const int32 InLength, const int32 InValue)
+{
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	const VectorRegister4Int Value = VectorIntSet1(InValue);
+
+	for (int32 i = 0; i < VectorLength; i += VectorWidth)
+	{
+		VectorIntStore(VectorIntAdd(VectorIntLoad(InData + i), Value), InData + i);
+	}
+
+	FNativeBufferScalar::AddInt32(InData + VectorLength, InLength - VectorLength, InValue);
+}
+
+void FNativeBufferSimd::AddFloat(float* InData, const int32 InLength, const float InValue)
+{
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	const VectorRegister4Float Value = VectorSetFloat1(InValue);
+
+	for (int32 i = 0; i < VectorLength; i += VectorWidth)
+	{
+		VectorStore(VectorAdd(VectorLoad(InData + i), Value), InData + i);
+	}
+
+	FNativeBufferScalar::AddFloat(InData + VectorLength, InLength - VectorLength, InValue);
+}
+
+void FNativeBufferSimd::MultiplyAddInt32(int32* InData, const int32 InLength, const int32 InScale, const int32 InBias)
+{
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	const VectorRegister4Int Scale = VectorIntSet1(InScale);
+	const VectorRegister4Int Bias = VectorIntSet1(InBias);
+
+	for (int32 i = 0; i < VectorLength; i += VectorWidth)
+	{
+		VectorIntStore(VectorIntAdd(VectorIntMultiply(VectorIntLoad(InData + i), Scale), Bias), InData + i);
+	}
+
+	FNativeBufferScalar::MultiplyAddInt32(InData + VectorLength, InLength - VectorLength, InScale, InBias);
+}
+
+void FNativeBufferSimd::MultiplyAddFloat(float* InData, const int32 InLength, const float InScale, const float InBias)
+{
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	const VectorRegister4Float Scale = VectorSetFloat1(InScale);
+	const VectorRegister4Float Bias = VectorSetFloat1(InBias);
+
+	// multiply then add rather than VectorMultiplyAdd, a fused result would not match the scalar loop
+	for (int32 i = 0; i < VectorLength; i += VectorWidth)
+	{
+		VectorStore(VectorAdd(VectorMultiply(VectorLoad(InData + i), Scale), Bias), InData + i);
+	}
+
+	FNativeBufferScalar::MultiplyAddFloat(InData + VectorLength, InLength - VectorLength, InScale, InBias);
+}
+
+int64 FNativeBufferSimd::SumInt32(const int32* InData, const int32 InLength)
+{
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	return SumInt32Vectorized<false>(InData, VectorLength) +
+		FNativeBufferScalar::SumInt32(InData + VectorLength, InLength - VectorLength);
+}
+
+float FNativeBufferSimd::SumFloat(const float* InData, const int32 InLength)
+{
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	VectorRegister4Float Accumulator = VectorZeroFloat();
+
+	for (int32 i = 0; i < VectorLength; i += VectorWidth)
+	{
+		Accumulator = VectorAdd(Accumulator, VectorLoad(InData + i));
+	}
+
+	alignas(16) float Lanes[VectorWidth];
+
+	VectorStore(Accumulator, Lanes);
+
+	float Sum = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+	for (int32 i = VectorLength; i < InLength; ++i)
+	{
+		Sum += InData[i];
+	}
+
+	return Sum;
+}
+
+bool FNativeBufferSimd::MinMaxInt32(const int32* InData, const int32 InLength, int32& OutMin, int32& OutMax)
+{
+	if (InData == nullptr || InLength <= 0)
+	{
+		return false;
+	}
+
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	VectorRegister4Int Min = VectorIntSet1(InData[0]);
+	VectorRegister4Int Max = Min;
+
+	for (int32 i = 0; i < VectorLength; i += VectorWidth)
+	{
+		const VectorRegister4Int Value = VectorIntLoad(InData + i);
+
+		Min = VectorIntMin(Min, Value);
+		Max = VectorIntMax(Max, Value);
+	}
+
+	alignas(16) int32 MinLanes[VectorWidth];
+	alignas(16) int32 MaxLanes[VectorWidth];
+
+	VectorIntStore(Min, MinLanes);
+	VectorIntStore(Max, MaxLanes);
+
+	OutMin = FMath::Min(FMath::Min(MinLanes[0], MinLanes[1]), FMath::Min(MinLanes[2], MinLanes[3]));
+	OutMax = FMath::Max(FMath::Max(MaxLanes[0], MaxLanes[1]), FMath::Max(MaxLanes[2], MaxLanes[3]));
+
+	for (int32 i = VectorLength; i < InLength; ++i)
+	{
+		OutMin = FMath::Min(OutMin, InData[i]);
+		OutMax = FMath::Max(OutMax, InData[i]);
+	}
+
+	return true;
+}
+
+bool FNativeBufferSimd::MinMaxFloat(const float* InData, const int32 InLength, float& OutMin, float& OutMax)
+{
+	if (InData == nullptr || InLength <= 0)
+	{
+		return false;
+	}
+
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	VectorRegister4Float Min = VectorSetFloat1(InData[0]);
+	VectorRegister4Float Max = Min;
+
+	for (int32 i = 0; i < VectorLength; i += VectorWidth)
+	{
+		const VectorRegister4Float Value = VectorLoad(InData + i);
+
+		Min = VectorMin(Min, Value);
+		Max = VectorMax(Max, Value);
+	}
+
+	alignas(16) float MinLanes[VectorWidth];
+	alignas(16) float MaxLanes[VectorWidth];
+
+	VectorStore(Min, MinLanes);
+	VectorStore(Max, MaxLanes);
+
+	OutMin = MinFloat(MinFloat(MinLanes[0], MinLanes[1]), MinFloat(MinLanes[2], MinLanes[3]));
+	OutMax = MaxFloat(MaxFloat(MaxLanes[0], MaxLanes[1]), MaxFloat(MaxLanes[2], MaxLanes[3]));
+
+	for (int32 i = VectorLength; i < InLength; ++i)
+	{
+		OutMin = MinFloat(OutMin, InData[i]);
+		OutMax = MaxFloat(OutMax, InData[i]);
+	}
+
+	return true;
+}
+
+void FNativeBufferSimd::ClampInt32(int32* InData, const int32 InLength, const int32 InMin, const int32 InMax)
+{
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	const VectorRegister4Int Min = VectorIntSet1(InMin);
+	const VectorRegister4Int Max = VectorIntSet1(InMax);
+
+	for (int32 i = 0; i < VectorLength; i += VectorWidth)
+	{
+		VectorIntStore(VectorIntMin(VectorIntMax(VectorIntLoad(InData + i), Min), Max), InData + i);
+	}
+
+	FNativeBufferScalar::ClampInt32(InData + VectorLength, InLength - VectorLength, InMin, InMax);
+}
+
+void FNativeBufferSimd::ClampFloat(float* InData, const int32 InLength, const float InMin, const float InMax)
+{
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	const VectorRegister4Float Min = VectorSetFloat1(InMin);
+	const VectorRegister4Float Max = VectorSetFloat1(InMax);
+
+	for (int32 i = 0; i < VectorLength; i += VectorWidth)
+	{
+		VectorStore(VectorMin(VectorMax(VectorLoad(InData + i), Min), Max), InData + i);
+	}
+
+	FNativeBufferScalar::ClampFloat(InData + VectorLength, InLength - VectorLength, InMin, InMax);
+}
+
+int64 FNativeBufferSimd::AddOneAndSumInt32(int32* InData, const int32 InLength)
+{
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	return SumInt32Vectorized<true>(InData, VectorLength) +
+		FNativeBufferScalar::AddOneAndSumInt32(InData + VectorLength, InLength - VectorLength);
+}
+
+void FNativeBufferScalar::AddInt32(int32* InData, const int32 InLength, const int32 InValue)
+{
+	for (int32 i = 0; i < InLength; ++i)
+	{
+		InData[i] = static_cast<int32>(static_cast<uint32>(InData[i]) + static_cast<uint32>(InValue));
+	}
+}
+
+void FNativeBufferScalar::AddFloat(float* InData, const int32 InLength, const float InValue)
+{
+	for (int32 i = 0; i < InLength; ++i)
+	{
+		InData[i] += InValue;
+	}
+}
+
+void FNativeBufferScalar::MultiplyAddInt32(int32* InData, const int32 InLength, const int32 InScale, const int32 InBias)
+{
+	for (int32 i = 0; i < InLength; ++i)
+	{
+		InData[i] = WrapMultiplyAdd(InData[i], InScale, InBias);
+	}
+}
+
+void FNativeBufferScalar::MultiplyAddFloat(float* InData, const int32 InLength, const float InScale, const float InBias)
+{
+	for (int32 i = 0; i < InLength; ++i)
+	{
+		// separate statements keep the compiler from contracting into a fused multiply-add
+		const float Product = InData[i] * InScale;
+
+		InData[i] = Product + InBias;
+	}
+}
+
+int64 FNativeBufferScalar::SumInt32(const int32* InData, const int32 InLength)
+{
+	int64 Sum = 0;
+	for (int32 i = 0; i < InLength; ++i)
+	{
+		Sum += InData[i];
+	}
+
+	return Sum;
+}
+
+float FNativeBufferScalar::SumFloat(const float* InData, const int32 InLength)
+{
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	float Lanes[VectorWidth] = {0.f, 0.f, 0.f, 0.f};
+	for (int32 i = 0; i < VectorLength; ++i)
+	{
+		Lanes[i & (VectorWidth - 1)] += InData[i];
+	}
+
+	float Sum = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+	for (int32 i = VectorLength; i < InLength; ++i)
+	{
+		Sum += InData[i];
+	}
+
+	return Sum;
+}
+
+bool FNativeBufferScalar::MinMaxInt32(const int32* InData, const int32 InLength, int32& OutMin, int32& OutMax)
+{
+	if (InData == nullptr || InLength <= 0)
+	{
+		return false;
+	}
+
+	OutMin = InData[0];
+	OutMax = InData[0];
+	for (int32 i = 1; i < InLength; ++i)
+	{
+		OutMin = FMath::Min(OutMin, InData[i]);
+		OutMax = FMath::Max(OutMax, InData[i]);
+	}
+
+	return true;
+}
+
+bool FNativeBufferScalar::MinMaxFloat(const float* InData, const int32 InLength, float& OutMin, float& OutMax)
+{
+	if (InData == nullptr || InLength <= 0)
+	{
+		return false;
+	}
+
+	const int32 VectorLength = InLength & ~(VectorWidth - 1);
+
+	float MinLanes[VectorWidth] = {InData[0], InData[0], InData[0], InData[0]};
+	float MaxLanes[VectorWidth] = {InData[0], InData[0], InData[0], InData[0]};
+	for (int32 i = 0; i < VectorLength; ++i)
+	{
+		MinLanes[i & (VectorWidth - 1)] = MinFloat(MinLanes[i & (VectorWidth - 1)], InData[i]);
+		MaxLanes[i & (VectorWidth - 1)] = MaxFloat(MaxLanes[i & (VectorWidth - 1)], InData[i]);
+	}
+
+	OutMin = MinFloat(MinFloat(MinLanes[0], MinLanes[1]), MinFloat(MinLanes[2], MinLanes[3]));
+	OutMax = MaxFloat(MaxFloat(MaxLanes[0], MaxLanes[1]), MaxFloat(MaxLanes[2], MaxLanes[3]));
+
+	for (int32 i = VectorLength; i < InLength; ++i)
+	{
+		OutMin = MinFloat(OutMin, InData[i]);
+		OutMax = MaxFloat(OutMax, InData[i]);
+	}
+
+	return true;
+}
+
+void FNativeBufferScalar::ClampInt32(int32* InData, const int32 InLength, const int32 InMin, const int32 InMax)
+{
+	for (int32 i = 0; i < InLength; ++i)
+	{
+		InData[i] = FMath::Min(FMath::Max(InData[i], InMin), InMax);
+	}
+}
+
+void FNativeBufferScalar::ClampFloat(float* InData, const int32 InLength, const float InMin, const float InMax)
+{
+	for (int32 i = 0; i < InLength; ++i)
+	{
+		InData[i] = MinFloat(MaxFloat(InData[i], InMin), InMax);
+	}
+}
+
+int64 FNativeBufferScalar::AddOneAndSumInt32(int32* InData, const int32 InLength)
+{
+	int64 Sum = 0;
+	for (int32 i = 0; i < InLength; ++i)
+	{
+		InData[i] = static_cast<int32>(static_cast<uint32>(InData[i]) + 1u);
+		Sum += InData[i];
+	}
+
+	return Sum;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Bulk kernels over NativeBuffer memory, FNativeBufferSimd uses VectorRegister with a scalar tail and
+ * FNativeBufferScalar holds the reference loops it has to match bit for bit.
+ * Integer arithmetic wraps, float min/max/clamp follow the SSE ordering (A < B ? A : B)
+ * and float sums accumulate in four interleaved lanes.
+ */
+struct FNativeBufferSimd
+{
+	static void AddInt32(int32* InData, int32 InLength, int32 InValue);
+
+	static void AddFloat(float* InData, int32 InLength, float InValue);
+
+	static void MultiplyAddInt32(int32* InData, int32 InLength, int32 InScale, int32 InBias);
+
+	static void MultiplyAddFloat(float* InData, int32 InLength, float InScale, float InBias);
+
+	static int64 SumInt32(const int32* InData, int32 InLength);
+
+	static float SumFloat(const float* InData, int32 InLength);
+
+	static bool MinMaxInt32(const int32* InData, int32 InLength, int32& OutMin, int32& OutMax);
+
+	static bool MinMaxFloat(const float* InData, int32 InLength, float& OutMin, float& OutMax);
+
+	static void ClampInt32(int32* InData, int32 InLength, int32 InMin, int32 InMax);
+
+	static void ClampFloat(float* InData, int32 InLength, float InMin, float InMax);
+
+	static int64 AddOneAndSumInt32(int32* InData, int32 InLength);
+};
+
+struct FNativeBufferScalar
+{
+	static void AddInt32(int32* InData, int32 InLength, int32 InValue);
+
+	static void AddFloat(float* InData, int32 InLength, float InValue);
+
+	static void MultiplyAddInt32(int32* InData, int32 InLength, int32 InScale, int32 InBias);
+
+	static void MultiplyAddFloat(float* InData, int32 InLength, float InScale, float InBias);
+
+	static int64 SumInt32(const int32* InData, int32 InLength);
+
+	static float SumFloat(const float* InData, int32 InLength);
+
+	static bool MinMaxInt32(const int32* InData, int32 InLength, int32& OutMin, int32& OutMax);
+
+	static bool MinMaxFloat(const float* InData, int32 InLength, float& OutMin, float& OutMax);
+
+	static void ClampInt32(int32* InData, int32 InLength, int32 InMin, int32 InMax);
+
+	static void ClampFloat(float* InData, int32 InLength, float InMin, float InMax);
+
+	static int64 AddOneAndSumInt32(int32* InData, int32 InLength);
+};
@@ -2,6 +2,7 @@
 #include "Async/TaskGraphInterfaces.h"
 #include "Binding/Class/FClassBuilder.h"
 #include "CoreMacro/NamespaceMacro.h"
+#include "FNativeBufferSimd.h"
 #include "HAL/PlatformTLS.h"
 #include "Log/UnrealCSharpLog.h"
 
@@ -49,14 +50,9 @@ namespace
 						       WorkerThreadId);
 					}
 
-					int64 LocalSum = 0;
-					for (int32 i = Start; i < End; ++i)
-					{
-						Data[i] += 1;
-						LocalSum += Data[i];
-					}
-
-					PartialSums[TaskIndex] = LocalSum;
+					PartialSums[TaskIndex] = End > Start
+						                           ? FNativeBufferSimd::AddOneAndSumInt32(Data + Start, End - Start)
+						                           : 0;
 				}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask));
 			}
 
@@ -0,0 +1,121 @@
+#if !UE_BUILD_SHIPPING
+#include "Binding/Class/FClassBuilder.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "Registry/FObjectSlotArray.h"
+#include "Misc/TextBuffer.h"
+#include "Async/ParallelFor.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	struct FObjectRegistryPerf
+	{
+		static bool CompareImplementation(const int32 InObjectCount, const int32 InIterations,
+		                                  double* OutMapMilliseconds, double* OutArrayMilliseconds,
+		                                  double* OutParallelArrayMilliseconds,
+		                                  int64* OutMapBytes, int64* OutArrayBytes)
+		{
+			if (InObjectCount <= 0 || InIterations <= 0)
+			{
+				return false;
+			}
+
+			TArray<UObject*> Objects;
+
+			Objects.Reserve(InObjectCount);
+
+			for (auto Index = 0; Index < InObjectCount; ++Index)
+			{
+				Objects.Add(NewObject<UTextBuffer>(GetTransientPackage(), NAME_None, RF_Transient));
+			}
+
+			TMap<TWeakObjectPtr<const UObject>, FGarbageCollectionHandle> Map;
+
+			FObjectSlotArray Array;
+
+			for (auto Index = 0; Index < InObjectCount; ++Index)
+			{
+				const auto GarbageCollectionHandle = FGarbageCollectionHandle(
+					reinterpret_cast<GarbageCollectionHandleType>(static_cast<UPTRINT>(Index + 1)));
+
+				Map.Add(Objects[Index], GarbageCollectionHandle);
+
+				Array.Add(Objects[Index], GarbageCollectionHandle);
+			}
+
+			TArray<int32> Order;
+
+			Order.SetNumUninitialized(InIterations);
+
+			FRandomStream RandomStream(1234);
+
+			for (auto Index = 0; Index < InIterations; ++Index)
+			{
+				Order[Index] = RandomStream.RandHelper(InObjectCount);
+			}
+
+			UPTRINT MapSum = 0;
+
+			auto StartTime = FPlatformTime::Seconds();
+
+			for (const auto Index : Order)
+			{
+				if (const auto FoundGarbageCollectionHandle = Map.Find(Objects[Index]))
+				{
+					MapSum += reinterpret_cast<UPTRINT>(static_cast<GarbageCollectionHandleType>(
+						*FoundGarbageCollectionHandle));
+				}
+			}
+
+			*OutMapMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			UPTRINT ArraySum = 0;
+
+			StartTime = FPlatformTime::Seconds();
+
+			for (const auto Index : Order)
+			{
+				ArraySum += reinterpret_cast<UPTRINT>(static_cast<GarbageCollectionHandleType>(
+					Array.Find(Objects[Index])));
+			}
+
+			*OutArrayMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			constexpr auto NumBatches = 64;
+
+			std::atomic<UPTRINT> ParallelArraySum = 0;
+
+			StartTime = FPlatformTime::Seconds();
+
+			ParallelFor(NumBatches, [&](const int32 InBatch)
+			{
+				UPTRINT Sum = 0;
+
+				for (auto Index = InBatch; Index < InIterations; Index += NumBatches)
+				{
+					Sum += reinterpret_cast<UPTRINT>(static_cast<GarbageCollectionHandleType>(
+						Array.Find(Objects[Order[Index]])));
+				}
+
+				ParallelArraySum.fetch_add(Sum, std::memory_order_relaxed);
+			});
+
+			*OutParallelArrayMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			*OutMapBytes = static_cast<int64>(Map.GetAllocatedSize());
+
+			*OutArrayBytes = static_cast<int64>(Array.GetAllocatedSize());
+
+			return MapSum == ArraySum && ArraySum == ParallelArraySum.load();
+		}
+
+		FObjectRegistryPerf()
+		{
+			FClassBuilder(TEXT("FObjectRegistryPerf"), NAMESPACE_LIBRARY)
+				.Function(TEXT("Compare"), CompareImplementation);
+		}
+	};
+
+	[[maybe_unused]] FObjectRegistryPerf ObjectRegistryPerf;
+}
+#endif
@@ -3,7 +3,7 @@
 #include "Binding/Class/FClassBuilder.h"
 #include "Environment/FCSharpEnvironment.h"
 #include "CoreMacro/NamespaceMacro.h"
-#include "Async/Async.h"
+#include "Domain/FReleaseQueue.h"
 
 namespace
 {
@@ -32,10 +32,10 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
+			FReleaseQueue::Enqueue(InGarbageCollectionHandle, [](const FGarbageCollectionHandle& InReleaseHandle)
 			{
 				(void)FCSharpEnvironment::GetEnvironment().RemoveStringReference<
-					FAnsiString>(InGarbageCollectionHandle);
+					FAnsiString>(InReleaseHandle);
 			});
 		}
 
@@ -2,10 +2,11 @@
 #include "Binding/Class/FClassBuilder.h"
 #include "Environment/FCSharpEnvironment.h"
 #include "Bridge/FTypeBridge.h"
+#include "Binding/ScriptStruct/TValueStruct.inl"
 #include "Reflection/Container/FArrayHelper.h"
 #include "CoreMacro/BufferMacro.h"
 #include "CoreMacro/NamespaceMacro.h"
-#include "Async/Async.h"
+#include "Domain/FReleaseQueue.h"
 
 namespace
 {
@@ -31,10 +32,10 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
+			FReleaseQueue::Enqueue(InGarbageCollectionHandle, [](const FGarbageCollectionHandle& InReleaseHandle)
 			{
 				(void)FCSharpEnvironment::GetEnvironment().RemoveContainerReference<
-					FArrayHelper>(InGarbageCollectionHandle);
+					FArrayHelper>(InReleaseHandle);
 			});
 		}
 
@@ -105,6 +106,79 @@ namespace
 			return 0;
 		}
 
+		template <typename T, typename Value>
+		static bool IsValueStructClass(const UScriptStruct* InStruct, MonoClass* InElementClass)
+		{
+			return InStruct == TBaseStructure<T>::Get() &&
+				InElementClass == TPropertyClass<Value, Value>::Get();
+		}
+
+		static bool IsElementClass(FProperty* InProperty, MonoClass* InElementClass)
+		{
+			if (InElementClass == FTypeBridge::GetMonoClass(InProperty))
+			{
+				return true;
+			}
+
+			// enums may also be viewed as their underlying integer type
+			if (const auto EnumProperty = CastField<FEnumProperty>(InProperty))
+			{
+				return InElementClass == FTypeBridge::GetMonoClass(EnumProperty->GetUnderlyingProperty());
+			}
+
+			if (CastField<FByteProperty>(InProperty))
+			{
+				return InElementClass == FCSharpEnvironment::GetEnvironment().GetDomain()->Get_Byte_Class();
+			}
+
+			if (const auto StructProperty = CastField<FStructProperty>(InProperty))
+			{
+				return IsValueStructClass<FVector, FVectorValue>(StructProperty->Struct, InElementClass) ||
+					IsValueStructClass<FVector2D, FVector2DValue>(StructProperty->Struct, InElementClass) ||
+					IsValueStructClass<FRotator, FRotatorValue>(StructProperty->Struct, InElementClass) ||
+					IsValueStructClass<FQuat, FQuatValue>(StructProperty->Struct, InElementClass) ||
+					IsValueStructClass<FTransform, FTransformValue>(StructProperty->Struct, InElementClass) ||
+					IsValueStructClass<FLinearColor, FLinearColorValue>(StructProperty->Struct, InElementClass);
+			}
+
+			return false;
+		}
+
+		static bool GetDataImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                  MonoReflectionType* InElementType, const int32 InTypeSize,
+		                                  void** OutData, int32* OutNum)
+		{
+			*OutData = nullptr;
+
+			*OutNum = 0;
+
+			if (const auto ArrayHelper = FCSharpEnvironment::GetEnvironment().GetContainer<FArrayHelper>(
+				InGarbageCollectionHandle))
+			{
+				const auto InnerPropertyDescriptor = ArrayHelper->GetInnerPropertyDescriptor();
+
+				const auto ElementClass = FCSharpEnvironment::GetEnvironment().GetDomain()->Type_Get_Class(
+					FCSharpEnvironment::GetEnvironment().GetDomain()->Reflection_Type_Get_Type(InElementType));
+
+				// only elements whose bytes can be read and written in place, object pointers need the registry
+				if (ArrayHelper->GetTypeSize() != InTypeSize ||
+					!(InnerPropertyDescriptor->GetPropertyFlags() & CPF_IsPlainOldData) ||
+					CastField<FObjectPropertyBase>(InnerPropertyDescriptor->GetProperty()) != nullptr ||
+					!IsElementClass(InnerPropertyDescriptor->GetProperty(), ElementClass))
+				{
+					return false;
+				}
+
+				*OutData = ArrayHelper->GetScriptArray()->GetData();
+
+				*OutNum = ArrayHelper->Num();
+
+				return true;
+			}
+
+			return false;
+		}
+
 		static void GetImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
 		                              const int32 InIndex, RETURN_BUFFER_SIGNATURE)
 		{
@@ -332,6 +406,7 @@ namespace
 				.Function("Num", NumImplementation)
 				.Function("IsEmpty", IsEmptyImplementation)
 				.Function("Max", MaxImplementation)
+				.Function("GetData", GetDataImplementation)
 				.Function("Get", GetImplementation)
 				.Function("Set", SetImplementation)
 				.Function("Find", FindImplementation)
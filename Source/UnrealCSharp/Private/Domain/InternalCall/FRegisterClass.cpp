@@ -10,14 +10,12 @@ namespace
 	struct FRegisterClass
 	{
 		static void RemoveFunctionImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
-		                                         const FGarbageCollectionHandle InName)
+		                                         const FName* InName)
 		{
 			if (const auto FoundClass = FCSharpEnvironment::GetEnvironment().GetObject<UClass>(
 				InGarbageCollectionHandle))
 			{
-				const auto Name = FCSharpEnvironment::GetEnvironment().GetString<FName>(InName);
-
-				if (const auto Function = FoundClass->FindFunctionByName(*Name))
+				if (const auto Function = FoundClass->FindFunctionByName(*InName))
 				{
 					if (Function->IsRooted())
 					{
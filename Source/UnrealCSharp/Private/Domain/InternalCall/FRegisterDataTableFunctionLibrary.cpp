@@ -9,35 +9,32 @@ namespace
 	struct FRegisterDataTableFunctionLibrary
 	{
 		static bool GetDataTableRowFromNameImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
-		                                                  const FGarbageCollectionHandle RowName, MonoObject** OutRow)
+		                                                  const FName* InRowName, MonoObject** OutRow)
 		{
-			if (const auto InRowName = FCSharpEnvironment::GetEnvironment().GetString<FName>(RowName))
+			if (InRowName->IsNone())
 			{
-				if (InRowName->IsNone())
-				{
-					return false;
-				}
+				return false;
+			}
 
-				if (const auto DataTable = FCSharpEnvironment::GetEnvironment().GetObject<
-					UDataTable>(InGarbageCollectionHandle))
-				{
-					FCSharpEnvironment::GetEnvironment().Bind<false>(DataTable->RowStruct.Get());
+			if (const auto DataTable = FCSharpEnvironment::GetEnvironment().GetObject<
+				UDataTable>(InGarbageCollectionHandle))
+			{
+				FCSharpEnvironment::GetEnvironment().Bind<false>(DataTable->RowStruct.Get());
 
-					if (const auto ClassDescriptor = FCSharpEnvironment::GetEnvironment().GetClassDescriptor(
-						DataTable->RowStruct.Get()))
-					{
-						*OutRow = FCSharpEnvironment::GetEnvironment().GetDomain()->
-						                                               Object_Init(ClassDescriptor->GetMonoClass());
+				if (const auto ClassDescriptor = FCSharpEnvironment::GetEnvironment().GetClassDescriptor(
+					DataTable->RowStruct.Get()))
+				{
+					*OutRow = FCSharpEnvironment::GetEnvironment().GetDomain()->
+					                                               Object_Init(ClassDescriptor->GetMonoClass());
 
-						const auto FindRowData = *DataTable->GetRowMap().Find(*InRowName);
+					const auto FindRowData = *DataTable->GetRowMap().Find(*InRowName);
 
-						const auto OutRowData = FCSharpEnvironment::GetEnvironment().GetStruct<>(
-							*FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(*OutRow));
+					const auto OutRowData = FCSharpEnvironment::GetEnvironment().GetStruct<>(
+						*FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(*OutRow));
 
-						DataTable->RowStruct->CopyScriptStruct(OutRowData, FindRowData);
+					DataTable->RowStruct->CopyScriptStruct(OutRowData, FindRowData);
 
-						return true;
-					}
+					return true;
 				}
 			}
 
@@ -4,7 +4,7 @@
 #include "Reflection/Delegate/FDelegateHelper.h"
 #include "CoreMacro/BufferMacro.h"
 #include "CoreMacro/NamespaceMacro.h"
-#include "Async/Async.h"
+#include "Domain/FReleaseQueue.h"
 
 namespace
 {
@@ -17,10 +17,10 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
+			FReleaseQueue::Enqueue(InGarbageCollectionHandle, [](const FGarbageCollectionHandle& InReleaseHandle)
 			{
 				(void)FCSharpEnvironment::GetEnvironment().RemoveDelegateReference<FDelegateHelper>(
-					InGarbageCollectionHandle);
+					InReleaseHandle);
 			});
 		}
 
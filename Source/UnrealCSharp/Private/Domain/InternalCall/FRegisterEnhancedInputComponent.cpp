@@ -151,7 +151,7 @@ namespace
 		                                            const FGarbageCollectionHandle
 		                                            InBlueprintEnhancedInputActionBinding,
 		                                            const FGarbageCollectionHandle InObjectToBindTo,
-		                                            const FGarbageCollectionHandle InFunctionNameToBind)
+		                                            const FName* InFunctionNameToBind)
 		{
 			if (const auto FoundObject = FCSharpEnvironment::GetEnvironment().GetObject<UEnhancedInputComponent>(
 				InGarbageCollectionHandle))
@@ -168,8 +168,7 @@ namespace
 					FunctionNameToBind
 				);
 
-				BindActionFunction(ObjectToBindTo->GetClass(),
-				                   FCSharpEnvironment::GetEnvironment().GetString<FName>(InFunctionNameToBind));
+				BindActionFunction(ObjectToBindTo->GetClass(), InFunctionNameToBind);
 
 				const auto FoundMonoClass = TPropertyClass<
 					FEnhancedInputActionEventBinding, FEnhancedInputActionEventBinding>::Get();
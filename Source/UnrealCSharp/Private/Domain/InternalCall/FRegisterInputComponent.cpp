@@ -43,7 +43,7 @@ namespace
 		static void BindImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
 		                               const FGarbageCollectionHandle InInputDelegateBinding,
 		                               const FGarbageCollectionHandle InObjectToBindTo,
-		                               const FGarbageCollectionHandle InFunctionNameToBind,
+		                               const FName* InFunctionNameToBind,
 		                               const TFunction<void(UClass*, const FName*)>& InFunction
 		)
 		{
@@ -57,15 +57,14 @@ namespace
 
 				InputDelegateBinding->BindToInputComponent(FoundObject, ObjectToBindTo);
 
-				InFunction(ObjectToBindTo->GetClass(),
-				           FCSharpEnvironment::GetEnvironment().GetString<FName>(InFunctionNameToBind));
+				InFunction(ObjectToBindTo->GetClass(), InFunctionNameToBind);
 			}
 		}
 
 		static void BindActionImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
 		                                     const FGarbageCollectionHandle InInputActionDelegateBinding,
 		                                     const FGarbageCollectionHandle InObjectToBindTo,
-		                                     const FGarbageCollectionHandle InFunctionNameToBind)
+		                                     const FName* InFunctionNameToBind)
 		{
 			BindImplementation<UInputActionDelegateBinding>(
 				InGarbageCollectionHandle,
@@ -97,7 +96,7 @@ namespace
 		static void BindAxisImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
 		                                   const FGarbageCollectionHandle InInputAxisDelegateBinding,
 		                                   const FGarbageCollectionHandle InObjectToBindTo,
-		                                   const FGarbageCollectionHandle InFunctionNameToBind)
+		                                   const FName* InFunctionNameToBind)
 		{
 			BindImplementation<UInputAxisDelegateBinding>(
 				InGarbageCollectionHandle,
@@ -121,7 +120,7 @@ namespace
 		static void BindAxisKeyImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
 		                                      const FGarbageCollectionHandle InInputAxisKeyDelegateBinding,
 		                                      const FGarbageCollectionHandle InObjectToBindTo,
-		                                      const FGarbageCollectionHandle InFunctionNameToBind)
+		                                      const FName* InFunctionNameToBind)
 		{
 			BindImplementation<UInputAxisKeyDelegateBinding>(
 				InGarbageCollectionHandle,
@@ -145,7 +144,7 @@ namespace
 		static void BindKeyImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
 		                                  const FGarbageCollectionHandle InInputKeyDelegateBinding,
 		                                  const FGarbageCollectionHandle InObjectToBindTo,
-		                                  const FGarbageCollectionHandle InFunctionNameToBind)
+		                                  const FName* InFunctionNameToBind)
 		{
 			BindImplementation<UInputKeyDelegateBinding>(
 				InGarbageCollectionHandle,
@@ -176,7 +175,7 @@ namespace
 		static void BindTouchImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
 		                                    const FGarbageCollectionHandle InInputTouchDelegateBinding,
 		                                    const FGarbageCollectionHandle InObjectToBindTo,
-		                                    const FGarbageCollectionHandle InFunctionNameToBind)
+		                                    const FName* InFunctionNameToBind)
 		{
 			BindImplementation<UInputTouchDelegateBinding>(
 				InGarbageCollectionHandle,
@@ -223,7 +222,7 @@ namespace
 		static void BindVectorAxisImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
 		                                         const FGarbageCollectionHandle InInputVectorAxisDelegateBinding,
 		                                         const FGarbageCollectionHandle InObjectToBindTo,
-		                                         const FGarbageCollectionHandle InFunctionNameToBind)
+		                                         const FName* InFunctionNameToBind)
 		{
 			BindImplementation<UInputVectorAxisDelegateBinding>(
 				InGarbageCollectionHandle,
@@ -1,5 +1,6 @@
 ﻿#include "Binding/Class/TBindingClassBuilder.inl"
 #include "Binding/ScriptStruct/TScriptStruct.inl"
+#include "Binding/ScriptStruct/TValueStruct.inl"
 #include "Binding/ScriptStruct/TScriptStruct.inl"
 #include "Macro/NamespaceMacro.h"
 #include "FRegisterForceInit.h"
@@ -18,9 +19,16 @@ namespace
 			return &In != nullptr ? In / Scalar : decltype(In / Scalar)();
 		}
 
+		static FLinearColorValue ToValueImplementation(const FLinearColor& In)
+		{
+			return &In != nullptr ? FLinearColorValue(In) : FLinearColorValue();
+		}
+
 		FRegisterLinearColor()
 		{
 			TBindingClassBuilder<FLinearColor>(NAMESPACE_BINDING)
+				.Constructor(BINDING_CONSTRUCTOR(FLinearColor, const FLinearColorValue&),
+				             TArray<FString>{"InValue"})
 				.Constructor(BINDING_CONSTRUCTOR(FLinearColor, EForceInit))
 				.Constructor(BINDING_CONSTRUCTOR(FLinearColor, float, float, float, float),
 				             TArray<FString>{"InR", "InG", "InB", "InA"})
@@ -82,7 +90,8 @@ namespace
 				.Function("ToString", BINDING_FUNCTION(&FLinearColor::ToString,
 				                                       EFunctionInteract::New))
 				.Function("InitFromString", BINDING_FUNCTION(&FLinearColor::InitFromString,
-				                                             TArray<FString>{"InSourceString"}));
+				                                             TArray<FString>{"InSourceString"}))
+				.Function("ToValue", BINDING_FUNCTION(&ToValueImplementation));
 		}
 	};
 
@@ -5,7 +5,7 @@
 #include "Reflection/Container/FMapHelper.h"
 #include "CoreMacro/BufferMacro.h"
 #include "CoreMacro/NamespaceMacro.h"
-#include "Async/Async.h"
+#include "Domain/FReleaseQueue.h"
 
 namespace
 {
@@ -20,10 +20,10 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
+			FReleaseQueue::Enqueue(InGarbageCollectionHandle, [](const FGarbageCollectionHandle& InReleaseHandle)
 			{
 				(void)FCSharpEnvironment::GetEnvironment().RemoveContainerReference<FMapHelper>(
-					InGarbageCollectionHandle);
+					InReleaseHandle);
 			});
 		}
 
@@ -3,7 +3,7 @@
 #include "Binding/Class/FClassBuilder.h"
 #include "Environment/FCSharpEnvironment.h"
 #include "CoreMacro/NamespaceMacro.h"
-#include "Async/Async.h"
+#include "Domain/FReleaseQueue.h"
 #include "Reflection/Optional/FOptionalHelper.h"
 #include "UObject/PropertyOptional.h"
 
@@ -67,9 +67,9 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
+			FReleaseQueue::Enqueue(InGarbageCollectionHandle, [](const FGarbageCollectionHandle& InReleaseHandle)
 			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveOptionalReference(InGarbageCollectionHandle);
+				(void)FCSharpEnvironment::GetEnvironment().RemoveOptionalReference(InReleaseHandle);
 			});
 		}
 
@@ -67,13 +67,118 @@ namespace
 			}
 		}
 
+		static uint32 CreatePropertyListImplementation(const uint32* InPropertyHashes, const int32 InNum,
+		                                               int32* OutOffsets, int32* OutBufferSize)
+		{
+			*OutBufferSize = 0;
+
+			if (InPropertyHashes == nullptr || InNum <= 0)
+			{
+				return 0;
+			}
+
+			const auto PropertyList = FCSharpEnvironment::GetEnvironment().AddPropertyListDescriptor(
+				TArray<uint32>(InPropertyHashes, InNum));
+
+			if (const auto PropertyListDescriptor = FCSharpEnvironment::GetEnvironment().
+				GetPropertyListDescriptor(PropertyList))
+			{
+				if (OutOffsets != nullptr)
+				{
+					FMemory::Memcpy(OutOffsets, PropertyListDescriptor->GetOffsets().GetData(),
+					                InNum * sizeof(int32));
+				}
+
+				*OutBufferSize = PropertyListDescriptor->GetBufferSize();
+			}
+
+			return PropertyList;
+		}
+
+		static bool GetObjectPropertiesImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                              const uint32 InPropertyList, RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FoundAddress = FCSharpEnvironment::GetEnvironment().GetAddress<
+				UObject, void*>(InGarbageCollectionHandle))
+			{
+				if (const auto PropertyListDescriptor = FCSharpEnvironment::GetEnvironment().
+					GetPropertyListDescriptor(InPropertyList))
+				{
+					return PropertyListDescriptor->Get(FoundAddress, RETURN_BUFFER);
+				}
+
+				return false;
+			}
+
+			return true;
+		}
+
+		static bool SetObjectPropertiesImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                              const uint32 InPropertyList, IN_BUFFER_SIGNATURE)
+		{
+			if (const auto FoundAddress = FCSharpEnvironment::GetEnvironment().GetAddress<
+				UObject, void*>(InGarbageCollectionHandle))
+			{
+				if (const auto PropertyListDescriptor = FCSharpEnvironment::GetEnvironment().
+					GetPropertyListDescriptor(InPropertyList))
+				{
+					return PropertyListDescriptor->Set(IN_BUFFER, FoundAddress);
+				}
+
+				return false;
+			}
+
+			return true;
+		}
+
+		static bool GetStructPropertiesImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                              const uint32 InPropertyList, RETURN_BUFFER_SIGNATURE)
+		{
+			if (const auto FoundAddress = FCSharpEnvironment::GetEnvironment().GetAddress<
+				UScriptStruct, void*>(InGarbageCollectionHandle))
+			{
+				if (const auto PropertyListDescriptor = FCSharpEnvironment::GetEnvironment().
+					GetPropertyListDescriptor(InPropertyList))
+				{
+					return PropertyListDescriptor->Get(FoundAddress, RETURN_BUFFER);
+				}
+
+				return false;
+			}
+
+			return true;
+		}
+
+		static bool SetStructPropertiesImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle,
+		                                              const uint32 InPropertyList, IN_BUFFER_SIGNATURE)
+		{
+			if (const auto FoundAddress = FCSharpEnvironment::GetEnvironment().GetAddress<
+				UScriptStruct, void*>(InGarbageCollectionHandle))
+			{
+				if (const auto PropertyListDescriptor = FCSharpEnvironment::GetEnvironment().
+					GetPropertyListDescriptor(InPropertyList))
+				{
+					return PropertyListDescriptor->Set(IN_BUFFER, FoundAddress);
+				}
+
+				return false;
+			}
+
+			return true;
+		}
+
 		FRegisterProperty()
 		{
 			FClassBuilder(TEXT("FProperty"), NAMESPACE_LIBRARY)
 				.Function("GetObjectProperty", GetObjectPropertyImplementation)
 				.Function("SetObjectProperty", SetObjectPropertyImplementation)
 				.Function("GetStructProperty", GetStructPropertyImplementation)
-				.Function("SetStructProperty", SetStructPropertyImplementation);
+				.Function("SetStructProperty", SetStructPropertyImplementation)
+				.Function("CreatePropertyList", CreatePropertyListImplementation)
+				.Function("GetObjectProperties", GetObjectPropertiesImplementation)
+				.Function("SetObjectProperties", SetObjectPropertiesImplementation)
+				.Function("GetStructProperties", GetStructPropertiesImplementation)
+				.Function("SetStructProperties", SetStructPropertiesImplementation);
 		}
 	};
 
@@ -1,5 +1,6 @@
 ﻿#include "Binding/Class/TBindingClassBuilder.inl"
 #include "Binding/ScriptStruct/TScriptStruct.inl"
+#include "Binding/ScriptStruct/TValueStruct.inl"
 #include "Macro/NamespaceMacro.h"
 #include "FRegisterForceInit.h"
 
@@ -37,9 +38,16 @@ namespace
 			return &In != nullptr && (&Q != nullptr) ? In | Q : decltype(In | Q)();
 		}
 
+		static FQuatValue ToValueImplementation(const FQuat& In)
+		{
+			return &In != nullptr ? FQuatValue(In) : FQuatValue();
+		}
+
 		FRegisterQuat()
 		{
 			TBindingClassBuilder<FQuat>(NAMESPACE_BINDING)
+				.Constructor(BINDING_CONSTRUCTOR(FQuat, const FQuatValue&),
+				             TArray<FString>{"InValue"})
 				.Constructor(BINDING_CONSTRUCTOR(FQuat, EForceInit))
 				.Constructor(BINDING_CONSTRUCTOR(FQuat, FQuat::FReal, FQuat::FReal, FQuat::FReal, FQuat::FReal),
 				             TArray<FString>{"InX", "InY", "InZ", "InW"})
@@ -152,7 +160,8 @@ namespace
 				                                            "Alpha"}))
 				.Function("CalcTangents", BINDING_FUNCTION(&FQuat::CalcTangents,
 				                                           TArray<FString>{"PrevP", "P", "NextP", "Tension",
-				                                           "OutTan"}));
+				                                           "OutTan"}))
+				.Function("ToValue", BINDING_FUNCTION(&ToValueImplementation));
 		}
 	};
 
@@ -1,5 +1,6 @@
 ﻿#include "Binding/Class/TBindingClassBuilder.inl"
 #include "Binding/ScriptStruct/TScriptStruct.inl"
+#include "Binding/ScriptStruct/TValueStruct.inl"
 #include "Macro/NamespaceMacro.h"
 #include "FRegisterForceInit.h"
 
@@ -22,9 +23,16 @@ namespace
 			return &In != nullptr ? In * Scale : decltype(In * Scale)();
 		}
 
+		static FRotatorValue ToValueImplementation(const FRotator& In)
+		{
+			return &In != nullptr ? FRotatorValue(In) : FRotatorValue();
+		}
+
 		FRegisterRotator()
 		{
 			TBindingClassBuilder<FRotator>(NAMESPACE_BINDING)
+				.Constructor(BINDING_CONSTRUCTOR(FRotator, const FRotatorValue&),
+				             TArray<FString>{"InValue"})
 				.Constructor(BINDING_CONSTRUCTOR(FRotator, FRotator::FReal),
 				             TArray<FString>{"InF"})
 				.Constructor(BINDING_CONSTRUCTOR(FRotator, FRotator::FReal, FRotator::FReal, FRotator::FReal),
@@ -91,7 +99,8 @@ namespace
 				.Function("DecompressAxisFromShort", BINDING_FUNCTION(&FRotator::DecompressAxisFromShort,
 				                                                      TArray<FString>{"Angle"}))
 				.Function("MakeFromEuler", BINDING_FUNCTION(&FRotator::MakeFromEuler,
-				                                            TArray<FString>{"Euler"}));
+				                                            TArray<FString>{"Euler"}))
+				.Function("ToValue", BINDING_FUNCTION(&ToValueImplementation));
 		}
 	};
 
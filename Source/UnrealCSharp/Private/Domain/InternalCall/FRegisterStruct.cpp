@@ -2,7 +2,7 @@
 #include "Environment/FCSharpEnvironment.h"
 #include "CoreMacro/NamespaceMacro.h"
 #include "CoreMacro/CompilerMacro.h"
-#include "Async/Async.h"
+#include "Domain/FReleaseQueue.h"
 
 PRAGMA_DISABLE_DANGLING_WARNINGS
 
@@ -49,9 +49,9 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
+			FReleaseQueue::Enqueue(InGarbageCollectionHandle, [](const FGarbageCollectionHandle& InReleaseHandle)
 			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveStructReference(InGarbageCollectionHandle);
+				(void)FCSharpEnvironment::GetEnvironment().RemoveStructReference(InReleaseHandle);
 			});
 		}
 
@@ -2,7 +2,7 @@
 #include "Environment/FCSharpEnvironment.h"
 #include "CoreMacro/NamespaceMacro.h"
 #include "CoreMacro/CompilerMacro.h"
-#include "Async/Async.h"
+#include "Domain/FReleaseQueue.h"
 
 PRAGMA_DISABLE_DANGLING_WARNINGS
 
@@ -53,9 +53,9 @@ namespace
 
 		static void UnRegisterImplementation(const FGarbageCollectionHandle InGarbageCollectionHandle)
 		{
-			AsyncTask(ENamedThreads::GameThread, [InGarbageCollectionHandle]
+			FReleaseQueue::Enqueue(InGarbageCollectionHandle, [](const FGarbageCollectionHandle& InReleaseHandle)
 			{
-				(void)FCSharpEnvironment::GetEnvironment().RemoveStringReference<FText>(InGarbageCollectionHandle);
+				(void)FCSharpEnvironment::GetEnvironment().RemoveStringReference<FText>(InReleaseHandle);
 			});
 		}
 
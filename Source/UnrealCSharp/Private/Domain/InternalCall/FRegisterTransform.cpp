@@ -1,5 +1,6 @@
 ﻿#include "Binding/Class/TBindingClassBuilder.inl"
 #include "Binding/ScriptStruct/TScriptStruct.inl"
+#include "Binding/ScriptStruct/TValueStruct.inl"
 #include "Macro/NamespaceMacro.h"
 
 namespace
@@ -11,9 +12,16 @@ namespace
 			return &In != nullptr && (&Other != nullptr) ? In * Other : decltype(In * Other)();
 		}
 
+		static FTransformValue ToValueImplementation(const FTransform& In)
+		{
+			return &In != nullptr ? FTransformValue(In) : FTransformValue();
+		}
+
 		FRegisterTransform()
 		{
 			TBindingClassBuilder<FTransform>(NAMESPACE_BINDING)
+				.Constructor(BINDING_CONSTRUCTOR(FTransform, const FTransformValue&),
+				             TArray<FString>{"InValue"})
 				.Constructor(BINDING_CONSTRUCTOR(FTransform, FVector),
 				             TArray<FString>{"InTranslation"})
 				.Constructor(BINDING_CONSTRUCTOR(FTransform, FRotator),
@@ -175,7 +183,8 @@ namespace
 				.Function("CopyTranslationAndScale3D", BINDING_FUNCTION(&FTransform::CopyTranslationAndScale3D,
 				                                                        TArray<FString>{"SrcBA"}))
 				.Function("SetFromMatrix", BINDING_FUNCTION(&FTransform::SetFromMatrix,
-				                                            TArray<FString>{"InMatrix"}));
+				                                            TArray<FString>{"InMatrix"}))
+				.Function("ToValue", BINDING_FUNCTION(&ToValueImplementation));
 		}
 	};
 
@@ -43,7 +43,7 @@ namespace
 	{
 		static MonoObject* NewObjectImplementation(const FGarbageCollectionHandle Outer,
 		                                           const FGarbageCollectionHandle Class,
-		                                           const FGarbageCollectionHandle Name,
+		                                           const FName* Name,
 		                                           const EObjectFlags Flags,
 		                                           const FGarbageCollectionHandle Template,
 		                                           const bool bCopyTransientsFromClassDefaults)
@@ -52,13 +52,11 @@ namespace
 
 			const auto ObjectClass = FCSharpEnvironment::GetEnvironment().GetObject<UClass>(Class);
 
-			const auto ObjectName = FCSharpEnvironment::GetEnvironment().GetString<FName>(Name);
-
 			const auto ObjectTemplate = FCSharpEnvironment::GetEnvironment().GetObject(Template);
 
 			const auto Object = NewObject<UObject>(ObjectOuter,
 			                                       ObjectClass,
-			                                       *ObjectName,
+			                                       *Name,
 			                                       Flags,
 			                                       ObjectTemplate,
 			                                       bCopyTransientsFromClassDefaults);
@@ -68,17 +66,15 @@ namespace
 
 		static MonoObject* DuplicateObjectImplementation(const FGarbageCollectionHandle SourceObject,
 		                                                 const FGarbageCollectionHandle Outer,
-		                                                 const FGarbageCollectionHandle Name)
+		                                                 const FName* Name)
 		{
 			const auto ObjectSourceObject = FCSharpEnvironment::GetEnvironment().GetObject(SourceObject);
 
 			const auto ObjectOuter = FCSharpEnvironment::GetEnvironment().GetObject(Outer);
 
-			const auto ObjectName = FCSharpEnvironment::GetEnvironment().GetString<FName>(Name);
-
 			const auto Object = DuplicateObject<UObject>(ObjectSourceObject,
 			                                             ObjectOuter,
-			                                             *ObjectName);
+			                                             *Name);
 
 			return FCSharpEnvironment::GetEnvironment().Bind(Object);
 		}
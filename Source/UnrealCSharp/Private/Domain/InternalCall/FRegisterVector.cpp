@@ -1,5 +1,6 @@
 ﻿#include "Binding/Class/TBindingClassBuilder.inl"
 #include "Binding/ScriptStruct/TScriptStruct.inl"
+#include "Binding/ScriptStruct/TValueStruct.inl"
 #include "Macro/NamespaceMacro.h"
 
 namespace
@@ -86,9 +87,16 @@ namespace
 			return &In != nullptr ? In / Scale : decltype(In / Scale)();
 		}
 
+		static FVectorValue ToValueImplementation(const FVector& In)
+		{
+			return &In != nullptr ? FVectorValue(In) : FVectorValue();
+		}
+
 		FRegisterVector()
 		{
 			TBindingClassBuilder<FVector>(NAMESPACE_BINDING)
+				.Constructor(BINDING_CONSTRUCTOR(FVector, const FVectorValue&),
+				             TArray<FString>{"InValue"})
 				.Constructor(BINDING_CONSTRUCTOR(FVector, FVector::FReal),
 				             TArray<FString>{"InF"})
 				.Constructor(BINDING_CONSTRUCTOR(FVector, FVector::FReal, FVector::FReal, FVector::FReal),
@@ -337,7 +345,8 @@ namespace
 				                                               TArray<FString>{"DegVector"}))
 				.Function("GenerateClusterCenters", BINDING_FUNCTION(&FVector::GenerateClusterCenters,
 				                                                     TArray<FString>{"Clusters", "Points",
-				                                                     "NumIterations", "NumConnectionsToBeValid"}));
+				                                                     "NumIterations", "NumConnectionsToBeValid"}))
+				.Function("ToValue", BINDING_FUNCTION(&ToValueImplementation));
 		}
 	};
 
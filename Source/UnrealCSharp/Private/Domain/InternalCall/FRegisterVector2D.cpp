@@ -1,5 +1,6 @@
 ﻿#include "Binding/Class/TBindingClassBuilder.inl"
 #include "Binding/ScriptStruct/TScriptStruct.inl"
+#include "Binding/ScriptStruct/TValueStruct.inl"
 #include "Macro/NamespaceMacro.h"
 #include "FRegisterForceInit.h"
 #include "UEVersion.h"
@@ -53,9 +54,16 @@ namespace
 			return &In != nullptr && (&V != nullptr) ? In ^ V : decltype(In ^ V)();
 		}
 
+		static FVector2DValue ToValueImplementation(const FVector2D& In)
+		{
+			return &In != nullptr ? FVector2DValue(In) : FVector2DValue();
+		}
+
 		FRegisterVector2D()
 		{
 			TBindingClassBuilder<FVector2D>(NAMESPACE_BINDING)
+				.Constructor(BINDING_CONSTRUCTOR(FVector2D, const FVector2DValue&),
+				             TArray<FString>{"InValue"})
 				.Constructor(BINDING_CONSTRUCTOR(FVector2D, FVector2D::FReal, FVector2D::FReal),
 				             TArray<FString>{"InX", "InY"})
 				.Constructor(BINDING_CONSTRUCTOR(FVector2D, FVector2D::FReal),
@@ -175,7 +183,8 @@ namespace
 				.Function("InitFromString", BINDING_FUNCTION(&FVector2D::InitFromString,
 				                                             TArray<FString>{"InSourceString"}))
 				.Function("ContainsNaN", BINDING_FUNCTION(&FVector2D::ContainsNaN))
-				.Function("SphericalToUnitCartesian", BINDING_FUNCTION(&FVector2D::SphericalToUnitCartesian));
+				.Function("SphericalToUnitCartesian", BINDING_FUNCTION(&FVector2D::SphericalToUnitCartesian))
+				.Function("ToValue", BINDING_FUNCTION(&ToValueImplementation));
 		}
 	};
 
@@ -2,50 +2,15 @@
 #include "Binding/Class/FClassBuilder.h"
 #include "CoreMacro/NamespaceMacro.h"
 #include "Domain/FMonoDomain.h"
-#include "Tasks/Task.h"
+#include "Domain/FManagedWorkerPool.h"
+#include "Async/Async.h"
 #include "Misc/ScopeLock.h"
+#include "Tasks/Task.h"
 
 namespace
 {
 	struct FTasks
 	{
-		struct FManagedJobScope
-		{
-			explicit FManagedJobScope()
-				: bEntered(FMonoDomain::TryEnterManagedJobExecution())
-				, bDetachOnExit(FMonoDomain::ShouldDetachAfterManagedJob() && !IsInGameThread())
-			{
-				if (bEntered)
-				{
-					FMonoDomain::EnsureThreadAttached();
-				}
-			}
-
-			~FManagedJobScope()
-			{
-				if (!bEntered)
-				{
-					return;
-				}
-
-				if (bDetachOnExit)
-				{
-					FMonoDomain::EnsureThreadDetached();
-				}
-
-				FMonoDomain::LeaveManagedJobExecution();
-			}
-
-			bool IsEntered() const
-			{
-				return bEntered;
-			}
-
-		private:
-			bool bEntered = false;
-			bool bDetachOnExit = false;
-		};
-
 		struct FManagedThunkCache
 		{
 			FCriticalSection Mutex;
@@ -128,62 +93,224 @@ namespace
 				return;
 			}
 
-			TArray<UE::Tasks::FTask> Tasks;
-			Tasks.Reserve(InTaskCount);
-
 			void* const StateHandle = const_cast<void*>(InStateHandle);
 
-			for (int32 TaskIndex = 0; TaskIndex < InTaskCount; ++TaskIndex)
+			using FExecuteTaskThunk = void (*)(void*, int32, MonoObject**);
+			const auto Thunk = reinterpret_cast<FExecuteTaskThunk>(InExecuteTaskThunk);
+
+			// 常驻 worker 线程保持 attach，按区间批量执行，避免每个 index 一次 task 投递与 attach/detach。
+			FManagedWorkerPool::ParallelFor(InTaskCount, 0, [StateHandle, Thunk](const int32 InBegin, const int32 InEnd)
 			{
-				UE::Tasks::FTask Task;
-				Task.Launch(TEXT("UETasks.ExecuteBatch"), [StateHandle, TaskIndex, InExecuteTaskThunk]()
+				for (int32 TaskIndex = InBegin; TaskIndex < InEnd; ++TaskIndex)
 				{
-					FManagedJobScope ManagedScope;
+					MonoObject* Exception = nullptr;
 
-					if (!ManagedScope.IsEntered())
+					Thunk(StateHandle, TaskIndex, &Exception);
+
+					if (Exception != nullptr)
 					{
-						return;
+						FMonoDomain::Unhandled_Exception(Exception);
 					}
+				}
+			}, bWait);
+		}
 
-					void* StateHandleParam = StateHandle;
+		static void* GetExecuteTaskThunk()
+		{
+			static FManagedThunkCache ExecuteCache;
+			return GetManagedThunkCached(ExecuteCache, TEXT("UETasksBatch"), TEXT("ExecuteTask"), 2);
+		}
 
-					int32 IndexParam = TaskIndex;
+		static void ExecuteBatchImplementation(const void* InStateHandle,
+		                                       const int32 InTaskCount,
+		                                       const bool bWait)
+		{
+			ExecuteBatchWithThunk(InStateHandle, InTaskCount, bWait, GetExecuteTaskThunk());
+		}
 
-					using FExecuteTaskThunk = void (*)(void*, int32, MonoObject**);
-					const auto Thunk = reinterpret_cast<FExecuteTaskThunk>(InExecuteTaskThunk);
+		// launched batches that have not finished yet, a handle that is no longer here has completed
+		struct FLaunchedBatches
+		{
+			FCriticalSection Mutex;
+			TMap<uint64, UE::Tasks::FTask> Tasks;
+			// batches whose body could not enter managed code, whoever removes the entry cancels the handle
+			TMap<uint64, void*> Skipped;
+			uint64 NextHandle = 0;
+		};
 
-					MonoObject* Exception = nullptr;
+		static FLaunchedBatches& GetLaunchedBatches()
+		{
+			static FLaunchedBatches LaunchedBatches;
+			return LaunchedBatches;
+		}
 
-					Thunk(StateHandleParam, IndexParam, &Exception);
+		static uint64 LaunchBatchImplementation(const void* InStateHandle,
+		                                        const int32 InTaskCount,
+		                                        const uint64* InPrerequisites,
+		                                        const int32 InPrerequisiteCount)
+		{
+			if (!FMonoDomain::bLoadSucceed || FMonoDomain::Domain == nullptr)
+			{
+				return 0;
+			}
 
-					if (Exception != nullptr)
-					{
-						FMonoDomain::Unhandled_Exception(Exception);
-					}
-				});
+			if (!FMonoDomain::IsManagedJobExecutionEnabled())
+			{
+				return 0;
+			}
+
+			static FManagedThunkCache CompleteCache;
+			const auto CompleteThunk = GetManagedThunkCached(CompleteCache, TEXT("UETasksBatch"), TEXT("CompleteTask"),
+			                                                 1);
+			static FManagedThunkCache CancelCache;
+			const auto CancelThunk = GetManagedThunkCached(CancelCache, TEXT("UETasksBatch"), TEXT("CancelTask"), 1);
+			const auto ExecuteThunk = GetExecuteTaskThunk();
 
-				Tasks.Add(MoveTemp(Task));
+			if (ExecuteThunk == nullptr || CompleteThunk == nullptr || CancelThunk == nullptr)
+			{
+				return 0;
 			}
 
-			if (bWait)
+			auto& LaunchedBatches = GetLaunchedBatches();
+
+			// held across Launch so the body can not remove its handle before it has been added
+			FScopeLock ScopeLock(&LaunchedBatches.Mutex);
+
+			TArray<UE::Tasks::FTask> Prerequisites;
+
+			for (int32 Index = 0; Index < InPrerequisiteCount; ++Index)
 			{
-				UE::Tasks::Wait(Tasks);
+				if (const auto FoundTask = LaunchedBatches.Tasks.Find(InPrerequisites[Index]))
+				{
+					Prerequisites.Add(*FoundTask);
+				}
 			}
+
+			const auto Handle = ++LaunchedBatches.NextHandle;
+
+			void* const StateHandle = const_cast<void*>(InStateHandle);
+
+			LaunchedBatches.Tasks.Add(Handle, UE::Tasks::Launch(TEXT("UETasksBatch.Launch"),
+				[StateHandle, InTaskCount, ExecuteThunk, CompleteThunk, CancelThunk, Handle]()
+				{
+					if (FMonoDomain::TryEnterManagedJobExecution())
+					{
+						const auto bDetachOnExit = FMonoDomain::ShouldDetachAfterManagedJob() && !IsInGameThread();
+
+						FMonoDomain::EnsureThreadAttached();
+
+						ExecuteBatchWithThunk(StateHandle, InTaskCount, true, ExecuteThunk);
+
+						using FCompleteTaskThunk = void (*)(void*, MonoObject**);
+
+						MonoObject* Exception = nullptr;
+
+						reinterpret_cast<FCompleteTaskThunk>(CompleteThunk)(StateHandle, &Exception);
+
+						if (Exception != nullptr)
+						{
+							FMonoDomain::Unhandled_Exception(Exception);
+						}
+
+						if (bDetachOnExit)
+						{
+							FMonoDomain::EnsureThreadDetached();
+						}
+
+						FMonoDomain::LeaveManagedJobExecution();
+					}
+					else
+					{
+						{
+							auto& Batches = GetLaunchedBatches();
+
+							FScopeLock BodyScopeLock(&Batches.Mutex);
+
+							Batches.Skipped.Add(Handle, StateHandle);
+						}
+
+						// the game thread is attached, the handle is cancelled there unless Wait got to it first
+						AsyncTask(ENamedThreads::GameThread, [CancelThunk, Handle]()
+						{
+							void* SkippedStateHandle = nullptr;
+
+							{
+								auto& Batches = GetLaunchedBatches();
+
+								FScopeLock GameThreadScopeLock(&Batches.Mutex);
+
+								if (!Batches.Skipped.RemoveAndCopyValue(Handle, SkippedStateHandle))
+								{
+									return;
+								}
+							}
+
+							// once the domain is gone the state handle and its awaiters went with it
+							if (!FMonoDomain::bLoadSucceed || FMonoDomain::Domain == nullptr)
+							{
+								return;
+							}
+
+							using FCancelTaskThunk = void (*)(void*, MonoObject**);
+
+							MonoObject* Exception = nullptr;
+
+							reinterpret_cast<FCancelTaskThunk>(CancelThunk)(SkippedStateHandle, &Exception);
+
+							if (Exception != nullptr)
+							{
+								FMonoDomain::Unhandled_Exception(Exception);
+							}
+						});
+					}
+
+					auto& Batches = GetLaunchedBatches();
+
+					FScopeLock BodyScopeLock(&Batches.Mutex);
+
+					Batches.Tasks.Remove(Handle);
+				}, Prerequisites));
+
+			return Handle;
 		}
 
-		static void ExecuteBatchImplementation(const void* InStateHandle,
-		                                       const int32 InTaskCount,
-		                                       const bool bWait)
+		/**
+		 * Returns false when the batch never ran because managed jobs were disabled,
+		 * the caller then owns cancelling the managed handle.
+		 */
+		static bool WaitImplementation(const uint64 InHandle)
 		{
-			static FManagedThunkCache ExecuteCache;
-			const auto FoundThunk = GetManagedThunkCached(ExecuteCache, TEXT("UETasksBatch"), TEXT("ExecuteTask"), 2);
-			ExecuteBatchWithThunk(InStateHandle, InTaskCount, bWait, FoundThunk);
+			UE::Tasks::FTask Task;
+
+			{
+				auto& LaunchedBatches = GetLaunchedBatches();
+
+				FScopeLock ScopeLock(&LaunchedBatches.Mutex);
+
+				if (const auto FoundTask = LaunchedBatches.Tasks.Find(InHandle))
+				{
+					Task = *FoundTask;
+				}
+			}
+
+			if (Task.IsValid())
+			{
+				Task.Wait();
+			}
+
+			auto& LaunchedBatches = GetLaunchedBatches();
+
+			FScopeLock ScopeLock(&LaunchedBatches.Mutex);
+
+			return LaunchedBatches.Skipped.Remove(InHandle) == 0;
 		}
 
 		FTasks()
 		{
 			FClassBuilder(TEXT("FTasks"), NAMESPACE_LIBRARY)
-				.Function(TEXT("ExecuteBatch"), ExecuteBatchImplementation);
+				.Function(TEXT("ExecuteBatch"), ExecuteBatchImplementation)
+				.Function(TEXT("LaunchBatch"), LaunchBatchImplementation)
+				.Function(TEXT("Wait"), WaitImplementation);
 		}
 	};
 
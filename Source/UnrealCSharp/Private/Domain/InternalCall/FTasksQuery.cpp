@@ -2,7 +2,7 @@
 #include "Binding/Class/FClassBuilder.h"
 #include "CoreMacro/NamespaceMacro.h"
 #include "Domain/FMonoDomain.h"
-#include "Tasks/Task.h"
+#include "Domain/FManagedWorkerPool.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "Misc/ScopeLock.h"
 
@@ -10,43 +10,6 @@ namespace
 {
 	struct FTasksQuery
 	{
-		struct FManagedJobScope
-		{
-			explicit FManagedJobScope()
-				: bEntered(FMonoDomain::TryEnterManagedJobExecution())
-				, bDetachOnExit(FMonoDomain::ShouldDetachAfterManagedJob() && !IsInGameThread())
-			{
-				if (bEntered)
-				{
-					FMonoDomain::EnsureThreadAttached();
-				}
-			}
-
-			~FManagedJobScope()
-			{
-				if (!bEntered)
-				{
-					return;
-				}
-
-				if (bDetachOnExit)
-				{
-					FMonoDomain::EnsureThreadDetached();
-				}
-
-				FMonoDomain::LeaveManagedJobExecution();
-			}
-
-			bool IsEntered() const
-			{
-				return bEntered;
-			}
-
-		private:
-			bool bEntered = false;
-			bool bDetachOnExit = false;
-		};
-
 		struct FManagedThunkCache
 		{
 			FCriticalSection Mutex;
@@ -132,26 +95,15 @@ namespace
 				return;
 			}
 
-			TArray<UE::Tasks::FTask> TaskList;
-			TaskList.Reserve(InTaskCount);
-
 			void* const StateHandle = const_cast<void*>(InStateHandle);
 
-			for (int32 TaskIndex = 0; TaskIndex < InTaskCount; ++TaskIndex)
+			using FExecuteTaskThunk = void (*)(void*, int32, MonoObject**);
+			const auto Thunk = reinterpret_cast<FExecuteTaskThunk>(FoundThunk);
+
+			FManagedWorkerPool::ParallelFor(InTaskCount, 0, [StateHandle, Thunk](const int32 InBegin, const int32 InEnd)
 			{
-				UE::Tasks::FTask Task;
-				Task.Launch(TEXT("UETasksQuery.ExecuteBatch"), [StateHandle, TaskIndex, FoundThunk]()
+				for (int32 TaskIndex = InBegin; TaskIndex < InEnd; ++TaskIndex)
 				{
-					FManagedJobScope ManagedScope;
-
-					if (!ManagedScope.IsEntered())
-					{
-						return;
-					}
-
-					using FExecuteTaskThunk = void (*)(void*, int32, MonoObject**);
-					const auto Thunk = reinterpret_cast<FExecuteTaskThunk>(FoundThunk);
-
 					MonoObject* Exception = nullptr;
 					Thunk(StateHandle, TaskIndex, &Exception);
 
@@ -159,15 +111,8 @@ namespace
 					{
 						FMonoDomain::Unhandled_Exception(Exception);
 					}
-				});
-
-				TaskList.Add(MoveTemp(Task));
-			}
-
-			if (bWait)
-			{
-				UE::Tasks::Wait(TaskList);
-			}
+				}
+			}, bWait);
 		}
 
 		static int32 GetNumWorkerThreadsImplementation()
@@ -3,6 +3,7 @@
 #include "CoreMacro/NamespaceMacro.h"
 #include "Domain/FMonoDomain.h"
 #include "Tasks/Task.h"
+#include "Domain/FManagedWorkerPool.h"
 #include "Misc/ScopeLock.h"
 #include "HAL/PlatformTLS.h"
 #include "Log/UnrealCSharpLog.h"
@@ -198,55 +199,23 @@ namespace
 			const int32 SafeTaskCount = FMath::Clamp(InTaskCount, 1, InLength);
 			const int32 ChunkSize = FMath::DivideAndRoundUp(InLength, SafeTaskCount);
 
-			TArray<UE::Tasks::FTask> TaskList;
-			TaskList.Reserve(SafeTaskCount);
-
 			void* const DataPtr = const_cast<void*>(InData);
 
-			for (int32 TaskIndex = 0; TaskIndex < SafeTaskCount; ++TaskIndex)
+			using FExecuteSliceThunk = void (*)(void*, int32, int32, MonoObject**);
+			const auto Thunk = reinterpret_cast<FExecuteSliceThunk>(FoundThunk);
+
+			// 每个区间仍是 ChunkSize 个元素，由常驻 worker 线程窃取执行。
+			FManagedWorkerPool::ParallelFor(InLength, ChunkSize, [DataPtr, Thunk](const int32 InBegin, const int32 InEnd)
 			{
-				const int32 StartIndex = TaskIndex * ChunkSize;
-				const int32 Count = FMath::Min(ChunkSize, InLength - StartIndex);
+				MonoObject* Exception = nullptr;
 
-				if (Count <= 0)
-				{
-					continue;
-				}
+				Thunk(DataPtr, InBegin, InEnd - InBegin, &Exception);
 
-				UE::Tasks::FTask Task;
-				Task.Launch(TEXT("UETasksSlice.ExecuteBatch"), [DataPtr, StartIndex, Count, FoundThunk]()
+				if (Exception != nullptr)
 				{
-					FManagedJobScope ManagedScope;
-
-					if (!ManagedScope.IsEntered())
-					{
-						return;
-					}
-
-					void* DataParam = DataPtr;
-					int32 StartParam = StartIndex;
-					int32 CountParam = Count;
-
-					using FExecuteSliceThunk = void (*)(void*, int32, int32, MonoObject**);
-					const auto Thunk = reinterpret_cast<FExecuteSliceThunk>(FoundThunk);
-
-					MonoObject* Exception = nullptr;
-
-					Thunk(DataParam, StartParam, CountParam, &Exception);
-
-					if (Exception != nullptr)
-					{
-						FMonoDomain::Unhandled_Exception(Exception);
-					}
-				});
-
-				TaskList.Add(MoveTemp(Task));
-			}
-
-			if (bWait)
-			{
-				UE::Tasks::Wait(TaskList);
-			}
+					FMonoDomain::Unhandled_Exception(Exception);
+				}
+			}, bWait);
 		}
 
 		static void ExecuteBatchWithHandlerImplementation(const void* InData,
@@ -287,51 +256,21 @@ namespace
 			const int32 SafeTaskCount = FMath::Clamp(InTaskCount, 1, InLength);
 			const int32 ChunkSize = FMath::DivideAndRoundUp(InLength, SafeTaskCount);
 
-			TArray<UE::Tasks::FTask> TaskList;
-			TaskList.Reserve(SafeTaskCount);
-
 			void* const DataPtr = const_cast<void*>(InData);
 
-			for (int32 TaskIndex = 0; TaskIndex < SafeTaskCount; ++TaskIndex)
+			using FHandlerThunk = void (*)(void*, int32, int32, MonoObject**);
+			const auto Thunk = reinterpret_cast<FHandlerThunk>(FoundThunk);
+
+			FManagedWorkerPool::ParallelFor(InLength, ChunkSize, [DataPtr, Thunk](const int32 InBegin, const int32 InEnd)
 			{
-				const int32 StartIndex = TaskIndex * ChunkSize;
-				const int32 Count = FMath::Min(ChunkSize, InLength - StartIndex);
+				MonoObject* Exception = nullptr;
+				Thunk(DataPtr, InBegin, InEnd - InBegin, &Exception);
 
-				if (Count <= 0)
+				if (Exception != nullptr)
 				{
-					continue;
+					FMonoDomain::Unhandled_Exception(Exception);
 				}
-
-				UE::Tasks::FTask Task;
-				Task.Launch(TEXT("UETasksSlice.ExecuteBatchWithHandler"), [DataPtr, StartIndex, Count, FoundThunk]()
-				{
-					FManagedJobScope ManagedScope;
-
-					if (!ManagedScope.IsEntered())
-					{
-						return;
-					}
-
-					void* DataParam = DataPtr;
-					int32 StartParam = StartIndex;
-					int32 CountParam = Count;
-
-					using FHandlerThunk = void (*)(void*, int32, int32, MonoObject**);
-					const auto Thunk = reinterpret_cast<FHandlerThunk>(FoundThunk);
-
-					MonoObject* Exception = nullptr;
-					Thunk(DataParam, StartParam, CountParam, &Exception);
-
-					if (Exception != nullptr)
-					{
-						FMonoDomain::Unhandled_Exception(Exception);
-					}
-				});
-
-				TaskList.Add(MoveTemp(Task));
-			}
-
-			UE::Tasks::Wait(TaskList);
+			}, true);
 		}
 
 		// 极简示例：C++ 接收 C# delegate（MonoObject*），在 UE::Tasks worker 线程用 Runtime_Invoke 执行它。
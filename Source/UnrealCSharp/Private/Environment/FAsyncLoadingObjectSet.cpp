@@ -0,0 +1,129 @@
+#include "Environment/FAsyncLoadingObjectSet.h"
+#include "UObject/Package.h"
+
+FAsyncLoadingObjectSet::FAsyncLoadingObjectSet():
+	NumObjects(0)
+{
+}
+
+void FAsyncLoadingObjectSet::Add(UObject* InObject, const int32 InObjectIndex)
+{
+	const auto Package = InObject->GetOutermost();
+
+	const auto PackageKey = FObjectKey(Package);
+
+	FScopeLock Lock(&CriticalSection);
+
+	if (const auto FoundObject = Objects.Find(InObjectIndex))
+	{
+		RemoveFromBucket(FoundObject->Package, InObjectIndex);
+	}
+
+	Objects.Add(InObjectIndex, {FWeakObjectPtr(InObject), PackageKey});
+
+	auto& Bucket = Packages.FindOrAdd(PackageKey);
+
+	Bucket.Package = Package;
+
+	Bucket.ObjectIndexes.Add(InObjectIndex);
+
+	NumObjects.store(Objects.Num(), std::memory_order_release);
+}
+
+void FAsyncLoadingObjectSet::Remove(const int32 InObjectIndex)
+{
+	// called for every deleted object, most of the time nothing is pending
+	if (NumObjects.load(std::memory_order_acquire) == 0)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&CriticalSection);
+
+	if (FPendingObject PendingObject; Objects.RemoveAndCopyValue(InObjectIndex, PendingObject))
+	{
+		RemoveFromBucket(PendingObject.Package, InObjectIndex);
+
+		NumObjects.store(Objects.Num(), std::memory_order_release);
+	}
+}
+
+void FAsyncLoadingObjectSet::Empty()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	Objects.Empty();
+
+	Packages.Empty();
+
+	NumObjects.store(0, std::memory_order_release);
+}
+
+int32 FAsyncLoadingObjectSet::Num() const
+{
+	return NumObjects.load(std::memory_order_acquire);
+}
+
+void FAsyncLoadingObjectSet::Flush(const TFunctionRef<bool(const UObject*)> InIsLoading,
+                                   TArray<UObject*>& OutObjects)
+{
+	if (NumObjects.load(std::memory_order_acquire) == 0)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&CriticalSection);
+
+	for (auto PackageIterator = Packages.CreateIterator(); PackageIterator; ++PackageIterator)
+	{
+		auto& Bucket = PackageIterator.Value();
+
+		if (const auto Package = Bucket.Package.Get(); Package != nullptr && InIsLoading(Package))
+		{
+			continue;
+		}
+
+		for (auto ObjectIterator = Bucket.ObjectIndexes.CreateIterator(); ObjectIterator; ++ObjectIterator)
+		{
+			const auto ObjectIndex = *ObjectIterator;
+
+			const auto FoundObject = Objects.Find(ObjectIndex);
+
+			const auto Object = FoundObject != nullptr ? FoundObject->Object.Get() : nullptr;
+
+			if (Object != nullptr)
+			{
+				if (InIsLoading(Object))
+				{
+					continue;
+				}
+
+				OutObjects.Add(Object);
+			}
+
+			Objects.Remove(ObjectIndex);
+
+			ObjectIterator.RemoveCurrent();
+		}
+
+		if (Bucket.ObjectIndexes.Num() == 0)
+		{
+			PackageIterator.RemoveCurrent();
+		}
+	}
+
+	NumObjects.store(Objects.Num(), std::memory_order_release);
+}
+
+void FAsyncLoadingObjectSet::RemoveFromBucket(const FObjectKey& InPackage, const int32 InObjectIndex)
+{
+	if (const auto FoundBucket = Packages.Find(InPackage))
+	{
+		FoundBucket->ObjectIndexes.Remove(InObjectIndex);
+
+		if (FoundBucket->ObjectIndexes.Num() == 0)
+		{
+			Packages.Remove(InPackage);
+		}
+	}
+}
@@ -6,12 +6,33 @@
 #include "CoreMacro/AccessPrivateMacro.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
 #include "Delegate/FUnrealCSharpModuleDelegates.h"
+#include "Domain/FReleaseQueue.h"
 #include "Log/UnrealCSharpLog.h"
 #include <signal.h>
 #include "UEVersion.h"
 
 ACCESS_PRIVATE_MEMBER_PROPERTY(UObjectBase, ObjectFlags, EObjectFlags)
 
+static bool IsAsyncLoading(const UObject* InObject)
+{
+	return InObject->*TAccessPrivate<UObjectBase_ObjectFlags>::Value & ~RF_AllFlags ||
+		InObject->HasAnyFlags(RF_NeedPostLoad) ||
+		InObject->HasAnyInternalFlags(
+#if UE_E_INTERNAL_OBJECT_FLAGS_ASYNC_LOADING
+			EInternalObjectFlags_AsyncLoading
+#else
+			EInternalObjectFlags::AsyncLoading
+#endif
+			| EInternalObjectFlags::Async) ||
+		InObject->GetClass()->HasAnyInternalFlags(
+#if UE_E_INTERNAL_OBJECT_FLAGS_ASYNC_LOADING
+			EInternalObjectFlags_AsyncLoading
+#else
+			EInternalObjectFlags::AsyncLoading
+#endif
+			| EInternalObjectFlags::Async);
+}
+
 #if PLATFORM_MAC
 TMap<int32, struct sigaction> SignalActions;
 #endif
@@ -72,6 +93,8 @@ void FCSharpEnvironment::Initialize()
 
 	StructRegistry = new FStructRegistry();
 
+	bEnableLazyBind = FUnrealCSharpFunctionLibrary::IsEnableLazyBind();
+
 	ContainerRegistry = new FContainerRegistry();
 
 	DelegateRegistry = new FDelegateRegistry();
@@ -137,7 +160,9 @@ void FCSharpEnvironment::Initialize()
 
 void FCSharpEnvironment::Deinitialize()
 {
-	AsyncLoadingObjectArray.Empty();
+	FReleaseQueue::Flush();
+
+	AsyncLoadingObjects.Empty();
 
 	if (OnAsyncLoadingFlushUpdateHandle.IsValid())
 	{
@@ -254,22 +279,25 @@ void FCSharpEnvironment::NotifyUObjectCreated(const UObjectBase* Object, int32 I
 	{
 		if (InObject->HasAnyFlags(EObjectFlags::RF_ClassDefaultObject))
 		{
-			FScopeLock Lock(&CriticalSection);
-
-			AsyncLoadingObjectArray.Add(InObject);
+			AsyncLoadingObjects.Add(InObject, Index);
 
 			return;
 		}
 
 		if (IsInGameThread())
 		{
-			Bind<true>(InObject);
+			if (bEnableLazyBind)
+			{
+				Bind<true>(static_cast<UStruct*>(InObject->GetClass()));
+			}
+			else
+			{
+				Bind<true>(InObject);
+			}
 		}
 		else
 		{
-			FScopeLock Lock(&CriticalSection);
-
-			AsyncLoadingObjectArray.Add(InObject);
+			AsyncLoadingObjects.Add(InObject, Index);
 		}
 	}
 }
@@ -287,11 +315,7 @@ void FCSharpEnvironment::NotifyUObjectDeleted(const UObjectBase* Object, int32 I
 			(void)RemoveObjectReference(InObject);
 		}
 
-		{
-			FScopeLock Lock(&CriticalSection);
-
-			AsyncLoadingObjectArray.Remove(InObject);
-		}
+		AsyncLoadingObjects.Remove(Index);
 	}
 }
 
@@ -311,66 +335,9 @@ void FCSharpEnvironment::OnUnrealCSharpModuleInActive()
 
 void FCSharpEnvironment::OnAsyncLoadingFlushUpdate()
 {
-	TArray<int32> RemovedIndexes;
-
 	TArray<UObject*> PendingBindObjects;
 
-	{
-		TArray<FWeakObjectPtr> LocalAsyncLoadingObjectArray;
-
-		{
-			FScopeLock Lock(&CriticalSection);
-
-			LocalAsyncLoadingObjectArray.Append(AsyncLoadingObjectArray);
-		}
-
-		for (auto i = LocalAsyncLoadingObjectArray.Num() - 1; i >= 0; --i)
-		{
-			auto ObjectPtr = LocalAsyncLoadingObjectArray[i];
-
-			if (!ObjectPtr.IsValid())
-			{
-				RemovedIndexes.Add(i);
-
-				continue;
-			}
-
-			auto Object = ObjectPtr.Get();
-
-			if (Object->*TAccessPrivate<UObjectBase_ObjectFlags>::Value & ~RF_AllFlags ||
-				Object->HasAnyFlags(RF_NeedPostLoad) ||
-				Object->HasAnyInternalFlags(
-#if UE_E_INTERNAL_OBJECT_FLAGS_ASYNC_LOADING
-					EInternalObjectFlags_AsyncLoading
-#else
-					EInternalObjectFlags::AsyncLoading
-#endif
-					| EInternalObjectFlags::Async) ||
-				Object->GetClass()->HasAnyInternalFlags(
-#if UE_E_INTERNAL_OBJECT_FLAGS_ASYNC_LOADING
-					EInternalObjectFlags_AsyncLoading
-#else
-					EInternalObjectFlags::AsyncLoading
-#endif
-					| EInternalObjectFlags::Async))
-			{
-				continue;
-			}
-
-			PendingBindObjects.Add(Object);
-
-			RemovedIndexes.Add(i);
-		}
-	}
-
-	{
-		FScopeLock Lock(&CriticalSection);
-
-		for (const auto RemovedIndex : RemovedIndexes)
-		{
-			AsyncLoadingObjectArray.RemoveAt(RemovedIndex);
-		}
-	}
+	AsyncLoadingObjects.Flush(IsAsyncLoading, PendingBindObjects);
 
 	for (const auto& PendingBindObject : PendingBindObjects)
 	{
@@ -378,6 +345,10 @@ void FCSharpEnvironment::OnAsyncLoadingFlushUpdate()
 		{
 			FCSharpBind::BindClassDefaultObject(Domain, PendingBindObject);
 		}
+		else if (bEnableLazyBind)
+		{
+			Bind<true>(static_cast<UStruct*>(PendingBindObject->GetClass()));
+		}
 		else
 		{
 			Bind<true>(PendingBindObject);
@@ -390,6 +361,16 @@ void FCSharpEnvironment::OnAsyncLoadingFlushUpdate()
 	}
 }
 
+bool FCSharpEnvironment::IsEnableLazyBind() const
+{
+	return bEnableLazyBind;
+}
+
+void FCSharpEnvironment::SetEnableLazyBind(const bool bInEnableLazyBind)
+{
+	bEnableLazyBind = bInEnableLazyBind;
+}
+
 MonoObject* FCSharpEnvironment::Bind(UObject* Object) const
 {
 	return FCSharpBind::Bind(Domain, Object);
@@ -463,6 +444,16 @@ void FCSharpEnvironment::RemovePropertyDescriptor(const uint32 InPropertyHash) c
 	}
 }
 
+uint32 FCSharpEnvironment::AddPropertyListDescriptor(const TArray<uint32>& InPropertyHashes) const
+{
+	return ClassRegistry != nullptr ? ClassRegistry->AddPropertyListDescriptor(InPropertyHashes) : 0;
+}
+
+FPropertyListDescriptor* FCSharpEnvironment::GetPropertyListDescriptor(const uint32 InPropertyList) const
+{
+	return ClassRegistry != nullptr ? ClassRegistry->GetPropertyListDescriptor(InPropertyList) : nullptr;
+}
+
 bool FCSharpEnvironment::AddObjectReference(UObject* InObject, MonoObject* InMonoObject) const
 {
 	return ObjectRegistry != nullptr ? ObjectRegistry->AddReference(InObject, InMonoObject) : false;
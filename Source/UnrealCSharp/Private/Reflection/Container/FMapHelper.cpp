@@ -87,44 +87,29 @@ void FMapHelper::Add(void* InKey, void* InValue) const
 
 int32 FMapHelper::Remove(const void* InKey) const
 {
-	auto Count = 0;
+	const auto Buffer = FMemory_Alloca_Aligned(KeyPropertyDescriptor->GetSize(),
+	                                           KeyPropertyDescriptor->GetMinAlignment());
 
-	do
-	{
-		auto KeyIndex = static_cast<int32>(INDEX_NONE);
+	const auto NativeKey = GetNativeKey(InKey, Buffer);
 
-		for (auto Index = 0; Index < ScriptMap->GetMaxIndex(); ++Index)
-		{
-			if (ScriptMap->IsValidIndex(Index))
-			{
-				if (const auto Data = static_cast<uint8*>(ScriptMap->GetData(Index, ScriptMapLayout));
-					KeyPropertyDescriptor->Identical(Data, InKey))
-				{
-					KeyIndex = Index;
+	const auto KeyIndex = FindPairIndex(NativeKey);
 
-					break;
-				}
-			}
-		}
+	ReleaseNativeKey(InKey, NativeKey);
 
-		if (KeyIndex == INDEX_NONE)
-		{
-			break;
-		}
-
-		++Count;
+	if (KeyIndex == INDEX_NONE)
+	{
+		return 0;
+	}
 
-		const auto Data = static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout));
+	const auto Data = static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout));
 
-		KeyPropertyDescriptor->DestroyValue(Data);
+	KeyPropertyDescriptor->DestroyValue(Data);
 
-		ValuePropertyDescriptor->DestroyValue(Data + ScriptMapLayout.ValueOffset);
+	ValuePropertyDescriptor->DestroyValue(Data + ScriptMapLayout.ValueOffset);
 
-		ScriptMap->RemoveAt(KeyIndex, ScriptMapLayout);
-	}
-	while (true);
+	ScriptMap->RemoveAt(KeyIndex, ScriptMapLayout);
 
-	return Count;
+	return 1;
 }
 
 void* FMapHelper::FindKey(const void* InValue) const
@@ -156,66 +141,97 @@ bool FMapHelper::Contains(const void* InKey) const
 
 void* FMapHelper::Get(const void* InKey) const
 {
-	for (auto Index = 0; Index < ScriptMap->GetMaxIndex(); ++Index)
-	{
-		if (ScriptMap->IsValidIndex(Index))
-		{
-			if (const auto Data = static_cast<uint8*>(ScriptMap->GetData(Index, ScriptMapLayout));
-				KeyPropertyDescriptor->Identical(Data, InKey))
-			{
-				return Data + ScriptMapLayout.ValueOffset;
-			}
-		}
-	}
+	const auto Buffer = FMemory_Alloca_Aligned(KeyPropertyDescriptor->GetSize(),
+	                                           KeyPropertyDescriptor->GetMinAlignment());
 
-	return nullptr;
-}
-
-void FMapHelper::Set(void* InKey, void* InValue) const
-{
-	auto KeyIndex = static_cast<int32>(INDEX_NONE);
+	const auto NativeKey = GetNativeKey(InKey, Buffer);
 
-	for (auto Index = 0; Index < ScriptMap->GetMaxIndex(); ++Index)
-	{
-		if (ScriptMap->IsValidIndex(Index))
-		{
-			if (const auto Data = static_cast<uint8*>(ScriptMap->GetData(Index, ScriptMapLayout));
-				KeyPropertyDescriptor->Identical(Data, InKey))
-			{
-				KeyIndex = Index;
+	const auto KeyIndex = FindPairIndex(NativeKey);
 
-				break;
-			}
-		}
-	}
+	ReleaseNativeKey(InKey, NativeKey);
 
-	uint8* Data;
+	return KeyIndex != INDEX_NONE
+		       ? static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout)) + ScriptMapLayout.ValueOffset
+		       : nullptr;
+}
 
-	if (KeyIndex == INDEX_NONE)
-	{
-		KeyIndex = ScriptMap->AddUninitialized(ScriptMapLayout);
+void FMapHelper::Set(void* InKey, void* InValue) const
+{
+	const auto Buffer = FMemory_Alloca_Aligned(KeyPropertyDescriptor->GetSize(),
+	                                           KeyPropertyDescriptor->GetMinAlignment());
 
-		Data = static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout));
+	const auto NativeKey = GetNativeKey(InKey, Buffer);
 
-		KeyPropertyDescriptor->Set(InKey, Data);
+	const auto KeyProperty = KeyPropertyDescriptor->GetProperty();
 
+	// an existing pair is destructed and constructed again in place, a new pair only links its own hash bucket
 #if STD_CPP_20
-		ScriptMap->Rehash(ScriptMapLayout, [=, this](const void* Src)
+	ScriptMap->Add(NativeKey, InValue, ScriptMapLayout,
+	               [=, this](const void* Src)
+	               {
+		               return KeyPropertyDescriptor->GetValueTypeHash(Src);
+	               },
+	               [=](const void* A, const void* B)
+	               {
+		               return KeyProperty->Identical(A, B);
+	               },
+	               [=, this](void* Dest)
+	               {
+		               KeyPropertyDescriptor->Set(InKey, Dest);
+	               },
+	               [=, this](void* Dest)
+	               {
+		               ValuePropertyDescriptor->Set(InValue, Dest);
+	               },
+	               [=, this](void* Dest)
+	               {
+		               ValuePropertyDescriptor->DestroyValue(Dest);
+
+		               ValuePropertyDescriptor->Set(InValue, Dest);
+	               },
+	               [=, this](void* Dest)
+	               {
+		               KeyPropertyDescriptor->DestroyValue(Dest);
+	               },
+	               [=, this](void* Dest)
+	               {
+		               ValuePropertyDescriptor->DestroyValue(Dest);
+	               });
 #else
-		ScriptMap->Rehash(ScriptMapLayout, [=](const void* Src)
+	ScriptMap->Add(NativeKey, InValue, ScriptMapLayout,
+	               [=](const void* Src)
+	               {
+		               return KeyPropertyDescriptor->GetValueTypeHash(Src);
+	               },
+	               [=](const void* A, const void* B)
+	               {
+		               return KeyProperty->Identical(A, B);
+	               },
+	               [=](void* Dest)
+	               {
+		               KeyPropertyDescriptor->Set(InKey, Dest);
+	               },
+	               [=](void* Dest)
+	               {
+		               ValuePropertyDescriptor->Set(InValue, Dest);
+	               },
+	               [=](void* Dest)
+	               {
+		               ValuePropertyDescriptor->DestroyValue(Dest);
+
+		               ValuePropertyDescriptor->Set(InValue, Dest);
+	               },
+	               [=](void* Dest)
+	               {
+		               KeyPropertyDescriptor->DestroyValue(Dest);
+	               },
+	               [=](void* Dest)
+	               {
+		               ValuePropertyDescriptor->DestroyValue(Dest);
+	               });
 #endif
-		                  {
-			                  return KeyPropertyDescriptor->GetValueTypeHash(Src);
-		                  });
-	}
-	else
-	{
-		Data = static_cast<uint8*>(ScriptMap->GetData(KeyIndex, ScriptMapLayout));
-
-		ValuePropertyDescriptor->DestroyValue(Data + ScriptMapLayout.ValueOffset);
-	}
 
-	ValuePropertyDescriptor->Set(InValue, Data + ScriptMapLayout.ValueOffset);
+	ReleaseNativeKey(InKey, NativeKey);
 }
 
 FPropertyDescriptor* FMapHelper::GetKeyPropertyDescriptor() const
@@ -256,3 +272,45 @@ void* FMapHelper::GetEnumeratorValue(const int32 InIndex) const
 		       ? static_cast<uint8*>(ScriptMap->GetData(InIndex, ScriptMapLayout)) + ScriptMapLayout.ValueOffset
 		       : nullptr;
 }
+
+int32 FMapHelper::FindPairIndex(const void* InNativeKey) const
+{
+	const auto KeyProperty = KeyPropertyDescriptor->GetProperty();
+
+#if STD_CPP_20
+	return ScriptMap->FindPairIndex(InNativeKey, ScriptMapLayout,
+	                                [=, this](const void* Src)
+#else
+	return ScriptMap->FindPairIndex(InNativeKey, ScriptMapLayout,
+	                                [=](const void* Src)
+#endif
+	                                {
+		                                return KeyPropertyDescriptor->GetValueTypeHash(Src);
+	                                },
+	                                [=](const void* A, const void* B)
+	                                {
+		                                return KeyProperty->Identical(A, B);
+	                                });
+}
+
+const void* FMapHelper::GetNativeKey(const void* InKey, void* InBuffer) const
+{
+	if (KeyPropertyDescriptor->IsPrimitiveProperty())
+	{
+		return InKey;
+	}
+
+	KeyPropertyDescriptor->InitializeValue(InBuffer);
+
+	KeyPropertyDescriptor->Set(const_cast<void*>(InKey), InBuffer);
+
+	return InBuffer;
+}
+
+void FMapHelper::ReleaseNativeKey(const void* InKey, const void* InNativeKey) const
+{
+	if (InNativeKey != InKey)
+	{
+		KeyPropertyDescriptor->DestroyValue(const_cast<void*>(InNativeKey));
+	}
+}
@@ -77,58 +77,65 @@ int32 FSetHelper::GetMaxIndex() const
 
 void FSetHelper::Add(void* InValue) const
 {
-	auto ValueIndex = static_cast<int32>(INDEX_NONE);
+	const auto Buffer = FMemory_Alloca_Aligned(ElementPropertyDescriptor->GetSize(),
+	                                           ElementPropertyDescriptor->GetMinAlignment());
 
-	for (auto Index = 0; Index < ScriptSet->GetMaxIndex(); ++Index)
-	{
-		if (ScriptSet->IsValidIndex(Index))
-		{
-			if (const auto Data = static_cast<uint8*>(ScriptSet->GetData(Index, ScriptSetLayout));
-				ElementPropertyDescriptor->Identical(Data, InValue))
-			{
-				ValueIndex = Index;
-
-				break;
-			}
-		}
-	}
-
-	if (ValueIndex == INDEX_NONE)
-	{
-		ValueIndex = ScriptSet->AddUninitialized(ScriptSetLayout);
+	const auto NativeValue = GetNativeValue(InValue, Buffer);
 
-		const auto Data = static_cast<uint8*>(ScriptSet->GetData(ValueIndex, ScriptSetLayout));
-
-		ElementPropertyDescriptor->Set(InValue, Data);
+	const auto ElementProperty = ElementPropertyDescriptor->GetProperty();
 
+	// a new element only links its own hash bucket instead of rehashing the whole set
 #if STD_CPP_20
-		ScriptSet->Rehash(ScriptSetLayout, [=, this](const void* Src)
+	ScriptSet->Add(NativeValue, ScriptSetLayout,
+	               [=, this](const void* Src)
+	               {
+		               return ElementPropertyDescriptor->GetValueTypeHash(Src);
+	               },
+	               [=](const void* A, const void* B)
+	               {
+		               return ElementProperty->Identical(A, B);
+	               },
+	               [=, this](void* Dest)
+	               {
+		               ElementPropertyDescriptor->Set(InValue, Dest);
+	               },
+	               [=, this](void* Dest)
+	               {
+		               ElementPropertyDescriptor->DestroyValue(Dest);
+	               });
 #else
-		ScriptSet->Rehash(ScriptSetLayout, [=](const void* Src)
+	ScriptSet->Add(NativeValue, ScriptSetLayout,
+	               [=](const void* Src)
+	               {
+		               return ElementPropertyDescriptor->GetValueTypeHash(Src);
+	               },
+	               [=](const void* A, const void* B)
+	               {
+		               return ElementProperty->Identical(A, B);
+	               },
+	               [=](void* Dest)
+	               {
+		               ElementPropertyDescriptor->Set(InValue, Dest);
+	               },
+	               [=](void* Dest)
+	               {
+		               ElementPropertyDescriptor->DestroyValue(Dest);
+	               });
 #endif
-		                  {
-			                  return ElementPropertyDescriptor->GetValueTypeHash(Src);
-		                  });
-	}
+
+	ReleaseNativeValue(InValue, NativeValue);
 }
 
 int32 FSetHelper::Remove(const void* InValue) const
 {
-	auto ValueIndex = static_cast<int32>(INDEX_NONE);
+	const auto Buffer = FMemory_Alloca_Aligned(ElementPropertyDescriptor->GetSize(),
+	                                           ElementPropertyDescriptor->GetMinAlignment());
 
-	for (auto Index = 0; Index < ScriptSet->GetMaxIndex(); ++Index)
-	{
-		if (ScriptSet->IsValidIndex(Index))
-		{
-			if (const auto Data = static_cast<uint8*>(ScriptSet->GetData(Index, ScriptSetLayout));
-				ElementPropertyDescriptor->Identical(Data, InValue))
-			{
-				ValueIndex = Index;
-
-				break;
-			}
-		}
-	}
+	const auto NativeValue = GetNativeValue(InValue, Buffer);
+
+	const auto ValueIndex = FindIndex(NativeValue);
+
+	ReleaseNativeValue(InValue, NativeValue);
 
 	if (ValueIndex == INDEX_NONE)
 	{
@@ -146,19 +153,16 @@ int32 FSetHelper::Remove(const void* InValue) const
 
 bool FSetHelper::Contains(const void* InValue) const
 {
-	for (auto Index = 0; Index < ScriptSet->GetMaxIndex(); ++Index)
-	{
-		if (ScriptSet->IsValidIndex(Index))
-		{
-			if (const auto Data = static_cast<uint8*>(ScriptSet->GetData(Index, ScriptSetLayout));
-				ElementPropertyDescriptor->Identical(Data, InValue))
-			{
-				return true;
-			}
-		}
-	}
+	const auto Buffer = FMemory_Alloca_Aligned(ElementPropertyDescriptor->GetSize(),
+	                                           ElementPropertyDescriptor->GetMinAlignment());
+
+	const auto NativeValue = GetNativeValue(InValue, Buffer);
 
-	return false;
+	const auto ValueIndex = FindIndex(NativeValue);
+
+	ReleaseNativeValue(InValue, NativeValue);
+
+	return ValueIndex != INDEX_NONE;
 }
 
 FPropertyDescriptor* FSetHelper::GetElementPropertyDescriptor() const
@@ -182,3 +186,45 @@ void* FSetHelper::GetEnumerator(const int32 InIndex) const
 		       ? static_cast<uint8*>(ScriptSet->GetData(InIndex, ScriptSetLayout))
 		       : nullptr;
 }
+
+int32 FSetHelper::FindIndex(const void* InNativeValue) const
+{
+	const auto ElementProperty = ElementPropertyDescriptor->GetProperty();
+
+#if STD_CPP_20
+	return ScriptSet->FindIndex(InNativeValue, ScriptSetLayout,
+	                            [=, this](const void* Src)
+#else
+	return ScriptSet->FindIndex(InNativeValue, ScriptSetLayout,
+	                            [=](const void* Src)
+#endif
+	                            {
+		                            return ElementPropertyDescriptor->GetValueTypeHash(Src);
+	                            },
+	                            [=](const void* A, const void* B)
+	                            {
+		                            return ElementProperty->Identical(A, B);
+	                            });
+}
+
+const void* FSetHelper::GetNativeValue(const void* InValue, void* InBuffer) const
+{
+	if (ElementPropertyDescriptor->IsPrimitiveProperty())
+	{
+		return InValue;
+	}
+
+	ElementPropertyDescriptor->InitializeValue(InBuffer);
+
+	ElementPropertyDescriptor->Set(const_cast<void*>(InValue), InBuffer);
+
+	return InBuffer;
+}
+
+void FSetHelper::ReleaseNativeValue(const void* InValue, const void* InNativeValue) const
+{
+	if (InNativeValue != InValue)
+	{
+		ElementPropertyDescriptor->DestroyValue(const_cast<void*>(InNativeValue));
+	}
+}
@@ -1,9 +1,16 @@
 ﻿#include "Reflection/Delegate/DelegateHandler.h"
 #include "Macro/FunctionMacro.h"
 
+void UDelegateHandler::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	CallBack = FindFunction(*FUNCTION_CSHARP_CALLBACK);
+}
+
 void UDelegateHandler::ProcessEvent(UFunction* Function, void* Parms)
 {
-	if (Function != nullptr && Function->GetName() == FUNCTION_CSHARP_CALLBACK)
+	if (Function != nullptr && Function == CallBack)
 	{
 		if (DelegateDescriptor != nullptr)
 		{
@@ -97,5 +104,5 @@ FName UDelegateHandler::GetFunctionName() const
 
 UFunction* UDelegateHandler::GetCallBack() const
 {
-	return FindFunction(*FUNCTION_CSHARP_CALLBACK);
+	return CallBack;
 }
@@ -0,0 +1,156 @@
+﻿#include "Reflection/Delegate/FDelegateWrapperList.h"
+
+FDelegateWrapperList::FDelegateWrapperList():
+	RemovedNum(0),
+	BroadcastDepth(0)
+{
+}
+
+bool FDelegateWrapperList::IsEmpty() const
+{
+	return Num() == 0;
+}
+
+int32 FDelegateWrapperList::Num() const
+{
+	return DelegateWrappers.Num() - RemovedNum;
+}
+
+bool FDelegateWrapperList::Contains(const FDelegateWrapper& InDelegateWrapper) const
+{
+	return WrapperIndexes.Contains(InDelegateWrapper);
+}
+
+void FDelegateWrapperList::Add(const FDelegateWrapper& InDelegateWrapper)
+{
+	if (InDelegateWrapper.Method == nullptr)
+	{
+		return;
+	}
+
+	const auto Index = DelegateWrappers.Add(InDelegateWrapper);
+
+	WrapperIndexes.Add(InDelegateWrapper, Index);
+
+	ObjectIndexes.Add(InDelegateWrapper.Object, Index);
+}
+
+void FDelegateWrapperList::AddUnique(const FDelegateWrapper& InDelegateWrapper)
+{
+	if (!Contains(InDelegateWrapper))
+	{
+		Add(InDelegateWrapper);
+	}
+}
+
+void FDelegateWrapperList::Remove(const FDelegateWrapper& InDelegateWrapper)
+{
+	TArray<int32, TInlineAllocator<4>> Indexes;
+
+	WrapperIndexes.MultiFind(InDelegateWrapper, Indexes);
+
+	for (const auto Index : Indexes)
+	{
+		RemoveAt(Index);
+	}
+
+	Compact();
+}
+
+void FDelegateWrapperList::RemoveAll(const UObject* InObject)
+{
+	TArray<int32, TInlineAllocator<4>> Indexes;
+
+	ObjectIndexes.MultiFind(MakeWeakObjectPtr(const_cast<UObject*>(InObject)), Indexes);
+
+	for (const auto Index : Indexes)
+	{
+		RemoveAt(Index);
+	}
+
+	Compact();
+}
+
+void FDelegateWrapperList::Empty()
+{
+	if (BroadcastDepth > 0)
+	{
+		for (auto Index = 0; Index < DelegateWrappers.Num(); ++Index)
+		{
+			if (DelegateWrappers[Index].Method != nullptr)
+			{
+				RemoveAt(Index);
+			}
+		}
+	}
+	else
+	{
+		DelegateWrappers.Empty();
+
+		WrapperIndexes.Empty();
+
+		ObjectIndexes.Empty();
+
+		RemovedNum = 0;
+	}
+}
+
+void FDelegateWrapperList::RemoveAt(const int32 InIndex)
+{
+	auto& DelegateWrapper = DelegateWrappers[InIndex];
+
+	WrapperIndexes.RemoveSingle(DelegateWrapper, InIndex);
+
+	ObjectIndexes.RemoveSingle(DelegateWrapper.Object, InIndex);
+
+	DelegateWrapper = {nullptr, nullptr};
+
+	++RemovedNum;
+}
+
+void FDelegateWrapperList::Compact()
+{
+	if (BroadcastDepth > 0 || RemovedNum == 0)
+	{
+		return;
+	}
+
+	// holes at the back are dropped without moving anything
+	auto LastNum = DelegateWrappers.Num();
+
+	while (LastNum > 0 && DelegateWrappers[LastNum - 1].Method == nullptr)
+	{
+		--LastNum;
+	}
+
+	if (LastNum < DelegateWrappers.Num())
+	{
+		RemovedNum -= DelegateWrappers.Num() - LastNum;
+
+		DelegateWrappers.RemoveAt(LastNum, DelegateWrappers.Num() - LastNum);
+	}
+
+	// compacting rebuilds both indexes, so wait until at least half of the slots are holes
+	if (RemovedNum == 0 || RemovedNum * 2 < DelegateWrappers.Num())
+	{
+		return;
+	}
+
+	DelegateWrappers.RemoveAll([](const FDelegateWrapper& Element)
+	{
+		return Element.Method == nullptr;
+	});
+
+	WrapperIndexes.Reset();
+
+	ObjectIndexes.Reset();
+
+	for (auto Index = 0; Index < DelegateWrappers.Num(); ++Index)
+	{
+		WrapperIndexes.Add(DelegateWrappers[Index], Index);
+
+		ObjectIndexes.Add(DelegateWrappers[Index].Object, Index);
+	}
+
+	RemovedNum = 0;
+}
@@ -1,4 +1,6 @@
 ﻿#include "Reflection/Delegate/FMulticastDelegateHelper.h"
+#include "Environment/FCSharpEnvironment.h"
+#include "Registry/FDelegateRegistry.h"
 
 FMulticastDelegateHelper::FMulticastDelegateHelper()
 {
@@ -18,23 +20,31 @@ FMulticastDelegateHelper::~FMulticastDelegateHelper()
 
 void FMulticastDelegateHelper::Initialize(FMulticastScriptDelegate* InMulticastDelegate, UFunction* InSignatureFunction)
 {
-	MulticastDelegateHandler = NewObject<UMulticastDelegateHandler>();
+	bIsInitialized = FCSharpEnvironment::GetEnvironment().GetRegistry<FDelegateRegistry>() != nullptr;
 
-	MulticastDelegateHandler->AddToRoot();
+	MulticastDelegate = InMulticastDelegate;
 
-	MulticastDelegateHandler->Initialize(InMulticastDelegate,
-	                                     InSignatureFunction != nullptr
-		                                     ? InSignatureFunction
-		                                     : MulticastDelegateHandler->GetCallBack());
+	SignatureFunction = InSignatureFunction;
+
+	MulticastDelegateHandler = nullptr;
 }
 
 void FMulticastDelegateHelper::Deinitialize()
 {
+	bIsInitialized = false;
+
+	MulticastDelegate = nullptr;
+
+	SignatureFunction.Reset();
+
 	if (MulticastDelegateHandler != nullptr)
 	{
 		MulticastDelegateHandler->Deinitialize();
 
-		MulticastDelegateHandler->RemoveFromRoot();
+		if (const auto DelegateRegistry = FCSharpEnvironment::GetEnvironment().GetRegistry<FDelegateRegistry>())
+		{
+			DelegateRegistry->DeleteMulticastDelegateHandler(MulticastDelegateHandler.Get());
+		}
 
 		MulticastDelegateHandler = nullptr;
 	}
@@ -42,7 +52,12 @@ void FMulticastDelegateHelper::Deinitialize()
 
 bool FMulticastDelegateHelper::IsBound() const
 {
-	return MulticastDelegateHandler != nullptr ? MulticastDelegateHandler->IsBound() : false;
+	if (MulticastDelegateHandler != nullptr)
+	{
+		return MulticastDelegateHandler->IsBound();
+	}
+
+	return MulticastDelegate != nullptr ? MulticastDelegate->IsBound() : false;
 }
 
 bool FMulticastDelegateHelper::Contains(UObject* InObject, MonoMethod* InMonoMethod) const
@@ -52,17 +67,17 @@ bool FMulticastDelegateHelper::Contains(UObject* InObject, MonoMethod* InMonoMet
 
 void FMulticastDelegateHelper::Add(UObject* InObject, MonoMethod* InMonoMethod) const
 {
-	if (MulticastDelegateHandler != nullptr)
+	if (const auto Handler = GetOrCreateHandler())
 	{
-		MulticastDelegateHandler->Add(InObject, InMonoMethod);
+		Handler->Add(InObject, InMonoMethod);
 	}
 }
 
 void FMulticastDelegateHelper::AddUnique(UObject* InObject, MonoMethod* InMonoMethod) const
 {
-	if (MulticastDelegateHandler != nullptr)
+	if (const auto Handler = GetOrCreateHandler())
 	{
-		MulticastDelegateHandler->AddUnique(InObject, InMonoMethod);
+		Handler->AddUnique(InObject, InMonoMethod);
 	}
 }
 
@@ -88,6 +103,10 @@ void FMulticastDelegateHelper::Clear() const
 	{
 		MulticastDelegateHandler->Clear();
 	}
+	else if (MulticastDelegate != nullptr)
+	{
+		MulticastDelegate->Clear();
+	}
 }
 
 UObject* FMulticastDelegateHelper::GetUObject() const
@@ -99,3 +118,37 @@ FName FMulticastDelegateHelper::GetFunctionName() const
 {
 	return MulticastDelegateHandler != nullptr ? MulticastDelegateHandler->GetFunctionName() : NAME_None;
 }
+
+UMulticastDelegateHandler* FMulticastDelegateHelper::GetOrCreateHandler() const
+{
+	if (MulticastDelegateHandler != nullptr || !bIsInitialized)
+	{
+		return MulticastDelegateHandler.Get();
+	}
+
+	const auto DelegateRegistry = FCSharpEnvironment::GetEnvironment().GetRegistry<FDelegateRegistry>();
+
+	if (DelegateRegistry == nullptr)
+	{
+		return nullptr;
+	}
+
+	const auto Handler = DelegateRegistry->NewMulticastDelegateHandler();
+
+	Handler->Initialize(MulticastDelegate,
+	                    SignatureFunction.IsValid() ? SignatureFunction.Get() : Handler->GetCallBack());
+
+	MulticastDelegateHandler = Handler;
+
+	return Handler;
+}
+
+UMulticastDelegateHandler* FMulticastDelegateHelper::GetBroadcastHandler() const
+{
+	if (MulticastDelegateHandler != nullptr)
+	{
+		return MulticastDelegateHandler.Get();
+	}
+
+	return MulticastDelegate != nullptr && MulticastDelegate->IsBound() ? GetOrCreateHandler() : nullptr;
+}
@@ -1,18 +1,39 @@
 ﻿#include "Reflection/Delegate/MulticastDelegateHandler.h"
 #include "Environment/FCSharpEnvironment.h"
 #include "Macro/FunctionMacro.h"
+#include "Registry/FDelegateRegistry.h"
 #include "Template/TGetArrayLength.inl"
 
+void UMulticastDelegateHandler::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	CallBack = FindFunction(*FUNCTION_CSHARP_CALLBACK);
+}
+
 void UMulticastDelegateHandler::ProcessEvent(UFunction* Function, void* Parms)
 {
-	if (Function != nullptr && Function->GetName() == FUNCTION_CSHARP_CALLBACK)
+	if (Function != nullptr && Function == CallBack)
 	{
-		if (DelegateDescriptor != nullptr)
+		if (DelegateDescriptor != nullptr && !DelegateWrappers.IsEmpty())
 		{
-			for (const auto& [Key, Value] : DelegateWrappers)
+			// converted once per broadcast, only out and ref parameters are refreshed between listeners
+			const auto DelegateParams = DelegateDescriptor->CreateDelegateParams(Parms);
+
+			auto bFirst = true;
+
+			DelegateWrappers.Broadcast([this, Parms, DelegateParams, &bFirst](const FDelegateWrapper& InDelegateWrapper)
 			{
-				DelegateDescriptor->CallDelegate(Key.Get(), Value, Parms);
-			}
+				if (!bFirst)
+				{
+					DelegateDescriptor->UpdateOutDelegateParams(Parms, DelegateParams);
+				}
+
+				bFirst = false;
+
+				DelegateDescriptor->CallDelegate(InDelegateWrapper.Object.Get(), InDelegateWrapper.Method, Parms,
+				                                 DelegateParams);
+			});
 		}
 	}
 	else
@@ -34,7 +55,13 @@ void UMulticastDelegateHandler::Initialize(FMulticastScriptDelegate* InMulticast
 		                          ? InMulticastScriptDelegate
 		                          : new FMulticastScriptDelegate();
 
-	DelegateDescriptor = new FCSharpDelegateDescriptor(InSignatureFunction);
+	SignatureFunction = InSignatureFunction;
+
+	const auto DelegateRegistry = FCSharpEnvironment::GetEnvironment().GetRegistry<FDelegateRegistry>();
+
+	DelegateDescriptor = DelegateRegistry != nullptr
+		                     ? DelegateRegistry->NewDelegateDescriptor(SignatureFunction)
+		                     : nullptr;
 }
 
 void UMulticastDelegateHandler::Deinitialize()
@@ -53,11 +80,16 @@ void UMulticastDelegateHandler::Deinitialize()
 
 	if (DelegateDescriptor != nullptr)
 	{
-		delete DelegateDescriptor;
+		if (const auto DelegateRegistry = FCSharpEnvironment::GetEnvironment().GetRegistry<FDelegateRegistry>())
+		{
+			DelegateRegistry->DeleteDelegateDescriptor(SignatureFunction);
+		}
 
 		DelegateDescriptor = nullptr;
 	}
 
+	SignatureFunction.Reset();
+
 	DelegateWrappers.Empty();
 
 	ScriptDelegate.Unbind();
@@ -124,10 +156,7 @@ void UMulticastDelegateHandler::Remove(UObject* InObject, MonoMethod* InMonoMeth
 
 void UMulticastDelegateHandler::RemoveAll(UObject* InObject)
 {
-	DelegateWrappers.RemoveAll([InObject](const FDelegateWrapper& Element)
-	{
-		return Element.Object == InObject;
-	});
+	DelegateWrappers.RemoveAll(InObject);
 
 	if (DelegateWrappers.IsEmpty())
 	{
@@ -164,5 +193,5 @@ FName UMulticastDelegateHandler::GetFunctionName() const
 
 UFunction* UMulticastDelegateHandler::GetCallBack() const
 {
-	return FindFunction(*FUNCTION_CSHARP_CALLBACK);
+	return CallBack;
 }
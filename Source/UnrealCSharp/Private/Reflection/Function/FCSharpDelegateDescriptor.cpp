@@ -3,11 +3,16 @@
 
 FCSharpDelegateDescriptor::FCSharpDelegateDescriptor(UFunction* InFunction):
 	Super(InFunction,
-	      FFunctionParamBufferAllocatorFactory::Factory<FFunctionParamPersistentBufferAllocator>(InFunction))
+	      FFunctionParamBufferAllocatorFactory::Factory<FFunctionParamPoolBufferAllocator>(InFunction))
 {
 }
 
 bool FCSharpDelegateDescriptor::CallDelegate(const UObject* InObject, MonoMethod* InMethod, void* InParams)
+{
+	return CallDelegate(InObject, InMethod, InParams, CreateDelegateParams(InParams));
+}
+
+MonoArray* FCSharpDelegateDescriptor::CreateDelegateParams(void* InParams) const
 {
 	const auto CSharpParams = FCSharpEnvironment::GetEnvironment().GetDomain()->Array_New(
 		FCSharpEnvironment::GetEnvironment().GetDomain()->Get_Object_Class(), PropertyDescriptors.Num());
@@ -25,8 +30,30 @@ bool FCSharpDelegateDescriptor::CallDelegate(const UObject* InObject, MonoMethod
 		}
 	}
 
+	return CSharpParams;
+}
+
+void FCSharpDelegateDescriptor::UpdateOutDelegateParams(void* InParams, MonoArray* InDelegateParams) const
+{
+	for (const auto& Index : OutPropertyIndexes)
+	{
+		if (const auto OutPropertyDescriptor = PropertyDescriptors[Index])
+		{
+			void* Object = nullptr;
+
+			OutPropertyDescriptor->Get<std::false_type>(
+				OutPropertyDescriptor->ContainerPtrToValuePtr<void>(InParams), &Object);
+
+			FDomain::Array_Set(InDelegateParams, Index, static_cast<MonoObject*>(Object));
+		}
+	}
+}
+
+bool FCSharpDelegateDescriptor::CallDelegate(const UObject* InObject, MonoMethod* InMethod, void* InParams,
+                                             MonoArray* InDelegateParams)
+{
 	if (const auto ReturnValue = FCSharpEnvironment::GetEnvironment().GetDomain()->Runtime_Invoke_Array(
-			InMethod, FCSharpEnvironment::GetEnvironment().GetObject(InObject), CSharpParams);
+			InMethod, FCSharpEnvironment::GetEnvironment().GetObject(InObject), InDelegateParams);
 		ReturnValue != nullptr && ReturnPropertyDescriptor != nullptr)
 	{
 		if (ReturnPropertyDescriptor->IsPrimitiveProperty())
@@ -54,7 +81,7 @@ bool FCSharpDelegateDescriptor::CallDelegate(const UObject* InObject, MonoMethod
 				if (OutPropertyDescriptor->IsPrimitiveProperty())
 				{
 					if (const auto UnBoxResultValue = FCSharpEnvironment::GetEnvironment().GetDomain()->
-						Object_Unbox(FDomain::Array_Get<MonoObject*>(CSharpParams, Index)))
+						Object_Unbox(FDomain::Array_Get<MonoObject*>(InDelegateParams, Index)))
 					{
 						OutPropertyDescriptor->Set(UnBoxResultValue,
 						                           OutPropertyDescriptor->ContainerPtrToValuePtr<void>(InParams));
@@ -64,7 +91,7 @@ bool FCSharpDelegateDescriptor::CallDelegate(const UObject* InObject, MonoMethod
 				{
 					OutPropertyDescriptor->Set(
 						FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(
-							FDomain::Array_Get<MonoObject*>(CSharpParams, Index)),
+							FDomain::Array_Get<MonoObject*>(InDelegateParams, Index)),
 						OutPropertyDescriptor->ContainerPtrToValuePtr<void>(InParams));
 				}
 			}
@@ -1,5 +1,6 @@
 ﻿#include "Reflection/Function/FCSharpFunctionDescriptor.h"
 #include "Environment/FCSharpEnvironment.h"
+#include "Common/FUnrealCSharpFunctionLibrary.h"
 
 FCSharpFunctionDescriptor::FCSharpFunctionDescriptor(UFunction* InFunction,
                                                      FCSharpFunctionRegister&& InFunctionRegister):
@@ -8,7 +9,8 @@ FCSharpFunctionDescriptor::FCSharpFunctionDescriptor(UFunction* InFunction,
 	FunctionRegister(std::move(InFunctionRegister)),
 	Method(FCSharpEnvironment::GetEnvironment().GetDomain()->Parent_Class_Get_Method_From_Name(
 		FCSharpEnvironment::GetEnvironment().GetClassDescriptor(InFunction->GetOwnerClass())->GetMonoClass(),
-		InFunction->GetName(), PropertyDescriptors.Num()))
+		InFunction->GetName(), PropertyDescriptors.Num())),
+	bIsUnboxed(FUnrealCSharpFunctionLibrary::EnableUnboxedOverrideCall())
 {
 }
 
@@ -75,33 +77,60 @@ bool FCSharpFunctionDescriptor::CallCSharp(UObject* InContext, FFrame& InStack,
 		}
 	}
 
-	auto OutParams = NewOutParams != nullptr ? NewOutParams : InStack.OutParms;
+	const auto OutParams = NewOutParams != nullptr ? NewOutParams : InStack.OutParms;
 
-	const auto CSharpParams = FCSharpEnvironment::GetEnvironment().GetDomain()->Array_New(
-		FCSharpEnvironment::GetEnvironment().GetDomain()->Get_Object_Class(), PropertyDescriptors.Num());
+	MonoObject* FoundMonoObject{};
 
-	auto ReferenceParam = OutParams;
+	if (!(FunctionRegister.GetOriginalFunctionFlags() & FUNC_Static))
+	{
+		FoundMonoObject = FCSharpEnvironment::GetEnvironment().IsEnableLazyBind()
+			                  ? FCSharpEnvironment::GetEnvironment().Bind(InContext)
+			                  : FCSharpEnvironment::GetEnvironment().GetObject(InContext);
+	}
 
-	for (auto Index = 0; Index < PropertyDescriptors.Num(); ++Index)
+	if (bIsUnboxed)
+	{
+		CallCSharpUnboxed(FoundMonoObject, Params, OutParams, RESULT_PARAM);
+	}
+	else
 	{
-		void* PropertyAddress{};
+		CallCSharpArray(FoundMonoObject, Params, OutParams, RESULT_PARAM);
+	}
 
-		if (ReferencePropertyIndexes.Contains(Index))
+	if (Params != nullptr && Params != InStack.Locals)
+	{
+		for (auto DestructorLink = Function->DestructorLink;
+		     DestructorLink != nullptr;
+		     DestructorLink = DestructorLink->DestructorLinkNext)
 		{
-			if (const auto ReferencePropertyDescriptor = PropertyDescriptors[Index])
+			if (!DestructorLink->HasAnyPropertyFlags(CPF_OutParm))
 			{
-				ReferenceParam = FindOutParmRec(ReferenceParam, ReferencePropertyDescriptor->GetProperty());
-
-				if (ReferenceParam != nullptr)
-				{
-					PropertyAddress = ReferenceParam->PropAddr;
-				}
+				DestructorLink->DestroyValue_InContainer(Params);
 			}
 		}
-		else
-		{
-			PropertyAddress = PropertyDescriptors[Index]->ContainerPtrToValuePtr<void>(Params);
-		}
+
+		BufferAllocator->Free(Params);
+	}
+
+	return true;
+}
+
+const TWeakObjectPtr<UFunction>& FCSharpFunctionDescriptor::GetOriginalFunction() const
+{
+	return FunctionRegister.GetOriginalFunction();
+}
+
+void FCSharpFunctionDescriptor::CallCSharpArray(MonoObject* InMonoObject, void* InParams, FOutParmRec* InOutParams,
+                                                RESULT_DECL) const
+{
+	const auto CSharpParams = FCSharpEnvironment::GetEnvironment().GetDomain()->Array_New(
+		FCSharpEnvironment::GetEnvironment().GetDomain()->Get_Object_Class(), PropertyDescriptors.Num());
+
+	auto ReferenceParam = InOutParams;
+
+	for (auto Index = 0; Index < PropertyDescriptors.Num(); ++Index)
+	{
+		const auto PropertyAddress = GetPropertyAddress(Index, InParams, ReferenceParam);
 
 		void* Object = nullptr;
 
@@ -110,30 +139,86 @@ bool FCSharpFunctionDescriptor::CallCSharp(UObject* InContext, FFrame& InStack,
 		FDomain::Array_Set(CSharpParams, Index, static_cast<MonoObject*>(Object));
 	}
 
-	const auto FoundMonoObject = FunctionRegister.GetOriginalFunctionFlags() & FUNC_Static
-		                             ? nullptr
-		                             : FCSharpEnvironment::GetEnvironment().GetObject(InContext);
+	SetReturnValue(FCSharpEnvironment::GetEnvironment().GetDomain()->Runtime_Invoke_Array(
+		               Method, InMonoObject, CSharpParams),
+	               RESULT_PARAM);
+
+	auto OutParams = InOutParams;
 
-	if (const auto ReturnValue = FCSharpEnvironment::GetEnvironment().GetDomain()->Runtime_Invoke_Array(
-			Method, FoundMonoObject, CSharpParams);
-		ReturnValue != nullptr && ReturnPropertyDescriptor != nullptr)
+	for (const auto& Index : OutPropertyIndexes)
 	{
-		if (ReturnPropertyDescriptor->IsPrimitiveProperty())
+		if (const auto OutPropertyDescriptor = PropertyDescriptors[Index])
 		{
-			if (const auto UnBoxResultValue = FCSharpEnvironment::GetEnvironment().GetDomain()->
-				Object_Unbox(ReturnValue))
+			OutParams = FindOutParmRec(OutParams, OutPropertyDescriptor->GetProperty());
+
+			if (OutParams != nullptr)
 			{
-				ReturnPropertyDescriptor->Set(UnBoxResultValue, RESULT_PARAM);
+				if (OutPropertyDescriptor->IsPrimitiveProperty())
+				{
+					if (const auto UnBoxResultValue = FCSharpEnvironment::GetEnvironment().GetDomain()->
+						Object_Unbox(FDomain::Array_Get<MonoObject*>(CSharpParams, Index)))
+					{
+						OutPropertyDescriptor->Set(UnBoxResultValue, OutParams->PropAddr);
+					}
+				}
+				else
+				{
+					OutPropertyDescriptor->Set(
+						FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(
+							FDomain::Array_Get<MonoObject*>(CSharpParams, Index)),
+						OutParams->PropAddr);
+				}
 			}
 		}
+	}
+}
+
+void FCSharpFunctionDescriptor::CallCSharpUnboxed(MonoObject* InMonoObject, void* InParams, FOutParmRec* InOutParams,
+                                                  RESULT_DECL) const
+{
+	// mono_runtime_invoke takes value types by address and reference types by pointer, byref parameters are
+	// written back through the same slots, so primitives never get boxed and no object[] is allocated
+	const auto Num = PropertyDescriptors.Num();
+
+	// every slot lives on the stack whatever the parameter count, SGen scans the stack conservatively so the
+	// references in Objects and the byref results written back into them stay pinned during Runtime_Invoke
+	const auto SlotCount = FMath::Max(Num, 1);
+
+	const auto CSharpParams = static_cast<void**>(FMemory_Alloca(SlotCount * sizeof(void*)));
+
+	const auto PropertyAddresses = static_cast<void**>(FMemory_Alloca(SlotCount * sizeof(void*)));
+
+	const auto Objects = static_cast<MonoObject**>(FMemory_Alloca(SlotCount * sizeof(MonoObject*)));
+
+	FMemory::Memzero(Objects, SlotCount * sizeof(MonoObject*));
+
+	auto ReferenceParam = InOutParams;
+
+	for (auto Index = 0; Index < Num; ++Index)
+	{
+		PropertyAddresses[Index] = GetPropertyAddress(Index, InParams, ReferenceParam);
+
+		if (PropertyDescriptors[Index]->IsPrimitiveProperty())
+		{
+			CSharpParams[Index] = PropertyAddresses[Index];
+		}
 		else
 		{
-			ReturnPropertyDescriptor->Set(
-				FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(ReturnValue),
-				RESULT_PARAM);
+			PropertyDescriptors[Index]->Get<std::false_type>(PropertyAddresses[Index],
+			                                                 reinterpret_cast<void**>(&Objects[Index]));
+
+			CSharpParams[Index] = OutPropertyIndexes.Contains(Index)
+				                      ? static_cast<void*>(&Objects[Index])
+				                      : static_cast<void*>(Objects[Index]);
 		}
 	}
 
+	SetReturnValue(FCSharpEnvironment::GetEnvironment().GetDomain()->Runtime_Invoke(
+		               Method, InMonoObject, CSharpParams),
+	               RESULT_PARAM);
+
+	auto OutParams = InOutParams;
+
 	for (const auto& Index : OutPropertyIndexes)
 	{
 		if (const auto OutPropertyDescriptor = PropertyDescriptors[Index])
@@ -144,44 +229,62 @@ bool FCSharpFunctionDescriptor::CallCSharp(UObject* InContext, FFrame& InStack,
 			{
 				if (OutPropertyDescriptor->IsPrimitiveProperty())
 				{
-					if (const auto UnBoxResultValue = FCSharpEnvironment::GetEnvironment().GetDomain()->
-						Object_Unbox(FDomain::Array_Get<MonoObject*>(CSharpParams, Index)))
+					if (PropertyAddresses[Index] != nullptr && PropertyAddresses[Index] != OutParams->PropAddr)
 					{
-						OutPropertyDescriptor->Set(UnBoxResultValue, OutParams->PropAddr);
+						OutPropertyDescriptor->Set(PropertyAddresses[Index], OutParams->PropAddr);
 					}
 				}
 				else
 				{
 					OutPropertyDescriptor->Set(
-						FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(
-							FDomain::Array_Get<MonoObject*>(CSharpParams, Index)),
+						FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(Objects[Index]),
 						OutParams->PropAddr);
 				}
 			}
 		}
 	}
+}
 
-	if (Params != nullptr && Params != InStack.Locals)
+void* FCSharpFunctionDescriptor::GetPropertyAddress(const int32 InIndex, void* InParams,
+                                                    FOutParmRec*& InOutReferenceParam) const
+{
+	if (ReferencePropertyIndexes.Contains(InIndex))
 	{
-		for (auto DestructorLink = Function->DestructorLink;
-		     DestructorLink != nullptr;
-		     DestructorLink = DestructorLink->DestructorLinkNext)
+		if (const auto ReferencePropertyDescriptor = PropertyDescriptors[InIndex])
 		{
-			if (!DestructorLink->HasAnyPropertyFlags(CPF_OutParm))
+			InOutReferenceParam = FindOutParmRec(InOutReferenceParam, ReferencePropertyDescriptor->GetProperty());
+
+			if (InOutReferenceParam != nullptr)
 			{
-				DestructorLink->DestroyValue_InContainer(Params);
+				return InOutReferenceParam->PropAddr;
 			}
 		}
 
-		BufferAllocator->Free(Params);
+		return nullptr;
 	}
 
-	return true;
+	return PropertyDescriptors[InIndex]->ContainerPtrToValuePtr<void>(InParams);
 }
 
-const TWeakObjectPtr<UFunction>& FCSharpFunctionDescriptor::GetOriginalFunction() const
+void FCSharpFunctionDescriptor::SetReturnValue(MonoObject* InReturnValue, RESULT_DECL) const
 {
-	return FunctionRegister.GetOriginalFunction();
+	if (InReturnValue != nullptr && ReturnPropertyDescriptor != nullptr)
+	{
+		if (ReturnPropertyDescriptor->IsPrimitiveProperty())
+		{
+			if (const auto UnBoxResultValue = FCSharpEnvironment::GetEnvironment().GetDomain()->
+				Object_Unbox(InReturnValue))
+			{
+				ReturnPropertyDescriptor->Set(UnBoxResultValue, RESULT_PARAM);
+			}
+		}
+		else
+		{
+			ReturnPropertyDescriptor->Set(
+				FGarbageCollectionHandle::MonoObject2GarbageCollectionHandle(InReturnValue),
+				RESULT_PARAM);
+		}
+	}
 }
 
 FOutParmRec* FCSharpFunctionDescriptor::FindOutParmRec(FOutParmRec* OutParam, const FProperty* OutProperty)
@@ -1,5 +1,37 @@
 ﻿#include "Reflection/Function/FFunctionParamBufferAllocator.h"
 
+FFunctionParamSharedBuffers::FFunctionParamSharedBuffers(const int32 InParamSize):
+	ParamSize(InParamSize)
+{
+}
+
+FFunctionParamSharedBuffers::~FFunctionParamSharedBuffers()
+{
+	while (const auto Buffer = Buffers.Pop())
+	{
+		FMemory::Free(Buffer);
+	}
+}
+
+void* FFunctionParamSharedBuffers::Malloc()
+{
+	if (const auto Buffer = Buffers.Pop())
+	{
+		return Buffer;
+	}
+
+	const auto Buffer = FMemory::Malloc(ParamSize, 16);
+
+	FMemory::Memzero(Buffer, ParamSize);
+
+	return Buffer;
+}
+
+void FFunctionParamSharedBuffers::Free(void* InMemory)
+{
+	Buffers.Push(InMemory);
+}
+
 FFunctionParamBufferAllocator::FFunctionParamBufferAllocator()
 {
 }
@@ -20,7 +52,8 @@ void FFunctionParamBufferAllocator::Free(void* InMemory)
 FFunctionParamPoolBufferAllocator::FFunctionParamPoolBufferAllocator(
 	const TWeakObjectPtr<UFunction>& InFunction):
 	Count(0),
-	ParamSize(InFunction->ParmsSize)
+	ParamSize(InFunction->ParmsSize),
+	SharedBuffers(InFunction->ParmsSize)
 {
 }
 
@@ -34,6 +67,11 @@ FFunctionParamPoolBufferAllocator::~FFunctionParamPoolBufferAllocator()
 
 void* FFunctionParamPoolBufferAllocator::Malloc()
 {
+	if (!IsInGameThread())
+	{
+		return SharedBuffers.Malloc();
+	}
+
 	if (Buffers.IsValidIndex(Count))
 	{
 		return Buffers[Count++];
@@ -52,11 +90,19 @@ void* FFunctionParamPoolBufferAllocator::Malloc()
 
 void FFunctionParamPoolBufferAllocator::Free(void* InMemory)
 {
+	if (!IsInGameThread())
+	{
+		SharedBuffers.Free(InMemory);
+
+		return;
+	}
+
 	Count--;
 }
 
 FFunctionParamPersistentBufferAllocator::FFunctionParamPersistentBufferAllocator(
-	const TWeakObjectPtr<UFunction>& InFunction)
+	const TWeakObjectPtr<UFunction>& InFunction):
+	SharedBuffers(InFunction->ParmsSize)
 {
 	Params = FMemory::Malloc(InFunction->ParmsSize, 16);
 
@@ -75,9 +121,13 @@ FFunctionParamPersistentBufferAllocator::~FFunctionParamPersistentBufferAllocato
 
 void* FFunctionParamPersistentBufferAllocator::Malloc()
 {
-	return Params;
+	return IsInGameThread() ? Params : SharedBuffers.Malloc();
 }
 
 void FFunctionParamPersistentBufferAllocator::Free(void* InMemory)
 {
+	if (InMemory != Params)
+	{
+		SharedBuffers.Free(InMemory);
+	}
 }
@@ -0,0 +1,122 @@
+﻿#include "Reflection/Property/FPropertyListDescriptor.h"
+#include "Environment/FCSharpEnvironment.h"
+
+FPropertyListDescriptor::FPropertyListDescriptor(const TArray<uint32>& InPropertyHashes,
+                                                 const TArray<FPropertyDescriptor*>& InPropertyDescriptors):
+	PropertyHashes(InPropertyHashes),
+	PropertyDescriptors(InPropertyDescriptors),
+	BufferSize(0),
+	bIsValid(true)
+{
+	Offsets.Reserve(PropertyDescriptors.Num());
+
+	BufferSizes.Reserve(PropertyDescriptors.Num());
+
+	for (const auto PropertyDescriptor : PropertyDescriptors)
+	{
+		Offsets.Add(BufferSize);
+
+		BufferSizes.Add(PropertyDescriptor->GetBufferSize());
+
+		BufferSize += Align(BufferSizes.Last(), sizeof(void*));
+	}
+}
+
+bool FPropertyListDescriptor::Get(void* InContainer, uint8* OutBuffer)
+{
+	if (!Resolve())
+	{
+		return false;
+	}
+
+	for (auto Index = 0; Index < PropertyDescriptors.Num(); ++Index)
+	{
+		PropertyDescriptors[Index]->Get(PropertyDescriptors[Index]->ContainerPtrToValuePtr<void>(InContainer),
+		                                OutBuffer + Offsets[Index]);
+	}
+
+	return true;
+}
+
+bool FPropertyListDescriptor::Set(const uint8* InBuffer, void* InContainer)
+{
+	if (!Resolve())
+	{
+		return false;
+	}
+
+	for (auto Index = 0; Index < PropertyDescriptors.Num(); ++Index)
+	{
+		PropertyDescriptors[Index]->Set(const_cast<uint8*>(InBuffer) + Offsets[Index],
+		                                PropertyDescriptors[Index]->ContainerPtrToValuePtr<void>(InContainer));
+	}
+
+	return true;
+}
+
+void FPropertyListDescriptor::Invalidate(const uint32 InPropertyHash)
+{
+	for (auto Index = 0; Index < PropertyHashes.Num(); ++Index)
+	{
+		if (PropertyHashes[Index] == InPropertyHash)
+		{
+			PropertyDescriptors[Index] = nullptr;
+		}
+	}
+}
+
+bool FPropertyListDescriptor::IsValid() const
+{
+	return bIsValid;
+}
+
+int32 FPropertyListDescriptor::Num() const
+{
+	return PropertyDescriptors.Num();
+}
+
+int32 FPropertyListDescriptor::GetBufferSize() const
+{
+	return BufferSize;
+}
+
+const TArray<int32>& FPropertyListDescriptor::GetOffsets() const
+{
+	return Offsets;
+}
+
+const TArray<uint32>& FPropertyListDescriptor::GetPropertyHashes() const
+{
+	return PropertyHashes;
+}
+
+bool FPropertyListDescriptor::Resolve()
+{
+	if (!bIsValid)
+	{
+		return false;
+	}
+
+	for (auto Index = 0; Index < PropertyDescriptors.Num(); ++Index)
+	{
+		if (PropertyDescriptors[Index] == nullptr)
+		{
+			PropertyDescriptors[Index] = FCSharpEnvironment::GetEnvironment().GetOrAddPropertyDescriptor(
+				PropertyHashes[Index]);
+
+			if (PropertyDescriptors[Index] == nullptr)
+			{
+				return false;
+			}
+
+			if (PropertyDescriptors[Index]->GetBufferSize() != BufferSizes[Index])
+			{
+				bIsValid = false;
+
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
@@ -6,6 +6,7 @@
 #include "Reflection/Function/FCSharpFunctionDescriptor.h"
 #include "Reflection/Function/CSharpFunction.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
+#include "Domain/FBindingManifest.h"
 #include "Delegate/FUnrealCSharpModuleDelegates.h"
 #include "Template/TGetArrayLength.inl"
 #include "Template/TFieldIteratorExt.inl"
@@ -47,6 +48,19 @@ MonoObject* FCSharpBind::Bind(FDomain* InDomain, UObject* InObject)
 		return FoundMonoObject;
 	}
 
+	if (FCSharpEnvironment::GetEnvironment().IsEnableLazyBind() &&
+		InObject != nullptr && !InObject->HasAnyFlags(RF_ClassDefaultObject) &&
+		CanBind(InDomain, InObject->GetClass()))
+	{
+		// the object was created without a managed object, run the managed constructor on first access
+		if (const auto NewMonoObject = Bind<true>(InDomain, InObject))
+		{
+			FDomain::Object_Constructor(NewMonoObject);
+
+			return NewMonoObject;
+		}
+	}
+
 	return Bind<false>(InDomain, InObject);
 }
 
@@ -153,21 +167,14 @@ bool FCSharpBind::BindImplementation(FDomain* InDomain, UStruct* InStruct)
 
 	for (const auto& [PropertyName, Property] : Properties)
 	{
-		for (const auto& [FieldName, Field] : Fields)
+		if (MonoClassField* Field{}; Fields.RemoveAndCopyValue(PropertyName, Field))
 		{
-			if (FieldName == PropertyName)
-			{
-				auto FieldHash = GetTypeHash(Property);
-
-				InDomain->Field_Static_Set_Value(InDomain->Class_VTable(NewClassDescriptor->GetMonoClass()),
-				                                 Field, &FieldHash);
-
-				FCSharpEnvironment::GetEnvironment().AddPropertyHash(FieldHash, NewClassDescriptor, Property);
+			auto FieldHash = GetTypeHash(Property);
 
-				Fields.Remove(FieldName);
+			InDomain->Field_Static_Set_Value(InDomain->Class_VTable(NewClassDescriptor->GetMonoClass()),
+			                                 Field, &FieldHash);
 
-				break;
-			}
+			FCSharpEnvironment::GetEnvironment().AddPropertyHash(FieldHash, NewClassDescriptor, Property);
 		}
 	}
 
@@ -204,22 +211,15 @@ bool FCSharpBind::BindImplementation(FDomain* InDomain, UStruct* InStruct)
 
 			for (const auto& [FunctionName, Function] : Functions)
 			{
-				for (const auto& [FieldName, Field] : Fields)
+				if (MonoClassField* Field{}; Fields.RemoveAndCopyValue(FunctionName, Field))
 				{
-					if (FieldName == FunctionName)
-					{
-						auto FieldHash = GetTypeHash(Function);
+					auto FieldHash = GetTypeHash(Function);
 
-						InDomain->Field_Static_Set_Value(InDomain->Class_VTable(NewClassDescriptor->GetMonoClass()),
-						                                 Field, &FieldHash);
+					InDomain->Field_Static_Set_Value(InDomain->Class_VTable(NewClassDescriptor->GetMonoClass()),
+					                                 Field, &FieldHash);
 
-						FCSharpEnvironment::GetEnvironment().AddFunctionHash<FUnrealFunctionDescriptor>(
-							FieldHash, NewClassDescriptor, Function);
-
-						Fields.Remove(FieldName);
-
-						break;
-					}
+					FCSharpEnvironment::GetEnvironment().AddFunctionHash<FUnrealFunctionDescriptor>(
+						FieldHash, NewClassDescriptor, Function);
 				}
 			}
 
@@ -256,46 +256,59 @@ bool FCSharpBind::BindImplementation(FDomain* InDomain, UStruct* InStruct)
 
 			TMap<FString, MonoMethod*> Methods;
 
-			const auto AttributeMonoClass = FDomain::Class_From_Name(
-				COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT), CLASS_OVERRIDE_ATTRIBUTE);
+			if (FBindingManifest::IsValid())
+			{
+				if (const auto OverrideMethods = FBindingManifest::GetOverrideMethods(
+					FUnrealCSharpFunctionLibrary::GetClassNameSpace(InClass),
+					FUnrealCSharpFunctionLibrary::GetFullClass(InClass)))
+				{
+					for (const auto& MethodName : *OverrideMethods)
+					{
+						if (const auto Method = InDomain->Class_Get_Method_From_Name(FoundMonoClass, MethodName, -1))
+						{
+							Methods.Add(MethodName, Method);
+						}
+					}
+				}
+			}
+			else
+			{
+				const auto AttributeMonoClass = FDomain::Class_From_Name(
+					COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT), CLASS_OVERRIDE_ATTRIBUTE);
 
-			void* MethodIterator = nullptr;
+				void* MethodIterator = nullptr;
 
-			while (const auto Method = FDomain::Class_Get_Methods(FoundMonoClass, &MethodIterator))
-			{
-				if (const auto Attrs = FDomain::Custom_Attrs_From_Method(Method))
+				while (const auto Method = FDomain::Class_Get_Methods(FoundMonoClass, &MethodIterator))
 				{
-					if (!!FDomain::Custom_Attrs_Has_Attr(Attrs, AttributeMonoClass))
+					if (const auto Attrs = FDomain::Custom_Attrs_From_Method(Method))
 					{
-						const auto MethodName = FString(FDomain::Method_Get_Name(Method));
+						if (!!FDomain::Custom_Attrs_Has_Attr(Attrs, AttributeMonoClass))
+						{
+							const auto MethodName = FString(FDomain::Method_Get_Name(Method));
 
-						Methods.Add(MethodName, Method);
+							Methods.Add(MethodName, Method);
+						}
 					}
 				}
 			}
 
 			for (const auto& [FunctionName, Function] : Functions)
 			{
-				for (const auto& [MethodName, Method] : Methods)
+				if (const auto FoundMethod = Methods.Find(FunctionName))
 				{
-					if (FunctionName == MethodName)
-					{
-						const auto Signature = FDomain::Method_Signature(Method);
+					const auto Signature = FDomain::Method_Signature(*FoundMethod);
 
-						const auto MethodParamCount = FDomain::Signature_Get_Param_Count(Signature);
+					const auto MethodParamCount = FDomain::Signature_Get_Param_Count(Signature);
 
-						auto FunctionParamCount = Function->ReturnValueOffset != MAX_uint16
-							                          ? Function->NumParms - 1
-							                          : Function->NumParms;
+					auto FunctionParamCount = Function->ReturnValueOffset != MAX_uint16
+						                          ? Function->NumParms - 1
+						                          : Function->NumParms;
 
-						if (MethodParamCount == FunctionParamCount)
-						{
-							Bind(InDomain, NewClassDescriptor, InClass, MethodName, Function);
-
-							Methods.Remove(MethodName);
+					if (MethodParamCount == FunctionParamCount)
+					{
+						Bind(InDomain, NewClassDescriptor, InClass, FunctionName, Function);
 
-							break;
-						}
+						Methods.Remove(FunctionName);
 					}
 				}
 			}
@@ -423,22 +436,33 @@ bool FCSharpBind::CanBind(const FDomain* InDomain, UStruct* InStruct)
 	}
 #endif
 
-	MonoClass* FoundMonoClass{};
+	FString NameSpace;
+
+	FString FullClass;
 
 	if (const auto InClass = Cast<UClass>(InStruct))
 	{
-		FoundMonoClass = InDomain->Class_From_Name(
-			FUnrealCSharpFunctionLibrary::GetClassNameSpace(InClass),
-			FUnrealCSharpFunctionLibrary::GetFullClass(InClass));
+		NameSpace = FUnrealCSharpFunctionLibrary::GetClassNameSpace(InClass);
+
+		FullClass = FUnrealCSharpFunctionLibrary::GetFullClass(InClass);
 	}
 	else if (const auto InScriptStruct = Cast<UScriptStruct>(InStruct))
 	{
-		FoundMonoClass = InDomain->Class_From_Name(
-			FUnrealCSharpFunctionLibrary::GetClassNameSpace(InScriptStruct),
-			FUnrealCSharpFunctionLibrary::GetFullClass(InScriptStruct));
+		NameSpace = FUnrealCSharpFunctionLibrary::GetClassNameSpace(InScriptStruct);
+
+		FullClass = FUnrealCSharpFunctionLibrary::GetFullClass(InScriptStruct);
+	}
+	else
+	{
+		return false;
+	}
+
+	if (FBindingManifest::IsValid())
+	{
+		return FBindingManifest::IsOverrideType(NameSpace, FullClass);
 	}
 
-	if (FoundMonoClass != nullptr)
+	if (const auto FoundMonoClass = InDomain->Class_From_Name(NameSpace, FullClass))
 	{
 		if (const auto FoundMonoType = InDomain->Class_Get_Type(FoundMonoClass))
 		{
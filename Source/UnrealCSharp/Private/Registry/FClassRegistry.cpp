@@ -73,6 +73,17 @@ void FClassRegistry::Deinitialize()
 	}
 
 	FunctionDescriptorMap.Empty();
+
+	for (auto& PropertyListDescriptor : PropertyListDescriptors)
+	{
+		delete PropertyListDescriptor;
+
+		PropertyListDescriptor = nullptr;
+	}
+
+	PropertyListDescriptors.Empty();
+
+	PropertyListHashMap.Empty();
 }
 
 FClassDescriptor* FClassRegistry::GetClassDescriptor(const UStruct* InStruct) const
@@ -208,9 +219,67 @@ void FClassRegistry::RemovePropertyDescriptor(const uint32 InPropertyHash)
 		delete *FoundPropertyDescriptor;
 
 		PropertyDescriptorMap.Remove(InPropertyHash);
+
+		for (const auto PropertyListDescriptor : PropertyListDescriptors)
+		{
+			PropertyListDescriptor->Invalidate(InPropertyHash);
+		}
 	}
 }
 
+uint32 FClassRegistry::AddPropertyListDescriptor(const TArray<uint32>& InPropertyHashes)
+{
+	auto PropertyListHash = 0u;
+
+	for (const auto PropertyHash : InPropertyHashes)
+	{
+		PropertyListHash = HashCombine(PropertyListHash, PropertyHash);
+	}
+
+	// lists are never released, so the same hashes always share one descriptor
+	TArray<uint32> FoundPropertyLists;
+
+	PropertyListHashMap.MultiFind(PropertyListHash, FoundPropertyLists);
+
+	for (const auto FoundPropertyList : FoundPropertyLists)
+	{
+		if (const auto PropertyListDescriptor = PropertyListDescriptors[FoundPropertyList - 1];
+			PropertyListDescriptor->IsValid() && PropertyListDescriptor->GetPropertyHashes() == InPropertyHashes)
+		{
+			return FoundPropertyList;
+		}
+	}
+
+	TArray<FPropertyDescriptor*> PropertyDescriptors;
+
+	PropertyDescriptors.Reserve(InPropertyHashes.Num());
+
+	for (const auto PropertyHash : InPropertyHashes)
+	{
+		const auto PropertyDescriptor = GetOrAddPropertyDescriptor(PropertyHash);
+
+		if (PropertyDescriptor == nullptr)
+		{
+			return 0;
+		}
+
+		PropertyDescriptors.Add(PropertyDescriptor);
+	}
+
+	PropertyListDescriptors.Add(new FPropertyListDescriptor(InPropertyHashes, PropertyDescriptors));
+
+	PropertyListHashMap.Add(PropertyListHash, PropertyListDescriptors.Num());
+
+	return PropertyListDescriptors.Num();
+}
+
+FPropertyListDescriptor* FClassRegistry::GetPropertyListDescriptor(const uint32 InPropertyList) const
+{
+	return InPropertyList > 0 && InPropertyList <= static_cast<uint32>(PropertyListDescriptors.Num())
+		       ? PropertyListDescriptors[InPropertyList - 1]
+		       : nullptr;
+}
+
 void FClassRegistry::ClassConstructor(const FObjectInitializer& InObjectInitializer)
 {
 	auto Class = InObjectInitializer.GetClass();
@@ -47,4 +47,82 @@ void FDelegateRegistry::Deinitialize()
 	MulticastDelegateGarbageCollectionHandle2Helper.Empty();
 
 	MulticastDelegateAddress2GarbageCollectionHandle.Empty();
+
+	for (auto& [Key, Value] : DelegateDescriptors)
+	{
+		if (Value.DelegateDescriptor != nullptr)
+		{
+			delete Value.DelegateDescriptor;
+
+			Value.DelegateDescriptor = nullptr;
+		}
+	}
+
+	DelegateDescriptors.Empty();
+
+	MulticastDelegateHandlers.Empty();
+}
+
+void FDelegateRegistry::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(MulticastDelegateHandlers);
+}
+
+FString FDelegateRegistry::GetReferencerName() const
+{
+	return TEXT("FDelegateRegistry");
+}
+
+UMulticastDelegateHandler* FDelegateRegistry::NewMulticastDelegateHandler()
+{
+	const auto MulticastDelegateHandler = NewObject<UMulticastDelegateHandler>();
+
+	MulticastDelegateHandlers.Add(MulticastDelegateHandler);
+
+	return MulticastDelegateHandler;
+}
+
+void FDelegateRegistry::DeleteMulticastDelegateHandler(UMulticastDelegateHandler* InMulticastDelegateHandler)
+{
+	MulticastDelegateHandlers.Remove(InMulticastDelegateHandler);
+}
+
+FCSharpDelegateDescriptor* FDelegateRegistry::NewDelegateDescriptor(
+	const TWeakObjectPtr<UFunction>& InSignatureFunction)
+{
+	if (const auto FoundDelegateDescriptor = DelegateDescriptors.Find(InSignatureFunction))
+	{
+		++FoundDelegateDescriptor->Count;
+
+		return FoundDelegateDescriptor->DelegateDescriptor;
+	}
+
+	const auto DelegateDescriptor = new FCSharpDelegateDescriptor(InSignatureFunction.Get());
+
+	DelegateDescriptors.Add(InSignatureFunction, {DelegateDescriptor, 1});
+
+	return DelegateDescriptor;
+}
+
+void FDelegateRegistry::DeleteDelegateDescriptor(const TWeakObjectPtr<UFunction>& InSignatureFunction)
+{
+	if (const auto FoundDelegateDescriptor = DelegateDescriptors.Find(InSignatureFunction))
+	{
+		if (--FoundDelegateDescriptor->Count == 0)
+		{
+			delete FoundDelegateDescriptor->DelegateDescriptor;
+
+			DelegateDescriptors.Remove(InSignatureFunction);
+		}
+	}
+}
+
+int32 FDelegateRegistry::GetMulticastDelegateHandlerNum() const
+{
+	return MulticastDelegateHandlers.Num();
+}
+
+int32 FDelegateRegistry::GetDelegateDescriptorNum() const
+{
+	return DelegateDescriptors.Num();
 }
@@ -25,23 +25,23 @@ void FObjectRegistry::Deinitialize()
 
 	GarbageCollectionHandle2Object.Empty();
 
-	Object2GarbageCollectionHandleMap.Empty();
+	Object2GarbageCollectionHandleArray.Empty();
 }
 
 void* FObjectRegistry::GetAddress(const FGarbageCollectionHandle& InGarbageCollectionHandle)
 {
 	const auto FoundObject = GarbageCollectionHandle2Object.Find(InGarbageCollectionHandle);
 
-	return FoundObject != nullptr ? const_cast<UObject*>(FoundObject->Get()) : nullptr;
+	return FoundObject != nullptr ? const_cast<UObject*>(FoundObject->Object.Get()) : nullptr;
 }
 
 void* FObjectRegistry::GetAddress(const FGarbageCollectionHandle& InGarbageCollectionHandle, UStruct*& InStruct)
 {
 	if (const auto FoundObject = GarbageCollectionHandle2Object.Find(InGarbageCollectionHandle))
 	{
-		InStruct = (*FoundObject)->GetClass();
+		InStruct = FoundObject->Object->GetClass();
 
-		return const_cast<UObject*>(FoundObject->Get());
+		return const_cast<UObject*>(FoundObject->Object.Get());
 	}
 
 	return nullptr;
@@ -49,9 +49,9 @@ void* FObjectRegistry::GetAddress(const FGarbageCollectionHandle& InGarbageColle
 
 MonoObject* FObjectRegistry::GetObject(const UObject* InObject)
 {
-	const auto FoundGarbageCollectionHandle = Object2GarbageCollectionHandleMap.Find(InObject);
+	const auto FoundGarbageCollectionHandle = Object2GarbageCollectionHandleArray.Find(InObject);
 
-	return FoundGarbageCollectionHandle != nullptr ? static_cast<MonoObject*>(*FoundGarbageCollectionHandle) : nullptr;
+	return FoundGarbageCollectionHandle.IsValid() ? static_cast<MonoObject*>(FoundGarbageCollectionHandle) : nullptr;
 }
 
 UObject* FObjectRegistry::GetObject(const FGarbageCollectionHandle& InGarbageCollectionHandle)
@@ -61,33 +61,34 @@ UObject* FObjectRegistry::GetObject(const FGarbageCollectionHandle& InGarbageCol
 
 FGarbageCollectionHandle FObjectRegistry::GetGarbageCollectionHandle(const UObject* InObject)
 {
-	const auto FoundGarbageCollectionHandle = Object2GarbageCollectionHandleMap.Find(InObject);
-
-	return FoundGarbageCollectionHandle != nullptr ? *FoundGarbageCollectionHandle : FGarbageCollectionHandle();
+	return Object2GarbageCollectionHandleArray.Find(InObject);
 }
 
 bool FObjectRegistry::AddReference(UObject* InObject, MonoObject* InMonoObject)
 {
 	const auto GarbageCollectionHandle = FGarbageCollectionHandle::NewRef(InMonoObject, true);
 
-	Object2GarbageCollectionHandleMap.Add(InObject, GarbageCollectionHandle);
+	Object2GarbageCollectionHandleArray.Add(InObject, GarbageCollectionHandle);
 
-	GarbageCollectionHandle2Object.Add(GarbageCollectionHandle, &*InObject);
+	GarbageCollectionHandle2Object.Add(GarbageCollectionHandle,
+	                                   {&*InObject, GUObjectArray.ObjectToIndex(InObject)});
 
 	return true;
 }
 
 bool FObjectRegistry::RemoveReference(const UObject* InObject)
 {
-	if (const auto FoundGarbageCollectionHandle = Object2GarbageCollectionHandleMap.Find(InObject))
+	if (auto FoundGarbageCollectionHandle = Object2GarbageCollectionHandleArray.Find(InObject);
+		FoundGarbageCollectionHandle.IsValid())
 	{
-		Object2GarbageCollectionHandleMap.Remove(InObject);
+		Object2GarbageCollectionHandleArray.Remove(GUObjectArray.ObjectToIndex(InObject),
+		                                           FoundGarbageCollectionHandle);
 
-		GarbageCollectionHandle2Object.Remove(*FoundGarbageCollectionHandle);
+		GarbageCollectionHandle2Object.Remove(FoundGarbageCollectionHandle);
 
-		FGarbageCollectionHandle::Free<false>(*FoundGarbageCollectionHandle);
+		FGarbageCollectionHandle::Free<false>(FoundGarbageCollectionHandle);
 
-		(void)FCSharpEnvironment::GetEnvironment().RemoveReference(*FoundGarbageCollectionHandle);
+		(void)FCSharpEnvironment::GetEnvironment().RemoveReference(FoundGarbageCollectionHandle);
 
 		return true;
 	}
@@ -99,16 +100,13 @@ bool FObjectRegistry::RemoveReference(const FGarbageCollectionHandle& InGarbageC
 {
 	if (const auto FoundValue = GarbageCollectionHandle2Object.Find(InGarbageCollectionHandle))
 	{
-		if (const auto FoundGarbageCollectionHandle = Object2GarbageCollectionHandleMap.Find(*FoundValue))
+		if (Object2GarbageCollectionHandleArray.Remove(FoundValue->ObjectIndex, InGarbageCollectionHandle))
 		{
-			if (*FoundGarbageCollectionHandle == InGarbageCollectionHandle)
-			{
-				FGarbageCollectionHandle::Free<false>(*FoundGarbageCollectionHandle);
+			auto GarbageCollectionHandle = InGarbageCollectionHandle;
 
-				(void)FCSharpEnvironment::GetEnvironment().RemoveReference(*FoundGarbageCollectionHandle);
+			FGarbageCollectionHandle::Free<false>(GarbageCollectionHandle);
 
-				Object2GarbageCollectionHandleMap.Remove(*FoundValue);
-			}
+			(void)FCSharpEnvironment::GetEnvironment().RemoveReference(InGarbageCollectionHandle);
 		}
 
 		GarbageCollectionHandle2Object.Remove(InGarbageCollectionHandle);
@@ -0,0 +1,175 @@
+#include "Registry/FObjectSlotArray.h"
+
+FObjectSlotArray::FObjectSlotArray():
+	Chunks(nullptr),
+	NumChunks((GUObjectArray.GetObjectArrayCapacity() + NumSlotsPerChunk - 1) / NumSlotsPerChunk)
+{
+	Chunks = new std::atomic<FSlot*>[NumChunks];
+
+	for (auto Index = 0; Index < NumChunks; ++Index)
+	{
+		Chunks[Index].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+FObjectSlotArray::~FObjectSlotArray()
+{
+	Empty();
+
+	delete[] Chunks;
+
+	Chunks = nullptr;
+}
+
+void FObjectSlotArray::Empty()
+{
+	for (auto Index = 0; Index < NumChunks; ++Index)
+	{
+		delete[] Chunks[Index].exchange(nullptr, std::memory_order_acq_rel);
+	}
+}
+
+FGarbageCollectionHandle FObjectSlotArray::Find(const UObject* InObject) const
+{
+	if (InObject == nullptr)
+	{
+		return FGarbageCollectionHandle();
+	}
+
+	const auto ObjectIndex = GUObjectArray.ObjectToIndex(InObject);
+
+	const auto Slot = FindSlot(ObjectIndex);
+
+	if (Slot == nullptr)
+	{
+		return FGarbageCollectionHandle();
+	}
+
+	const auto ObjectItem = GUObjectArray.IndexToObject(ObjectIndex);
+
+	if (ObjectItem == nullptr)
+	{
+		return FGarbageCollectionHandle();
+	}
+
+	const auto SerialNumber = ObjectItem->GetSerialNumber();
+
+	while (true)
+	{
+		const auto GarbageCollectionHandle = Slot->GarbageCollectionHandle.load(std::memory_order_acquire);
+
+		if (GarbageCollectionHandle == GarbageCollectionHandleType())
+		{
+			return FGarbageCollectionHandle();
+		}
+
+		const auto SlotSerialNumber = Slot->SerialNumber.load(std::memory_order_acquire);
+
+		// the slot was republished for another object while reading, read it again
+		if (Slot->GarbageCollectionHandle.load(std::memory_order_acquire) != GarbageCollectionHandle)
+		{
+			continue;
+		}
+
+		return SerialNumber != 0 && SlotSerialNumber == SerialNumber
+			       ? FGarbageCollectionHandle(GarbageCollectionHandle)
+			       : FGarbageCollectionHandle();
+	}
+}
+
+void FObjectSlotArray::Add(const UObject* InObject, const FGarbageCollectionHandle& InGarbageCollectionHandle)
+{
+	if (InObject == nullptr)
+	{
+		return;
+	}
+
+	const auto ObjectIndex = GUObjectArray.ObjectToIndex(InObject);
+
+	if (const auto Slot = FindOrAddSlot(ObjectIndex))
+	{
+		Slot->GarbageCollectionHandle.store(GarbageCollectionHandleType(), std::memory_order_release);
+
+		Slot->SerialNumber.store(GUObjectArray.AllocateSerialNumber(ObjectIndex), std::memory_order_release);
+
+		Slot->GarbageCollectionHandle.store(InGarbageCollectionHandle, std::memory_order_release);
+	}
+}
+
+bool FObjectSlotArray::Remove(const int32 InObjectIndex, const FGarbageCollectionHandle& InGarbageCollectionHandle)
+{
+	if (const auto Slot = FindSlot(InObjectIndex))
+	{
+		auto Expected = static_cast<GarbageCollectionHandleType>(InGarbageCollectionHandle);
+
+		if (Expected != GarbageCollectionHandleType())
+		{
+			return Slot->GarbageCollectionHandle.compare_exchange_strong(Expected, GarbageCollectionHandleType(),
+			                                                             std::memory_order_acq_rel);
+		}
+	}
+
+	return false;
+}
+
+SIZE_T FObjectSlotArray::GetAllocatedSize() const
+{
+	SIZE_T AllocatedSize = sizeof(std::atomic<FSlot*>) * NumChunks;
+
+	for (auto Index = 0; Index < NumChunks; ++Index)
+	{
+		if (Chunks[Index].load(std::memory_order_relaxed) != nullptr)
+		{
+			AllocatedSize += sizeof(FSlot) * NumSlotsPerChunk;
+		}
+	}
+
+	return AllocatedSize;
+}
+
+FObjectSlotArray::FSlot* FObjectSlotArray::FindSlot(const int32 InObjectIndex) const
+{
+	if (InObjectIndex < 0 || InObjectIndex / NumSlotsPerChunk >= NumChunks)
+	{
+		return nullptr;
+	}
+
+	const auto Chunk = Chunks[InObjectIndex / NumSlotsPerChunk].load(std::memory_order_acquire);
+
+	return Chunk != nullptr ? Chunk + InObjectIndex % NumSlotsPerChunk : nullptr;
+}
+
+FObjectSlotArray::FSlot* FObjectSlotArray::FindOrAddSlot(const int32 InObjectIndex)
+{
+	if (InObjectIndex < 0 || InObjectIndex / NumSlotsPerChunk >= NumChunks)
+	{
+		return nullptr;
+	}
+
+	auto& Chunk = Chunks[InObjectIndex / NumSlotsPerChunk];
+
+	auto FoundChunk = Chunk.load(std::memory_order_acquire);
+
+	if (FoundChunk == nullptr)
+	{
+		const auto NewChunk = new FSlot[NumSlotsPerChunk];
+
+		for (auto Index = 0; Index < NumSlotsPerChunk; ++Index)
+		{
+			NewChunk[Index].GarbageCollectionHandle.store(GarbageCollectionHandleType(), std::memory_order_relaxed);
+
+			NewChunk[Index].SerialNumber.store(0, std::memory_order_relaxed);
+		}
+
+		if (Chunk.compare_exchange_strong(FoundChunk, NewChunk, std::memory_order_acq_rel))
+		{
+			FoundChunk = NewChunk;
+		}
+		else
+		{
+			delete[] NewChunk;
+		}
+	}
+
+	return FoundChunk + InObjectIndex % NumSlotsPerChunk;
+}
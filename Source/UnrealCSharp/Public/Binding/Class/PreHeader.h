@@ -3,5 +3,6 @@
 #if WITH_BINDING
 #include "Macro/NamespaceMacro.h"
 #include "Binding/ScriptStruct/TScriptStruct.inl"
+#include "Binding/ScriptStruct/TValueStruct.inl"
 #include "Binding/Class/TBindingClassBuilder.inl"
 #endif
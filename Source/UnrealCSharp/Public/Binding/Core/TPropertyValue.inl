@@ -461,7 +461,7 @@ struct TPropertyValue<T, std::enable_if_t<TIsTObjectPtr<T>::Value, T>>
 
 template <typename T>
 struct TPropertyValue<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, FName>, T>> :
-	TStringPropertyValue<T>
+	TPrimitivePropertyValue<T>
 {
 };
 
@@ -159,6 +159,38 @@ struct TBindingEnumArgument :
 	using TPrimitiveArgument<T>::TPrimitiveArgument;
 };
 
+template <typename T>
+struct TValueStructArgument
+{
+	using Type = T;
+
+	TValueStructArgument() = default;
+
+	explicit TValueStructArgument(IN_BUFFER_SIGNATURE)
+	{
+		// the buffer is packed by the generated code, so it may not satisfy the alignment of the struct
+		FMemory::Memcpy(&Value, IN_BUFFER, sizeof(Value));
+	}
+
+	auto Get() -> std::remove_const_t<std::decay_t<Type>>&
+	{
+		return Value;
+	}
+
+	auto Set()
+	{
+		return Value;
+	}
+
+	constexpr auto IsRef() const
+	{
+		return TTypeInfo<Type>::Get()->IsRef();
+	}
+
+protected:
+	std::remove_const_t<std::decay_t<Type>> Value;
+};
+
 template <typename T>
 struct TArgument<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, uint8>, T>> :
 	TPrimitiveArgument<T>
@@ -250,9 +282,9 @@ struct TArgument<T, std::enable_if_t<TIsTObjectPtr<std::decay_t<T>>::Value>> :
 
 template <typename T>
 struct TArgument<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, FName>, T>> :
-	TStringArgument<T>
+	TPrimitiveArgument<T>
 {
-	using TStringArgument<T>::TStringArgument;
+	using TPrimitiveArgument<T>::TPrimitiveArgument;
 };
 
 template <typename T>
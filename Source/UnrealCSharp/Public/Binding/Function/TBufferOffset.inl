@@ -1,51 +1,37 @@
 #pragma once
 
+#include <array>
 #include "Binding/TypeInfo/TTypeInfo.inl"
 
-template <typename T, auto N>
-struct TSizeTypeTuple
-{
-	using Type = decltype(std::tuple_cat(std::tuple<T>(), typename TSizeTypeTuple<T, N - 1>::Type()));
-};
-
-template <typename T>
-struct TSizeTypeTuple<T, 0>
-{
-	using Type = std::tuple<>;
-};
-
+/**
+ * Byte offset of every argument inside a binding buffer, the layout only depends on the argument types
+ * so the whole table is built at compile time.
+ */
 template <typename... Args0>
 struct TBufferOffset
 {
 	typedef int32 TBufferOffsetType;
 
-	TBufferOffset():
-		Offset(0)
+private:
+	static constexpr auto Make()
 	{
-		Get<0, Args0...>();
-	}
+		std::array<TBufferOffsetType, sizeof...(Args0)> Offsets{};
 
-	auto operator()()
-	{
-		return Value;
-	}
-
-	template <auto Index>
-	static auto Get()
-	{
-	}
+		if constexpr (sizeof...(Args0) > 0)
+		{
+			TBufferOffsetType Offset = 0;
 
-	template <auto Index, typename T, typename... Args1>
-	auto Get()
-	{
-		std::get<Index>(Value) = Offset;
+			auto Index = 0;
 
-		Offset += TTypeInfo<std::decay_t<T>>::Get()->GetBufferSize();
+			((Offsets[Index++] = Offset, Offset += TTypeInfo<std::decay_t<Args0>>::BufferSize()), ...);
+		}
 
-		Get<Index + 1, Args1...>();
+		return Offsets;
 	}
 
-	TBufferOffsetType Offset;
+public:
+	static constexpr auto Value = Make();
 
-	typename TSizeTypeTuple<TBufferOffsetType, sizeof...(Args0)>::Type Value;
+	static constexpr TBufferOffsetType Size = (TBufferOffsetType{0} + ... +
+		TTypeInfo<std::decay_t<Args0>>::BufferSize());
 };
@@ -16,7 +16,7 @@ struct TConstructorHelper<std::tuple<Args...>>
 	template <typename Class, auto... Index>
 	static auto Call(std::index_sequence<Index...>, BINDING_CONSTRUCTOR_SIGNATURE)
 	{
-		std::tuple<TArgument<Args, Args>...> Argument(IN_BUFFER + std::get<Index>(TBufferOffset<Args...>()())...);
+		std::tuple<TArgument<Args, Args>...> Argument(IN_BUFFER + std::get<Index>(TBufferOffset<Args...>::Value)...);
 
 		auto Value = new Class(std::forward<Args>(std::get<Index>(Argument).Get())...);
 
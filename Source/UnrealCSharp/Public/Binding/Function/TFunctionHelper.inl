@@ -18,7 +18,7 @@ struct TFunctionHelper<TPair<Result, std::tuple<Args...>>>
 	template <typename Function, auto... Index>
 	static auto Call(Function InFunction, std::index_sequence<Index...>, BINDING_FUNCTION_SIGNATURE)
 	{
-		std::tuple<TArgument<Args, Args>...> Argument(IN_BUFFER + std::get<Index>(TBufferOffset<Args...>()())...);
+		std::tuple<TArgument<Args, Args>...> Argument(IN_BUFFER + std::get<Index>(TBufferOffset<Args...>::Value)...);
 
 		if constexpr (std::is_same_v<Result, void>)
 		{
@@ -40,7 +40,7 @@ struct TFunctionHelper<TPair<Result, std::tuple<Args...>>>
 			FCSharpEnvironment::GetEnvironment(), InGarbageCollectionHandle))
 		{
 			std::tuple<TArgument<Args, Args>...> Argument(
-				IN_BUFFER + std::get<Index>(TBufferOffset<Args...>()())...);
+				IN_BUFFER + std::get<Index>(TBufferOffset<Args...>::Value)...);
 
 			if constexpr (std::is_same_v<Result, void>)
 			{
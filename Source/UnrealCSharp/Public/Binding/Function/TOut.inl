@@ -23,7 +23,13 @@ struct TOut
 	{
 		if (std::get<Index>(Argument).IsRef())
 		{
-			if constexpr (TIsPrimitive<T>::Value)
+			if constexpr (TIsValueStruct<std::decay_t<T>>::Value)
+			{
+				const auto Value = std::get<Index>(Argument).Set();
+
+				FMemory::Memcpy(Buffer, &Value, sizeof(Value));
+			}
+			else if constexpr (TIsPrimitive<T>::Value)
 			{
 				*(std::remove_const_t<std::decay_t<T>>*)Buffer = std::get<Index>(Argument).Set();
 			}
@@ -32,7 +38,7 @@ struct TOut
 				*reinterpret_cast<void**>(Buffer) = std::get<Index>(Argument).Set();
 			}
 
-			Buffer += std::get<Index>(TBufferOffset<Args0...>()());
+			Buffer += std::get<Index>(TBufferOffset<Args0...>::Value);
 		}
 
 		Get<Index + 1, Args1...>();
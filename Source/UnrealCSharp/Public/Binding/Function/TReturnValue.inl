@@ -21,6 +21,19 @@ struct TPrimitiveReturnValue
 	}
 };
 
+template <typename T>
+struct TValueStructReturnValue
+{
+	using Type = T;
+
+	TValueStructReturnValue() = default;
+
+	explicit TValueStructReturnValue(RETURN_BUFFER_SIGNATURE, Type&& InValue)
+	{
+		FMemory::Memcpy(RETURN_BUFFER, &InValue, sizeof(std::decay_t<Type>));
+	}
+};
+
 template <typename T>
 struct TCompoundReturnValue
 {
@@ -121,9 +134,9 @@ struct TReturnValue<T, std::enable_if_t<TIsTObjectPtr<std::decay_t<T>>::Value>>
 
 template <typename T>
 struct TReturnValue<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, FName>>> :
-	TCompoundReturnValue<T>
+	TPrimitiveReturnValue<T>
 {
-	using TCompoundReturnValue<T>::TCompoundReturnValue;
+	using TPrimitiveReturnValue<T>::TPrimitiveReturnValue;
 };
 
 template <typename T>
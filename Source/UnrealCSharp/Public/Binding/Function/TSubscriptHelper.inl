@@ -17,7 +17,7 @@ struct TSubscriptHelper
 			TReturnValue<Result>(RETURN_BUFFER, std::forward<Result>(
 				                     FoundObject->operator[](
 					                     TArgument<Index, Index>(
-						                     IN_BUFFER + std::get<0>(TBufferOffset<Index>()())).Get())));
+						                     IN_BUFFER + std::get<0>(TBufferOffset<Index>::Value)).Get())));
 		}
 	}
 
@@ -29,9 +29,9 @@ struct TSubscriptHelper
 		{
 			FoundObject->operator[](
 					TArgument<Index, Index>(
-						IN_BUFFER + std::get<0>(TBufferOffset<Index, Result>()())).Get()) =
+						IN_BUFFER + std::get<0>(TBufferOffset<Index, Result>::Value)).Get()) =
 				TArgument<Result, Result>(
-					IN_BUFFER + std::get<1>(TBufferOffset<Index, Result>()())).Get();
+					IN_BUFFER + std::get<1>(TBufferOffset<Index, Result>::Value)).Get();
 		}
 	}
 };
@@ -187,7 +187,7 @@ struct TPropertyBuilder<Result Class::*, Member, std::enable_if_t<TIsTObjectPtr<
 
 template <typename Class, typename Result, Result Class::* Member>
 struct TPropertyBuilder<Result Class::*, Member, std::enable_if_t<std::is_same_v<Result, FName>>> :
-	TCompoundPropertyBuilder<Class, Result, Member>
+	TPrimitivePropertyBuilder<Class, Result, Member>
 {
 };
 
@@ -390,7 +390,7 @@ struct TPropertyBuilder<Result*, Member, std::enable_if_t<TIsTObjectPtr<std::dec
 
 template <typename Result, Result* Member>
 struct TPropertyBuilder<Result*, Member, std::enable_if_t<std::is_same_v<std::decay_t<Result>, FName>>> :
-	TCompoundPropertyBuilder<void, Result, Member>
+	TPrimitivePropertyBuilder<void, Result, Member>
 {
 };
 
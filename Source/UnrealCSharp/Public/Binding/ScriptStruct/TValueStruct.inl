@@ -0,0 +1,31 @@
+﻿#pragma once
+
+#include "Macro/BindingMacro.h"
+
+/**
+ * Native counterparts of the blittable managed FVectorValue, FRotatorValue, ... structs.
+ * Bindings that take or return them copy the bytes through the buffer instead of going through a managed wrapper.
+ */
+#define VALUE_STRUCT(Class) \
+struct Class##Value : Class \
+{ \
+	using Class::Class; \
+	Class##Value() = default; \
+	Class##Value(const Class& InValue): Class(InValue) {} \
+}; \
+static_assert(sizeof(Class##Value) == sizeof(Class)); \
+BINDING_VALUE_STRUCT(Class##Value)
+
+VALUE_STRUCT(FVector)
+
+VALUE_STRUCT(FVector2D)
+
+VALUE_STRUCT(FRotator)
+
+VALUE_STRUCT(FQuat)
+
+VALUE_STRUCT(FTransform)
+
+VALUE_STRUCT(FLinearColor)
+
+#undef VALUE_STRUCT
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Tickable.h"
+#include "Containers/Ticker.h"
 #include "Domain/FMonoDomain.h"
 
 class UNREALCSHARP_API FDomain final : public FTickableGameObject
@@ -233,6 +234,10 @@ public:
 
 	SynchronizationContextTickType SynchronizationContextTick;
 
+	double ReleaseQueueTimeBudget;
+
+	FTSTicker::FDelegateHandle ReleaseQueueTickerHandle;
+
 public:
 	void InitializeSynchronizationContext();
 
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "GarbageCollection/FGarbageCollectionHandle.h"
+#include "Containers/Queue.h"
+#include <atomic>
+
+/**
+ * Multi producer single consumer queue for registry releases requested by managed finalizers.
+ * Finalizers enqueue from any thread, the game thread drains it once per frame from the core ticker registered by FDomain.
+ */
+class UNREALCSHARP_API FReleaseQueue
+{
+public:
+	typedef void (*FReleaseFunction)(const FGarbageCollectionHandle&);
+
+public:
+	static void Enqueue(const FGarbageCollectionHandle& InGarbageCollectionHandle, FReleaseFunction InFunction);
+
+	static void Drain(double InTimeBudget);
+
+	static void Flush();
+
+	static int32 GetDepth();
+
+	static double GetLastDrainTime();
+
+	static int32 GetLastDrainCount();
+
+private:
+	struct FRelease
+	{
+		FGarbageCollectionHandle GarbageCollectionHandle;
+
+		FReleaseFunction Function;
+	};
+
+	static TQueue<FRelease, EQueueMode::Mpsc> Queue;
+
+	static std::atomic<int32> Depth;
+
+	static double LastDrainTime;
+
+	static int32 LastDrainCount;
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+#include <atomic>
+
+/**
+ * Objects waiting for async loading to finish, keyed by GUObjectArray index and bucketed by package.
+ * Add and Remove may happen on any thread, Flush happens on the game thread.
+ */
+class UNREALCSHARP_API FAsyncLoadingObjectSet
+{
+public:
+	FAsyncLoadingObjectSet();
+
+public:
+	void Add(UObject* InObject, int32 InObjectIndex);
+
+	void Remove(int32 InObjectIndex);
+
+	void Empty();
+
+	int32 Num() const;
+
+	/**
+	 * Skips whole packages that are still loading, then moves every finished object into OutObjects.
+	 */
+	void Flush(TFunctionRef<bool(const UObject*)> InIsLoading, TArray<UObject*>& OutObjects);
+
+private:
+	struct FPendingObject
+	{
+		FWeakObjectPtr Object;
+
+		FObjectKey Package;
+	};
+
+	struct FPackageBucket
+	{
+		TWeakObjectPtr<UPackage> Package;
+
+		TSet<int32> ObjectIndexes;
+	};
+
+	void RemoveFromBucket(const FObjectKey& InPackage, int32 InObjectIndex);
+
+private:
+	FCriticalSection CriticalSection;
+
+	TMap<int32, FPendingObject> Objects;
+
+	TMap<FObjectKey, FPackageBucket> Packages;
+
+	std::atomic<int32> NumObjects;
+};
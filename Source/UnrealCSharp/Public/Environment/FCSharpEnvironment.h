@@ -8,6 +8,7 @@
 #include "Registry/FReferenceRegistry.h"
 #include "Registry/FObjectRegistry.h"
 #include "Registry/FStructRegistry.h"
+#include "Environment/FAsyncLoadingObjectSet.h"
 #include "Template/TIsUObject.inl"
 #include "Template/TIsUStruct.inl"
 #include "Template/TIsScriptStruct.inl"
@@ -45,6 +46,11 @@ public:
 
 	void OnAsyncLoadingFlushUpdate();
 
+public:
+	bool IsEnableLazyBind() const;
+
+	void SetEnableLazyBind(bool bInEnableLazyBind);
+
 public:
 	template <auto IsNeedMonoClass>
 	auto Bind(UStruct* InStruct) const;
@@ -86,6 +92,10 @@ public:
 
 	void RemovePropertyDescriptor(uint32 InPropertyHash) const;
 
+	uint32 AddPropertyListDescriptor(const TArray<uint32>& InPropertyHashes) const;
+
+	FPropertyListDescriptor* GetPropertyListDescriptor(uint32 InPropertyList) const;
+
 public:
 	template <typename T>
 	auto GetAddress(const FGarbageCollectionHandle& InGarbageCollectionHandle, UStruct*& InStruct) const -> void*;
@@ -312,9 +322,9 @@ private:
 	FDelegateHandle OnAsyncLoadingFlushUpdateHandle;
 
 private:
-	FCriticalSection CriticalSection;
+	FAsyncLoadingObjectSet AsyncLoadingObjects;
 
-	TArray<FWeakObjectPtr> AsyncLoadingObjectArray;
+	bool bEnableLazyBind;
 
 private:
 	FDynamicRegistry* DynamicRegistry;
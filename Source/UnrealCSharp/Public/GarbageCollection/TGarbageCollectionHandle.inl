@@ -79,10 +79,17 @@ public:
 			FMonoDomain::Property_Get_Value(InMonoProperty, InMonoObject, nullptr, nullptr)));
 	}
 
-	static auto MonoObject2GarbageCollectionHandle(MonoObject* InMonoObject)
+	static auto MonoObject2GarbageCollectionHandle(MonoObject* InMonoObject) -> T*
 	{
+		const auto FoundClass = FMonoDomain::Object_Get_Class(InMonoObject);
+
+		if (const auto Offset = FMonoDomain::Class_Get_Garbage_Collection_Handle_Offset(FoundClass))
+		{
+			return reinterpret_cast<T*>(reinterpret_cast<uint8*>(InMonoObject) + Offset);
+		}
+
 		const auto FoundProperty = FMonoDomain::Class_Get_Property_From_Name(
-			FMonoDomain::Object_Get_Class(InMonoObject), PROPERTY_GARBAGE_COLLECTION_HANDLE);
+			FoundClass, PROPERTY_GARBAGE_COLLECTION_HANDLE);
 
 		return FoundProperty != nullptr
 			       ? MonoObject2GarbageCollectionHandle(InMonoObject, FoundProperty)
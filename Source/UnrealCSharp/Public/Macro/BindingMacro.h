@@ -17,6 +17,7 @@
 #include "Binding/Function/TOverloadBuilder.inl"
 #include "Template/TFunctionPointer.inl"
 #include "Template/TIsScriptStruct.inl"
+#include "Template/TIsValueStruct.inl"
 #include "Template/TIsNotUEnum.inl"
 
 template <typename... Args>
@@ -166,6 +167,48 @@ struct TIsScriptStruct<Class> \
 	enum { Value = true }; \
 };
 
+#define BINDING_VALUE_STRUCT(Class) \
+template <typename T> \
+struct TName<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> \
+{ \
+	static auto Get() { return F_STRING_STR(Class); } \
+}; \
+template <typename T> \
+struct TNameSpace<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> final : \
+	FCommonNameSpace \
+{ \
+}; \
+template <typename T> \
+struct TPropertyClass<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> \
+{ \
+	static auto Get() \
+	{ \
+		return FMonoDomain::Class_From_Name(TNameSpace<T, T>::Get()[0], TName<T, T>::Get()); \
+	} \
+}; \
+template <typename T> \
+struct TPropertyValue<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> : \
+	TPrimitivePropertyValue<T> \
+{ \
+}; \
+template <typename T> \
+struct TArgument<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> : \
+	TValueStructArgument<T> \
+{ \
+	using TValueStructArgument<T>::TValueStructArgument; \
+}; \
+template <typename T> \
+struct TReturnValue<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>>> : \
+	TValueStructReturnValue<T> \
+{ \
+	using TValueStructReturnValue<T>::TValueStructReturnValue; \
+}; \
+template <> \
+struct TIsValueStruct<Class> \
+{ \
+	enum { Value = true }; \
+};
+
 #define BINDING_ENUM(Class, ...) \
 template <typename T> \
 struct TName<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, Class>, T>> \
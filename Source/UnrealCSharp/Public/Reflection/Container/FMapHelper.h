@@ -50,6 +50,13 @@ public:
 
 	void* GetEnumeratorValue(int32 InIndex) const;
 
+private:
+	int32 FindPairIndex(const void* InNativeKey) const;
+
+	const void* GetNativeKey(const void* InKey, void* InBuffer) const;
+
+	void ReleaseNativeKey(const void* InKey, const void* InNativeKey) const;
+
 private:
 	FPropertyDescriptor* KeyPropertyDescriptor;
 
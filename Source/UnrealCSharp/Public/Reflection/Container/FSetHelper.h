@@ -38,6 +38,13 @@ public:
 
 	void* GetEnumerator(int32 InIndex) const;
 
+private:
+	int32 FindIndex(const void* InNativeValue) const;
+
+	const void* GetNativeValue(const void* InValue, void* InBuffer) const;
+
+	void ReleaseNativeValue(const void* InValue, const void* InNativeValue) const;
+
 private:
 	FPropertyDescriptor* ElementPropertyDescriptor;
 
@@ -18,6 +18,8 @@ class UNREALCSHARP_API UDelegateHandler final : public UObject
 	GENERATED_BODY()
 
 public:
+	virtual void PostInitProperties() override;
+
 	virtual void ProcessEvent(UFunction* Function, void* Parms) override;
 
 	UFUNCTION()
@@ -151,6 +153,8 @@ public:
 private:
 	bool bNeedFree;
 
+	UFunction* CallBack;
+
 	FScriptDelegate* ScriptDelegate;
 
 	FCSharpDelegateDescriptor* DelegateDescriptor;
@@ -13,3 +13,8 @@ static bool operator==(const FDelegateWrapper& A, const FDelegateWrapper& B)
 {
 	return A.Object == B.Object && A.Method == B.Method;
 }
+
+static uint32 GetTypeHash(const FDelegateWrapper& InDelegateWrapper)
+{
+	return HashCombine(GetTypeHash(InDelegateWrapper.Object), PointerHash(InDelegateWrapper.Method));
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "FDelegateWrapper.h"
+
+/**
+ * Subscribers in the order they were added, indexed by wrapper and by object.
+ * Removing during a broadcast leaves a hole that is skipped and compacted away once no broadcast is running,
+ * subscribers added during a broadcast are called from the next one.
+ */
+class UNREALCSHARP_API FDelegateWrapperList
+{
+public:
+	FDelegateWrapperList();
+
+public:
+	bool IsEmpty() const;
+
+	int32 Num() const;
+
+	bool Contains(const FDelegateWrapper& InDelegateWrapper) const;
+
+	void Add(const FDelegateWrapper& InDelegateWrapper);
+
+	void AddUnique(const FDelegateWrapper& InDelegateWrapper);
+
+	void Remove(const FDelegateWrapper& InDelegateWrapper);
+
+	void RemoveAll(const UObject* InObject);
+
+	void Empty();
+
+	template <typename Function>
+	void Broadcast(Function&& InFunction)
+	{
+		++BroadcastDepth;
+
+		for (auto Index = 0, Count = DelegateWrappers.Num(); Index < Count; ++Index)
+		{
+			if (DelegateWrappers[Index].Method != nullptr)
+			{
+				// copied, the function may add subscribers and reallocate
+				const auto DelegateWrapper = DelegateWrappers[Index];
+
+				InFunction(DelegateWrapper);
+			}
+		}
+
+		--BroadcastDepth;
+
+		Compact();
+	}
+
+private:
+	void RemoveAt(int32 InIndex);
+
+	void Compact();
+
+private:
+	// removed entries keep their slot with a null method until compacted
+	TArray<FDelegateWrapper> DelegateWrappers;
+
+	TMultiMap<FDelegateWrapper, int32> WrapperIndexes;
+
+	TMultiMap<TWeakObjectPtr<UObject>, int32> ObjectIndexes;
+
+	int32 RemovedNum;
+
+	int32 BroadcastDepth;
+};
@@ -36,36 +36,36 @@ public:
 	template <auto ReturnType = EFunctionReturnType::Void>
 	void Broadcast0() const
 	{
-		if (MulticastDelegateHandler != nullptr)
+		if (const auto Handler = GetBroadcastHandler())
 		{
-			MulticastDelegateHandler->Broadcast0<ReturnType>();
+			Handler->Broadcast0<ReturnType>();
 		}
 	}
 
 	template <auto ReturnType = EFunctionReturnType::Void>
 	void Broadcast2(IN_BUFFER_SIGNATURE) const
 	{
-		if (MulticastDelegateHandler != nullptr)
+		if (const auto Handler = GetBroadcastHandler())
 		{
-			MulticastDelegateHandler->Broadcast2<ReturnType>(IN_BUFFER);
+			Handler->Broadcast2<ReturnType>(IN_BUFFER);
 		}
 	}
 
 	template <auto ReturnType = EFunctionReturnType::Void>
 	void Broadcast4(OUT_BUFFER_SIGNATURE) const
 	{
-		if (MulticastDelegateHandler != nullptr)
+		if (const auto Handler = GetBroadcastHandler())
 		{
-			MulticastDelegateHandler->Broadcast4<ReturnType>(OUT_BUFFER);
+			Handler->Broadcast4<ReturnType>(OUT_BUFFER);
 		}
 	}
 
 	template <auto ReturnType = EFunctionReturnType::Void>
 	void Broadcast6(IN_BUFFER_SIGNATURE, OUT_BUFFER_SIGNATURE) const
 	{
-		if (MulticastDelegateHandler != nullptr)
+		if (const auto Handler = GetBroadcastHandler())
 		{
-			MulticastDelegateHandler->Broadcast6<ReturnType>(IN_BUFFER, OUT_BUFFER);
+			Handler->Broadcast6<ReturnType>(IN_BUFFER, OUT_BUFFER);
 		}
 	}
 
@@ -74,5 +74,22 @@ public:
 	FName GetFunctionName() const;
 
 private:
-	TWeakObjectPtr<UMulticastDelegateHandler> MulticastDelegateHandler;
+	/**
+	 * The handler is created on the first listener, so a helper that only wraps a delegate costs no UObject.
+	 */
+	UMulticastDelegateHandler* GetOrCreateHandler() const;
+
+	/**
+	 * Delegates owned by script broadcast nothing without a handler, engine delegates may still have engine listeners.
+	 */
+	UMulticastDelegateHandler* GetBroadcastHandler() const;
+
+private:
+	bool bIsInitialized;
+
+	FMulticastScriptDelegate* MulticastDelegate;
+
+	TWeakObjectPtr<UFunction> SignatureFunction;
+
+	mutable TWeakObjectPtr<UMulticastDelegateHandler> MulticastDelegateHandler;
 };
@@ -5,7 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "CoreMacro/BufferMacro.h"
-#include "FDelegateWrapper.h"
+#include "FDelegateWrapperList.h"
 #include "Reflection/Function/FCSharpDelegateDescriptor.h"
 #include "MulticastDelegateHandler.generated.h"
 
@@ -18,6 +18,8 @@ class UNREALCSHARP_API UMulticastDelegateHandler final : public UObject
 	GENERATED_BODY()
 
 public:
+	virtual void PostInitProperties() override;
+
 	virtual void ProcessEvent(UFunction* Function, void* Parms) override;
 
 	UFUNCTION()
@@ -112,11 +114,16 @@ public:
 private:
 	bool bNeedFree;
 
+	UFunction* CallBack;
+
 	FMulticastScriptDelegate* MulticastScriptDelegate;
 
+	TWeakObjectPtr<UFunction> SignatureFunction;
+
+	// shared per signature, owned by FDelegateRegistry
 	FCSharpDelegateDescriptor* DelegateDescriptor;
 
 	FScriptDelegate ScriptDelegate;
 
-	TArray<FDelegateWrapper> DelegateWrappers;
+	FDelegateWrapperList DelegateWrappers;
 };
@@ -16,6 +16,18 @@ public:
 public:
 	bool CallDelegate(const UObject* InObject, MonoMethod* InMethod, void* InParams);
 
+	/**
+	 * Converts InParams once so every listener of a broadcast can be called with the same arguments.
+	 */
+	MonoArray* CreateDelegateParams(void* InParams) const;
+
+	/**
+	 * Converts the out and ref parameters again, the previous listener may have written them back to InParams.
+	 */
+	void UpdateOutDelegateParams(void* InParams, MonoArray* InDelegateParams) const;
+
+	bool CallDelegate(const UObject* InObject, MonoMethod* InMethod, void* InParams, MonoArray* InDelegateParams);
+
 	template <auto ReturnType = EFunctionReturnType::Void>
 	void Execute0(const FScriptDelegate* InScriptDelegate) const;
 
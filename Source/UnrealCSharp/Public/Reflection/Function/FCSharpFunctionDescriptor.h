@@ -19,10 +19,20 @@ public:
 	const TWeakObjectPtr<UFunction>& GetOriginalFunction() const;
 
 private:
+	void CallCSharpArray(MonoObject* InMonoObject, void* InParams, FOutParmRec* InOutParams, RESULT_DECL) const;
+
+	void CallCSharpUnboxed(MonoObject* InMonoObject, void* InParams, FOutParmRec* InOutParams, RESULT_DECL) const;
+
+	void* GetPropertyAddress(int32 InIndex, void* InParams, FOutParmRec*& InOutReferenceParam) const;
+
+	void SetReturnValue(MonoObject* InReturnValue, RESULT_DECL) const;
+
 	static FOutParmRec* FindOutParmRec(FOutParmRec* OutParam, const FProperty* OutProperty);
 
 private:
 	FCSharpFunctionRegister FunctionRegister;
 
 	MonoMethod* Method;
+
+	bool bIsUnboxed;
 };
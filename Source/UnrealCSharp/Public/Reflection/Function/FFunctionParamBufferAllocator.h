@@ -1,5 +1,28 @@
 ﻿#pragma once
 
+#include "Containers/LockFreeList.h"
+
+/**
+ * Parameter buffers handed out to threads other than the game thread, a lock free free list shared by all of them.
+ */
+class FFunctionParamSharedBuffers
+{
+public:
+	explicit FFunctionParamSharedBuffers(int32 InParamSize);
+
+	~FFunctionParamSharedBuffers();
+
+public:
+	void* Malloc();
+
+	void Free(void* InMemory);
+
+private:
+	int32 ParamSize;
+
+	TLockFreePointerListUnordered<void, PLATFORM_CACHE_LINE_SIZE> Buffers;
+};
+
 class FFunctionParamBufferAllocator
 {
 public:
@@ -35,7 +58,10 @@ private:
 
 	decltype(UFunction::ParmsSize) ParamSize;
 
+	// game thread only, calls nest so buffers are handed out and returned in stack order
 	TArray<void*> Buffers;
+
+	FFunctionParamSharedBuffers SharedBuffers;
 };
 
 class FFunctionParamPersistentBufferAllocator final : public FFunctionParamBufferAllocator
@@ -51,7 +77,10 @@ public:
 	virtual void Free(void* InMemory) override;
 
 private:
+	// game thread only
 	void* Params;
+
+	FFunctionParamSharedBuffers SharedBuffers;
 };
 
 class FFunctionParamBufferAllocatorFactory
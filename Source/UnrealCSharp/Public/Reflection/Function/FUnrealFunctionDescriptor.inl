@@ -27,6 +27,11 @@ void FUnrealFunctionDescriptor::Call2(UObject* InObject, IN_BUFFER_SIGNATURE) co
 	PROCESS_SCRIPT_IN()
 
 	InObject->UObject::ProcessEvent(Function.Get(), Params);
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -49,6 +54,11 @@ void FUnrealFunctionDescriptor::Call4(UObject* InObject, OUT_BUFFER_SIGNATURE) c
 	InObject->UObject::ProcessEvent(Function.Get(), Params);
 
 	PROCESS_OUT()
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -61,6 +71,11 @@ void FUnrealFunctionDescriptor::Call6(UObject* InObject, IN_BUFFER_SIGNATURE, OU
 	InObject->UObject::ProcessEvent(Function.Get(), Params);
 
 	PROCESS_OUT()
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -108,6 +123,11 @@ void FUnrealFunctionDescriptor::Call10(UObject* InObject, IN_BUFFER_SIGNATURE) c
 	PROCESS_NATIVE_REFERENCE_IN()
 
 	Function->Invoke(InObject, Stack, nullptr);
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
@@ -136,6 +156,11 @@ void FUnrealFunctionDescriptor::Call14(UObject* InObject, IN_BUFFER_SIGNATURE, O
 	Function->Invoke(InObject, Stack, nullptr);
 
 	PROCESS_OUT()
+
+	if (Params != nullptr)
+	{
+		BufferAllocator->Free(Params);
+	}
 }
 
 template <auto ReturnType>
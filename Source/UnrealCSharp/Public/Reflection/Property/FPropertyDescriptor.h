@@ -45,6 +45,8 @@ public:
 
 	FORCEINLINE FString GetName() const;
 
+	FORCEINLINE void InitializeValue(void* Dest) const;
+
 	FORCEINLINE void InitializeValue_InContainer(void* Dest) const;
 
 	FORCEINLINE int32 GetSize() const;
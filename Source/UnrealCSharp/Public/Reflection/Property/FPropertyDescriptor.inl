@@ -54,6 +54,14 @@ FString FPropertyDescriptor::GetName() const
 	return {};
 }
 
+void FPropertyDescriptor::InitializeValue(void* Dest) const
+{
+	if (const auto Property = GetProperty())
+	{
+		return Property->InitializeValue(Dest);
+	}
+}
+
 void FPropertyDescriptor::InitializeValue_InContainer(void* Dest) const
 {
 	if (const auto Property = GetProperty())
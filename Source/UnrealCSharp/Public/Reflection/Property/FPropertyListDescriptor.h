@@ -0,0 +1,50 @@
+﻿#pragma once
+
+#include "FPropertyDescriptor.h"
+
+/**
+ * A fixed list of properties copied to or from one packed buffer in a single call.
+ * Every property owns a pointer aligned slot of its buffer size, descriptors removed by the class registry
+ * are looked up again by hash on the next access. A descriptor that comes back with another buffer size
+ * no longer fits the managed layout, the list then refuses every further access.
+ */
+class UNREALCSHARP_API FPropertyListDescriptor
+{
+public:
+	FPropertyListDescriptor(const TArray<uint32>& InPropertyHashes,
+	                        const TArray<FPropertyDescriptor*>& InPropertyDescriptors);
+
+public:
+	bool Get(void* InContainer, uint8* OutBuffer);
+
+	bool Set(const uint8* InBuffer, void* InContainer);
+
+	void Invalidate(uint32 InPropertyHash);
+
+public:
+	bool IsValid() const;
+
+	int32 Num() const;
+
+	int32 GetBufferSize() const;
+
+	const TArray<int32>& GetOffsets() const;
+
+	const TArray<uint32>& GetPropertyHashes() const;
+
+private:
+	bool Resolve();
+
+private:
+	TArray<uint32> PropertyHashes;
+
+	TArray<FPropertyDescriptor*> PropertyDescriptors;
+
+	TArray<int32> Offsets;
+
+	TArray<int32> BufferSizes;
+
+	int32 BufferSize;
+
+	bool bIsValid;
+};
@@ -1,19 +1,9 @@
 ﻿#pragma once
 
-#include "Reflection/Property/TCompoundPropertyDescriptor.inl"
+#include "Reflection/Property/TPrimitivePropertyDescriptor.inl"
 
-class FNamePropertyDescriptor final : public TCompoundPropertyDescriptor<FNameProperty>
+class FNamePropertyDescriptor final : public TPrimitivePropertyDescriptor<FNameProperty>
 {
 public:
-	using TCompoundPropertyDescriptor::TCompoundPropertyDescriptor;
-
-public:
-	virtual void Get(void* Src, void** Dest, std::true_type) const override;
-
-	virtual void Get(void* Src, void** Dest, std::false_type) const override;
-
-	virtual void Set(void* Src, void* Dest) const override;
-
-public:
-	virtual bool Identical(const void* A, const void* B, uint32 PortFlags = 0) const override;
+	using TPrimitivePropertyDescriptor::TPrimitivePropertyDescriptor;
 };
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Reflection/Class/FClassDescriptor.h"
+#include "Reflection/Property/FPropertyListDescriptor.h"
 #include "Reflection/Function/FCSharpFunctionRegister.h"
 
 class UNREALCSHARP_API FClassRegistry
@@ -45,6 +46,10 @@ public:
 
 	void RemovePropertyDescriptor(uint32 InPropertyHash);
 
+	uint32 AddPropertyListDescriptor(const TArray<uint32>& InPropertyHashes);
+
+	FPropertyListDescriptor* GetPropertyListDescriptor(uint32 InPropertyList) const;
+
 private:
 	static void ClassConstructor(const FObjectInitializer& InObjectInitializer);
 
@@ -61,6 +66,10 @@ private:
 
 	TMap<uint32, FFunctionDescriptor*> FunctionDescriptorMap;
 
+	TArray<FPropertyListDescriptor*> PropertyListDescriptors;
+
+	TMultiMap<uint32, uint32> PropertyListHashMap;
+
 	static TMap<TWeakObjectPtr<UClass>, UClass::ClassConstructorType> ClassConstructorMap;
 };
 
@@ -1,10 +1,11 @@
 ﻿#pragma once
 
+#include "UObject/GCObject.h"
 #include "TValueMapping.inl"
 #include "Reflection/Delegate/FDelegateHelper.h"
 #include "Reflection/Delegate/FMulticastDelegateHelper.h"
 
-class UNREALCSHARP_API FDelegateRegistry
+class UNREALCSHARP_API FDelegateRegistry : FGCObject
 {
 public:
 	template <typename Address, typename Value>
@@ -32,14 +33,49 @@ public:
 public:
 	FDelegateRegistry();
 
-	~FDelegateRegistry();
+	virtual ~FDelegateRegistry() override;
 
 public:
 	void Initialize();
 
 	void Deinitialize();
 
+public:
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+
+	virtual FString GetReferencerName() const override;
+
+public:
+	/**
+	 * Kept alive by the registry instead of the root set until DeleteMulticastDelegateHandler.
+	 */
+	UMulticastDelegateHandler* NewMulticastDelegateHandler();
+
+	void DeleteMulticastDelegateHandler(UMulticastDelegateHandler* InMulticastDelegateHandler);
+
+	/**
+	 * Shared by every handler of the same signature, counted until the last one calls DeleteDelegateDescriptor.
+	 */
+	FCSharpDelegateDescriptor* NewDelegateDescriptor(const TWeakObjectPtr<UFunction>& InSignatureFunction);
+
+	void DeleteDelegateDescriptor(const TWeakObjectPtr<UFunction>& InSignatureFunction);
+
+	int32 GetMulticastDelegateHandlerNum() const;
+
+	int32 GetDelegateDescriptorNum() const;
+
 private:
+	struct FSharedDelegateDescriptor
+	{
+		FCSharpDelegateDescriptor* DelegateDescriptor;
+
+		int32 Count;
+	};
+
+	TSet<TObjectPtr<UMulticastDelegateHandler>> MulticastDelegateHandlers;
+
+	TMap<TWeakObjectPtr<UFunction>, FSharedDelegateDescriptor> DelegateDescriptors;
+
 	FDelegateHelperMapping::FGarbageCollectionHandle2Value DelegateGarbageCollectionHandle2Helper;
 
 	FDelegateHelperMapping::FAddress2GarbageCollectionHandle DelegateAddress2GarbageCollectionHandle;
@@ -1,18 +1,20 @@
 ﻿#pragma once
 
 #include "TValueMapping.inl"
+#include "FObjectSlotArray.h"
 #include "mono/metadata/object-forward.h"
 
 class UNREALCSHARP_API FObjectRegistry
 {
 private:
-	template <typename Key>
-	struct TObjectMapping : TValueMapping<Key>
+	struct FObjectReference
 	{
-		typedef typename TObjectMapping::FKey2GarbageCollectionHandle FAddress2GarbageCollectionHandle;
+		TWeakObjectPtr<const UObject> Object;
+
+		int32 ObjectIndex;
 	};
 
-	typedef TObjectMapping<TWeakObjectPtr<const UObject>> FObjectMapping;
+	typedef TValueMapping<TWeakObjectPtr<const UObject>, FObjectReference> FObjectMapping;
 
 public:
 	FObjectRegistry();
@@ -45,5 +47,5 @@ public:
 private:
 	FObjectMapping::FGarbageCollectionHandle2Value GarbageCollectionHandle2Object;
 
-	FObjectMapping::FAddress2GarbageCollectionHandle Object2GarbageCollectionHandleMap;
+	FObjectSlotArray Object2GarbageCollectionHandleArray;
 };
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "GarbageCollection/FGarbageCollectionHandle.h"
+#include <atomic>
+
+/**
+ * Flat UObject -> GC handle table indexed by GUObjectArray slot.
+ * Writes happen on the game thread, reads are lock free and may happen on any thread.
+ */
+class UNREALCSHARP_API FObjectSlotArray
+{
+public:
+	FObjectSlotArray();
+
+	~FObjectSlotArray();
+
+public:
+	void Empty();
+
+	FGarbageCollectionHandle Find(const UObject* InObject) const;
+
+	void Add(const UObject* InObject, const FGarbageCollectionHandle& InGarbageCollectionHandle);
+
+	bool Remove(int32 InObjectIndex, const FGarbageCollectionHandle& InGarbageCollectionHandle);
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FSlot
+	{
+		std::atomic<GarbageCollectionHandleType> GarbageCollectionHandle;
+
+		std::atomic<int32> SerialNumber;
+	};
+
+	static constexpr int32 NumSlotsPerChunk = 64 * 1024;
+
+	FSlot* FindSlot(int32 InObjectIndex) const;
+
+	FSlot* FindOrAddSlot(int32 InObjectIndex);
+
+private:
+	std::atomic<FSlot*>* Chunks;
+
+	int32 NumChunks;
+};
@@ -19,8 +19,6 @@ public:
 		bool bNeedFree;
 	};
 
-	typedef TStringAddress<FName*> FNameAddress;
-
 	typedef TStringAddress<FString*> FStringAddress;
 
 #if UE_F_UTF8_STR_PROPERTY
@@ -41,8 +39,6 @@ public:
 		typedef typename TStringValueMapping::FKey2GarbageCollectionHandle FAddress2GarbageCollectionHandle;
 	};
 
-	typedef TStringValueMapping<void*, FNameAddress> FNameMapping;
-
 	typedef TStringValueMapping<void*, FStringAddress> FStringMapping;
 
 #if UE_F_UTF8_STR_PROPERTY
@@ -76,10 +72,6 @@ public:
 	void Deinitialize();
 
 private:
-	FNameMapping::FGarbageCollectionHandle2Value NameGarbageCollectionHandle2Address;
-
-	FNameMapping::FAddress2GarbageCollectionHandle NameAddress2GarbageCollectionHandle;
-
 	FStringMapping::FGarbageCollectionHandle2Value StringGarbageCollectionHandle2Address;
 
 	FStringMapping::FAddress2GarbageCollectionHandle StringAddress2GarbageCollectionHandle;
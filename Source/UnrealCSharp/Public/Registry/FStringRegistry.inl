@@ -82,18 +82,6 @@ struct FStringRegistry::TStringRegistryImplementation<
 	}
 };
 
-template <>
-struct FStringRegistry::TStringRegistry<FName> :
-	TStringRegistryImplementation<
-		FNameMapping,
-		decltype(&FStringRegistry::NameGarbageCollectionHandle2Address),
-		&FStringRegistry::NameGarbageCollectionHandle2Address,
-		decltype(&FStringRegistry::NameAddress2GarbageCollectionHandle),
-		&FStringRegistry::NameAddress2GarbageCollectionHandle
-	>
-{
-};
-
 template <>
 struct FStringRegistry::TStringRegistry<FString> :
 	TStringRegistryImplementation<
@@ -861,6 +861,16 @@ FString FUnrealCSharpFunctionLibrary::GetOverrideFunctionName(const FName& InFun
 	);
 }
 
+bool FUnrealCSharpFunctionLibrary::EnableUnboxedOverrideCall()
+{
+	if (const auto UnrealCSharpSetting = GetMutableDefaultSafe<UUnrealCSharpSetting>())
+	{
+		return UnrealCSharpSetting->EnableUnboxedOverrideCall();
+	}
+
+	return true;
+}
+
 FString FUnrealCSharpFunctionLibrary::GetBindingDirectory()
 {
 	return BINDING_NAME;
@@ -1057,6 +1067,16 @@ FString FUnrealCSharpFunctionLibrary::GetCodeAnalysisPath()
 	return FPaths::ProjectIntermediateDir() / CODE_ANALYSIS_NAME;
 }
 
+FString FUnrealCSharpFunctionLibrary::GetCompileServerCSProjPath()
+{
+	return GetFullScriptDirectory() / COMPILE_SERVER_NAME;
+}
+
+FString FUnrealCSharpFunctionLibrary::GetCompileServerProjectPath()
+{
+	return GetCompileServerCSProjPath() / COMPILE_SERVER_NAME + PROJECT_SUFFIX;
+}
+
 FString FUnrealCSharpFunctionLibrary::GetSourceGeneratorPath()
 {
 	return GetFullScriptDirectory() / SOURCE_GENERATOR_NAME;
@@ -1090,6 +1110,26 @@ UAssemblyLoader* FUnrealCSharpFunctionLibrary::GetAssemblyLoader()
 	return nullptr;
 }
 
+float FUnrealCSharpFunctionLibrary::GetReleaseQueueTimeBudget()
+{
+	if (const auto UnrealCSharpSetting = GetMutableDefaultSafe<UUnrealCSharpSetting>())
+	{
+		return UnrealCSharpSetting->GetReleaseQueueTimeBudget();
+	}
+
+	return 0.f;
+}
+
+bool FUnrealCSharpFunctionLibrary::IsEnableLazyBind()
+{
+	if (const auto UnrealCSharpSetting = GetMutableDefaultSafe<UUnrealCSharpSetting>())
+	{
+		return UnrealCSharpSetting->IsEnableLazyBind();
+	}
+
+	return false;
+}
+
 bool FUnrealCSharpFunctionLibrary::SaveStringToFile(const FString& InFileName, const FString& InString)
 {
 	auto& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
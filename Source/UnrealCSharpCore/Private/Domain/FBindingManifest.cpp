@@ -0,0 +1,174 @@
+﻿#include "Domain/FBindingManifest.h"
+#include "Domain/FMonoDomain.h"
+#include "CoreMacro/ClassMacro.h"
+#include "CoreMacro/GenericAttributeMacro.h"
+#include "CoreMacro/NamespaceMacro.h"
+#include "mono/metadata/class.h"
+#include "mono/metadata/object.h"
+#include "mono/utils/mono-publib.h"
+
+// must match BindingManifestVersion in Weavers/UnrealTypeWeaver.cs
+static constexpr int32 BindingManifestVersion = 1;
+
+bool FBindingManifest::bIsValid;
+
+TSet<FString> FBindingManifest::OverrideTypes;
+
+TMap<FString, TArray<FString>> FBindingManifest::OverrideMethods;
+
+TMap<FString, TArray<MonoClass*>> FBindingManifest::DynamicClasses;
+
+void FBindingManifest::Load()
+{
+	Unload();
+
+	bIsValid = FMonoDomain::Images.Num() > 1;
+
+	// the first image is the generated UE assembly, which is not woven
+	for (auto Index = 1; Index < FMonoDomain::Images.Num() && bIsValid; ++Index)
+	{
+		bIsValid = Load(FMonoDomain::Images[Index]);
+	}
+
+	if (!bIsValid)
+	{
+		Unload();
+	}
+}
+
+void FBindingManifest::Unload()
+{
+	bIsValid = false;
+
+	OverrideTypes.Empty();
+
+	OverrideMethods.Empty();
+
+	DynamicClasses.Empty();
+}
+
+bool FBindingManifest::IsValid()
+{
+	return bIsValid;
+}
+
+bool FBindingManifest::IsOverrideType(const FString& InNameSpace, const FString& InName)
+{
+	return OverrideTypes.Contains(COMBINE_NAMESPACE(InNameSpace, InName));
+}
+
+const TArray<FString>* FBindingManifest::GetOverrideMethods(const FString& InNameSpace, const FString& InName)
+{
+	return OverrideMethods.Find(COMBINE_NAMESPACE(InNameSpace, InName));
+}
+
+const TArray<MonoClass*>* FBindingManifest::GetDynamicClasses(const FString& InAttribute)
+{
+	return DynamicClasses.Find(InAttribute);
+}
+
+bool FBindingManifest::Load(MonoImage* InImage)
+{
+	const auto ManifestMonoClass = mono_class_from_name(InImage,
+	                                                    TCHAR_TO_ANSI(*COMBINE_NAMESPACE(
+		                                                    NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT)),
+	                                                    TCHAR_TO_ANSI(*CLASS_BINDING_MANIFEST));
+
+	if (ManifestMonoClass == nullptr)
+	{
+		return false;
+	}
+
+	const auto VersionField = FMonoDomain::Class_Get_Field_From_Name(ManifestMonoClass, "Version");
+
+	const auto VersionMonoObject = VersionField != nullptr
+		                               ? mono_field_get_value_object(FMonoDomain::Domain, VersionField, nullptr)
+		                               : nullptr;
+
+	if (VersionMonoObject == nullptr ||
+		*static_cast<int32*>(FMonoDomain::Object_Unbox(VersionMonoObject)) != BindingManifestVersion)
+	{
+		return false;
+	}
+
+	TArray<FString> Lines;
+
+	for (const auto& Attribute : {
+		     CLASS_U_CLASS_ATTRIBUTE,
+		     CLASS_U_STRUCT_ATTRIBUTE,
+		     CLASS_U_ENUM_ATTRIBUTE,
+		     CLASS_U_INTERFACE_ATTRIBUTE
+	     })
+	{
+		auto& Classes = DynamicClasses.FindOrAdd(Attribute);
+
+		GetString(ManifestMonoClass, TCHAR_TO_ANSI(*Attribute)).ParseIntoArrayLines(Lines);
+
+		for (const auto& Line : Lines)
+		{
+			auto Index = 0;
+
+			if (!Line.FindLastChar(TEXT('.'), Index))
+			{
+				return false;
+			}
+
+			const auto Class = mono_class_from_name(InImage,
+			                                        TCHAR_TO_ANSI(*Line.Left(Index)),
+			                                        TCHAR_TO_ANSI(*Line.RightChop(Index + 1)));
+
+			if (Class == nullptr)
+			{
+				return false;
+			}
+
+			Classes.Add(Class);
+		}
+	}
+
+	GetString(ManifestMonoClass, TCHAR_TO_ANSI(*CLASS_OVERRIDE_ATTRIBUTE)).ParseIntoArrayLines(Lines);
+
+	OverrideTypes.Append(Lines);
+
+	GetString(ManifestMonoClass, "OverrideMethods").ParseIntoArrayLines(Lines);
+
+	for (const auto& Line : Lines)
+	{
+		FString Type, Method;
+
+		if (!Line.Split(TEXT(":"), &Type, &Method))
+		{
+			return false;
+		}
+
+		OverrideMethods.FindOrAdd(Type).Add(Method);
+	}
+
+	return true;
+}
+
+FString FBindingManifest::GetString(MonoClass* InMonoClass, const char* InName)
+{
+	const auto Field = FMonoDomain::Class_Get_Field_From_Name(InMonoClass, InName);
+
+	if (Field == nullptr)
+	{
+		return FString();
+	}
+
+	const auto Value = reinterpret_cast<MonoString*>(
+		mono_field_get_value_object(FMonoDomain::Domain, Field, nullptr));
+
+	if (Value == nullptr)
+	{
+		return FString();
+	}
+
+	const auto Chars = FMonoDomain::String_To_UTF8(Value);
+
+	auto Result = FString(UTF8_TO_TCHAR(Chars));
+
+	mono_free(Chars);
+
+	return Result;
+}
@@ -0,0 +1,305 @@
+#include "Domain/FManagedWorkerPool.h"
+#include "Domain/FMonoDomain.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+
+class FManagedWorkerPool::FWorker final : public FRunnable
+{
+public:
+	FWorker():
+		WakeEvent(FPlatformProcess::GetSynchEventFromPool(false)),
+		bStop(false)
+	{
+	}
+
+	virtual ~FWorker() override
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	}
+
+	virtual uint32 Run() override
+	{
+		auto bAttached = false;
+
+		while (!bStop.load(std::memory_order_acquire))
+		{
+			if (const auto Job = FindJob(); Job.IsValid() && FMonoDomain::TryEnterManagedJobExecution())
+			{
+				// stay attached between jobs, attach and detach only happen once per thread
+				if (!bAttached)
+				{
+					FMonoDomain::EnsureThreadAttached();
+
+					bAttached = true;
+				}
+
+				Job->Run();
+
+				FMonoDomain::LeaveManagedJobExecution();
+
+				continue;
+			}
+
+			WakeEvent->Wait();
+		}
+
+		if (bAttached)
+		{
+			FMonoDomain::EnsureThreadDetached();
+		}
+
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStop.store(true, std::memory_order_release);
+
+		WakeEvent->Trigger();
+	}
+
+	void Wake() const
+	{
+		WakeEvent->Trigger();
+	}
+
+private:
+	FEvent* WakeEvent;
+
+	std::atomic<bool> bStop;
+};
+
+FCriticalSection FManagedWorkerPool::CriticalSection;
+
+TArray<TSharedPtr<FManagedWorkerPool::FJob, ESPMode::ThreadSafe>> FManagedWorkerPool::Jobs;
+
+TArray<FManagedWorkerPool::FWorker*> FManagedWorkerPool::Workers;
+
+TArray<FRunnableThread*> FManagedWorkerPool::Threads;
+
+FManagedWorkerPool::FJob::FJob(const int32 InNum, const int32 InGrain, const int32 InNumPartitions,
+                               FRangeFunction&& InFunction, const bool bInWait):
+	Function(MoveTemp(InFunction)),
+	Grain(InGrain),
+	NextPartition(0),
+	NumPending(InNum),
+	DoneEvent(bInWait ? FPlatformProcess::GetSynchEventFromPool(true) : nullptr)
+{
+	const auto NumChunks = FMath::DivideAndRoundUp(InNum, InGrain);
+
+	const auto NumPartitions = FMath::Clamp(InNumPartitions, 1, NumChunks);
+
+	Partitions.SetNum(NumPartitions);
+
+	for (auto Index = 0; Index < NumPartitions; ++Index)
+	{
+		const auto ChunkBegin = static_cast<int32>(static_cast<int64>(NumChunks) * Index / NumPartitions);
+
+		const auto ChunkEnd = static_cast<int32>(static_cast<int64>(NumChunks) * (Index + 1) / NumPartitions);
+
+		Partitions[Index].Next.store(ChunkBegin * InGrain, std::memory_order_relaxed);
+
+		Partitions[Index].End = FMath::Min(ChunkEnd * InGrain, InNum);
+	}
+}
+
+FManagedWorkerPool::FJob::~FJob()
+{
+	if (DoneEvent != nullptr)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+	}
+}
+
+bool FManagedWorkerPool::FJob::HasWork() const
+{
+	for (const auto& Partition : Partitions)
+	{
+		if (Partition.Next.load(std::memory_order_relaxed) < Partition.End)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FManagedWorkerPool::FJob::Run()
+{
+	const auto NumPartitions = Partitions.Num();
+
+	const auto StartPartition = NextPartition.fetch_add(1, std::memory_order_relaxed) % NumPartitions;
+
+	// drain the own partition first, then steal ranges from the others
+	for (auto Offset = 0; Offset < NumPartitions; ++Offset)
+	{
+		auto& Partition = Partitions[(StartPartition + Offset) % NumPartitions];
+
+		while (true)
+		{
+			const auto Begin = Partition.Next.fetch_add(Grain, std::memory_order_relaxed);
+
+			if (Begin >= Partition.End)
+			{
+				break;
+			}
+
+			const auto End = FMath::Min(Begin + Grain, Partition.End);
+
+			Function(Begin, End);
+
+			if (NumPending.fetch_sub(End - Begin, std::memory_order_acq_rel) == End - Begin &&
+				DoneEvent != nullptr)
+			{
+				DoneEvent->Trigger();
+			}
+		}
+	}
+}
+
+bool FManagedWorkerPool::ParallelFor(const int32 InNum, const int32 InGrain, FRangeFunction&& InFunction,
+                                     const bool bInWait)
+{
+	if (InNum <= 0 || !InFunction || !FMonoDomain::IsManagedJobExecutionEnabled())
+	{
+		return false;
+	}
+
+	TSharedPtr<FJob, ESPMode::ThreadSafe> Job;
+
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		if (Workers.IsEmpty() && !Startup())
+		{
+			return false;
+		}
+
+		const auto NumPartitions = Workers.Num() + (bInWait ? 1 : 0);
+
+		// a few ranges per participant leave something to steal when bodies are uneven
+		const auto Grain = InGrain > 0 ? InGrain : FMath::Max(1, InNum / (NumPartitions * 4));
+
+		Job = MakeShared<FJob, ESPMode::ThreadSafe>(InNum, Grain, NumPartitions, MoveTemp(InFunction), bInWait);
+
+		Jobs.Add(Job);
+
+		for (const auto Worker : Workers)
+		{
+			Worker->Wake();
+		}
+	}
+
+	if (bInWait)
+	{
+		if (FMonoDomain::TryEnterManagedJobExecution())
+		{
+			Job->Run();
+
+			FMonoDomain::LeaveManagedJobExecution();
+		}
+		else
+		{
+			// the domain is going away, drop whatever nobody has picked up yet
+			for (auto& Partition : Job->Partitions)
+			{
+				if (const auto Begin = Partition.Next.exchange(Partition.End, std::memory_order_relaxed);
+					Begin < Partition.End)
+				{
+					if (Job->NumPending.fetch_sub(Partition.End - Begin) == Partition.End - Begin)
+					{
+						Job->DoneEvent->Trigger();
+					}
+				}
+			}
+		}
+
+		Job->DoneEvent->Wait();
+	}
+
+	return true;
+}
+
+int32 FManagedWorkerPool::GetNumWorkers()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	return Workers.Num();
+}
+
+void FManagedWorkerPool::Shutdown()
+{
+	TArray<FWorker*> LocalWorkers;
+
+	TArray<FRunnableThread*> LocalThreads;
+
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		LocalWorkers = MoveTemp(Workers);
+
+		LocalThreads = MoveTemp(Threads);
+
+		Jobs.Empty();
+	}
+
+	for (const auto Worker : LocalWorkers)
+	{
+		Worker->Stop();
+	}
+
+	for (const auto Thread : LocalThreads)
+	{
+		Thread->WaitForCompletion();
+
+		delete Thread;
+	}
+
+	for (const auto Worker : LocalWorkers)
+	{
+		delete Worker;
+	}
+}
+
+bool FManagedWorkerPool::Startup()
+{
+	const auto NumWorkers = FMath::Max(1, FPlatformMisc::NumberOfWorkerThreadsToSpawn());
+
+	for (auto Index = 0; Index < NumWorkers; ++Index)
+	{
+		const auto Worker = new FWorker();
+
+		if (const auto Thread = FRunnableThread::Create(Worker,
+		                                                *FString::Printf(TEXT("ManagedWorker %d"), Index),
+		                                                0, TPri_Normal))
+		{
+			Workers.Add(Worker);
+
+			Threads.Add(Thread);
+		}
+		else
+		{
+			delete Worker;
+		}
+	}
+
+	return !Workers.IsEmpty();
+}
+
+TSharedPtr<FManagedWorkerPool::FJob, ESPMode::ThreadSafe> FManagedWorkerPool::FindJob()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	for (auto Index = 0; Index < Jobs.Num();)
+	{
+		if (Jobs[Index]->HasWork())
+		{
+			return Jobs[Index];
+		}
+
+		Jobs.RemoveAtSwap(Index);
+	}
+
+	return nullptr;
+}
@@ -1,5 +1,6 @@
 ﻿#include "Domain/FMonoDomain.h"
 #include "Log/FMonoLog.h"
+#include "Log/UnrealCSharpLog.h"
 #include "CoreMacro/ClassMacro.h"
 #include "CoreMacro/PropertyMacro.h"
 #include "CoreMacro/FunctionMacro.h"
@@ -13,6 +14,7 @@
 #include "mono/utils/mono-logger.h"
 #include "mono/metadata/mono-debug.h"
 #include "mono/metadata/class.h"
+#include "mono/metadata/metadata.h"
 #include "mono/metadata/reflection.h"
 #include "mono/metadata/threads.h"
 #include "HAL/PlatformProcess.h"
@@ -20,6 +22,8 @@
 #include "Domain/FMonoProfiler.h"
 #endif
 #include "Misc/FileHelper.h"
+#include "Domain/FBindingManifest.h"
+#include "Domain/FManagedWorkerPool.h"
 #include "Binding/FBinding.h"
 #include "Setting/UnrealCSharpSetting.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
@@ -39,6 +43,14 @@ TArray<MonoImage*> FMonoDomain::Images;
 
 bool FMonoDomain::bLoadSucceed;
 
+TMap<MonoClass*, uint32> FMonoDomain::GarbageCollectionHandleOffsets;
+
+FRWLock FMonoDomain::GarbageCollectionHandleOffsetsLock;
+
+TMap<TPair<FString, FString>, MonoClass*, FDefaultSetAllocator, FClassFromNameKeyFuncs> FMonoDomain::ClassFromNames;
+
+FRWLock FMonoDomain::ClassFromNamesLock;
+
 std::atomic<bool> FMonoDomain::bManagedJobsEnabled = false;
 
 FThreadSafeCounter FMonoDomain::ManagedJobsInFlight;
@@ -124,7 +136,9 @@ void FMonoDomain::Deinitialize()
 {
 	DisableManagedJobExecution();
 	WaitForManagedJobDrain();
-	
+
+	FManagedWorkerPool::Shutdown();
+
 	UnloadAssembly();
 
 	DeinitializeAssembly();
@@ -269,16 +283,37 @@ MonoVTable* FMonoDomain::Class_VTable(MonoClass* InMonoClass)
 
 MonoClass* FMonoDomain::Class_From_Name(const FString& InNameSpace, const FString& InMonoClassName)
 {
+	const auto Key = TPair<FString, FString>(InNameSpace, InMonoClassName);
+
+	{
+		FReadScopeLock ReadScopeLock(ClassFromNamesLock);
+
+		if (const auto FoundClass = ClassFromNames.Find(Key))
+		{
+			return *FoundClass;
+		}
+	}
+
+	const auto NameSpace = StringCast<ANSICHAR>(*InNameSpace);
+
+	const auto MonoClassName = StringCast<ANSICHAR>(*InMonoClassName);
+
+	MonoClass* Class = nullptr;
+
 	for (const auto& Image : Images)
 	{
-		if (const auto& Class = mono_class_from_name(Image, TCHAR_TO_ANSI(*InNameSpace),
-		                                             TCHAR_TO_ANSI(*InMonoClassName)))
+		if (Class = mono_class_from_name(Image, NameSpace.Get(), MonoClassName.Get()); Class != nullptr)
 		{
-			return Class;
+			break;
 		}
 	}
 
-	return nullptr;
+	// misses are cached as well, Images only changes in LoadAssembly and UnloadAssembly which reset the cache
+	FWriteScopeLock WriteScopeLock(ClassFromNamesLock);
+
+	ClassFromNames.Add(Key, Class);
+
+	return Class;
 }
 
 MonoMethod* FMonoDomain::Class_Get_Method_From_Name(MonoClass* InMonoClass, const FString& InFunctionName,
@@ -411,6 +446,11 @@ MonoObject* FMonoDomain::Field_Get_Value_Object(MonoDomain* InMonoDomain, MonoCl
 		       : nullptr;
 }
 
+uint32 FMonoDomain::Field_Get_Offset(MonoClassField* InMonoClassField)
+{
+	return InMonoClassField != nullptr ? mono_field_get_offset(InMonoClassField) : 0u;
+}
+
 const char* FMonoDomain::Property_Get_Name(MonoProperty* InMonoProperty)
 {
 	return InMonoProperty != nullptr ? mono_property_get_name(InMonoProperty) : nullptr;
@@ -790,6 +830,39 @@ MonoClassField* FMonoDomain::Self_Class_Get_Field_From_Name(MonoClass* InMonoCla
 	return nullptr;
 }
 
+uint32 FMonoDomain::Class_Get_Garbage_Collection_Handle_Offset(MonoClass* InMonoClass)
+{
+	if (InMonoClass == nullptr)
+	{
+		return 0u;
+	}
+
+	{
+		FReadScopeLock ReadScopeLock(GarbageCollectionHandleOffsetsLock);
+
+		if (const auto FoundOffset = GarbageCollectionHandleOffsets.Find(InMonoClass))
+		{
+			return *FoundOffset;
+		}
+	}
+
+	auto Offset = 0u;
+
+	if (const auto FoundField = Class_Get_Field_From_Name(InMonoClass, PROPERTY_GARBAGE_COLLECTION_HANDLE_BACKING_FIELD))
+	{
+		if (mono_type_get_type(Field_Get_Type(FoundField)) == MONO_TYPE_I)
+		{
+			Offset = Field_Get_Offset(FoundField);
+		}
+	}
+
+	FWriteScopeLock WriteScopeLock(GarbageCollectionHandleOffsetsLock);
+
+	GarbageCollectionHandleOffsets.Add(InMonoClass, Offset);
+
+	return Offset;
+}
+
 MonoType* FMonoDomain::Property_Get_Type(MonoProperty* InMonoProperty)
 {
 	if (const auto Method = Property_Get_Get_Method(InMonoProperty))
@@ -1140,7 +1213,91 @@ void FMonoDomain::LoadAssembly(const TArray<FString>& InAssemblies)
 	}
 #endif
 
+	{
+		FWriteScopeLock WriteScopeLock(ClassFromNamesLock);
+
+		ClassFromNames.Reset();
+	}
+
 	bLoadSucceed = Assemblies.Num() == InAssemblies.Num();
+
+	if (bLoadSucceed)
+	{
+		if (const auto NameClass = Class_From_Name(COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_CORE_UOBJECT),
+		                                           CLASS_F_NAME))
+		{
+			bLoadSucceed = CheckNameLayout(NameClass);
+		}
+	}
+
+	FBindingManifest::Load();
+}
+
+bool FMonoDomain::CheckNameLayout(MonoClass* InNameClass)
+{
+#if UE_FNAME_OUTLINE_NUMBER
+	UE_LOG(LogUnrealCSharp, Error,
+	       TEXT("Native FName keeps its number outside the name, the managed FName can not match it and the script "
+		       "assemblies are not loaded"));
+
+	return false;
+#else
+	struct FNameField
+	{
+		const char* Name;
+
+		int32 Offset;
+	};
+
+	// FName members are private, these follow their declaration order
+	static constexpr FNameField NameFields[] =
+	{
+		{"ComparisonIndex", 0},
+		{"Number", sizeof(FNameEntryId)},
+#if WITH_CASE_PRESERVING_NAME
+		{"DisplayIndex", sizeof(FNameEntryId) + sizeof(uint32)},
+#endif
+	};
+
+	static_assert(sizeof(FName) == UE_ARRAY_COUNT(NameFields) * sizeof(uint32),
+	              "FName layout changed, update NameFields and the managed FName");
+
+	if (const auto NameSize = mono_class_value_size(InNameClass, nullptr);
+		NameSize != static_cast<int32>(sizeof(FName)))
+	{
+		UE_LOG(LogUnrealCSharp, Error,
+		       TEXT("Managed FName is %d bytes but native FName is %d bytes, "
+			       "the script assemblies were built for a different editor configuration and are not loaded"),
+		       NameSize,
+		       static_cast<int32>(sizeof(FName)));
+
+		return false;
+	}
+
+	// managed offsets include the object header, compare them relative to the first field
+	const auto BaseOffset = static_cast<int32>(Field_Get_Offset(
+		Class_Get_Field_From_Name(InNameClass, NameFields[0].Name)));
+
+	for (const auto& NameField : NameFields)
+	{
+		const auto Field = Class_Get_Field_From_Name(InNameClass, NameField.Name);
+
+		if (const auto Offset = static_cast<int32>(Field_Get_Offset(Field)) - BaseOffset;
+			Field == nullptr || Offset != NameField.Offset)
+		{
+			UE_LOG(LogUnrealCSharp, Error,
+			       TEXT("Managed FName.%s is at offset %d but native FName has it at offset %d, "
+				       "the script assemblies were built for a different editor configuration and are not loaded"),
+			       ANSI_TO_TCHAR(NameField.Name),
+			       Field != nullptr ? Offset : -1,
+			       NameField.Offset);
+
+			return false;
+		}
+	}
+
+	return true;
+#endif
 }
 
 void FMonoDomain::UnloadAssembly()
@@ -1161,6 +1318,20 @@ void FMonoDomain::UnloadAssembly()
 
 	Assemblies.Reset();
 
+	{
+		FWriteScopeLock WriteScopeLock(GarbageCollectionHandleOffsetsLock);
+
+		GarbageCollectionHandleOffsets.Reset();
+	}
+
+	{
+		FWriteScopeLock WriteScopeLock(ClassFromNamesLock);
+
+		ClassFromNames.Reset();
+	}
+
+	FBindingManifest::Unload();
+
 	bLoadSucceed = false;
 }
 
@@ -12,6 +12,7 @@
 #include "CoreMacro/GenericAttributeMacro.h"
 #include "CoreMacro/MetaDataAttributeMacro.h"
 #include "Domain/FMonoDomain.h"
+#include "Domain/FBindingManifest.h"
 #include "Common/FUnrealCSharpFunctionLibrary.h"
 #include "Log/UnrealCSharpLog.h"
 #include "Template/TGetArrayLength.inl"
@@ -541,6 +542,19 @@ bool FDynamicGeneratorCore::ClassHasAttr(MonoClass* InMonoClass, const FString&
 
 void FDynamicGeneratorCore::Generator(const FString& InAttribute, const TFunction<void(MonoClass*)>& InGenerator)
 {
+	if (FBindingManifest::IsValid())
+	{
+		if (const auto Classes = FBindingManifest::GetDynamicClasses(InAttribute))
+		{
+			for (const auto Class : *Classes)
+			{
+				InGenerator(Class);
+			}
+		}
+
+		return;
+	}
+
 	const auto AttributeMonoClass = FMonoDomain::Class_From_Name(
 		COMBINE_NAMESPACE(NAMESPACE_ROOT, NAMESPACE_DYNAMIC), InAttribute);
 
@@ -24,6 +24,7 @@ UUnrealCSharpEditorSetting::UUnrealCSharpEditorSetting(const FObjectInitializer&
 	ScriptDirectory(DEFAULT_SCRIPT_DIRECTORY),
 	bEnableDeleteProxyDirectory(false),
 	bEnableCompiled(true),
+	bEnableCompileServer(true),
 	bEnableAssetChanged(true),
 	bEnableDirectoryChanged(true),
 	bIsSkipGenerateEngineModules(false),
@@ -283,6 +284,11 @@ bool UUnrealCSharpEditorSetting::EnableCompiled() const
 	return bEnableCompiled;
 }
 
+bool UUnrealCSharpEditorSetting::EnableCompileServer() const
+{
+	return bEnableCompileServer;
+}
+
 bool UUnrealCSharpEditorSetting::EnableAssetChanged() const
 {
 	return bEnableAssetChanged;
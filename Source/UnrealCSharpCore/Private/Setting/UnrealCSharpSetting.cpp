@@ -14,7 +14,10 @@ UUnrealCSharpSetting::UUnrealCSharpSetting(const FObjectInitializer& ObjectIniti
 	  bEnableCallOverrideFunction(true),
 	  OverrideFunctionNamePrefix(DEFAULT_OVERRIDE_FUNCTION_NAME_PREFIX),
 	  OverrideFunctionNameSuffix(DEFAULT_OVERRIDE_FUNCTION_NAME_SUFFIX),
+	  bEnableUnboxedOverrideCall(true),
 	  AssemblyLoader(UAssemblyLoader::StaticClass()),
+	  ReleaseQueueTimeBudget(0.f),
+	  bEnableLazyBind(false),
 	  bEnableDebug(false),
 	  Port(0),
 	  bEnableImmediatelyActive(true)
@@ -83,6 +86,11 @@ const FString& UUnrealCSharpSetting::GetOverrideFunctionNameSuffix() const
 	return OverrideFunctionNameSuffix;
 }
 
+bool UUnrealCSharpSetting::EnableUnboxedOverrideCall() const
+{
+	return bEnableUnboxedOverrideCall;
+}
+
 UAssemblyLoader* UUnrealCSharpSetting::GetAssemblyLoader() const
 {
 	return Cast<UAssemblyLoader>((AssemblyLoader->IsValidLowLevelFast()
@@ -91,11 +99,21 @@ UAssemblyLoader* UUnrealCSharpSetting::GetAssemblyLoader() const
 		->GetDefaultObject());
 }
 
+float UUnrealCSharpSetting::GetReleaseQueueTimeBudget() const
+{
+	return ReleaseQueueTimeBudget;
+}
+
 const TArray<FBindClass>& UUnrealCSharpSetting::GetBindClass() const
 {
 	return BindClass;
 }
 
+bool UUnrealCSharpSetting::IsEnableLazyBind() const
+{
+	return bEnableLazyBind;
+}
+
 bool UUnrealCSharpSetting::IsEnableDebug() const
 {
 	return bEnableDebug;
@@ -220,11 +220,13 @@ struct TDefaultArgument<T, std::enable_if_t<std::is_same_v<std::decay_t<T>, FNam
 {
 	static auto Get(const FName& InValue)
 	{
-		return FString::Printf(TEXT(
-			"new %s(\"%s\")"),
-		                       *TName<T, T>::Get(),
-		                       *InValue.ToString()
-		);
+		return InValue.IsNone()
+			       ? FString(TEXT("default"))
+			       : FString::Printf(TEXT(
+				       "new %s(\"%s\")"),
+			                         *TName<T, T>::Get(),
+			                         *InValue.ToString()
+			       );
 	}
 };
 
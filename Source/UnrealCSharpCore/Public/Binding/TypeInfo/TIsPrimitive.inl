@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Template/TIsTEnumAsByte.inl"
+#include "Template/TIsValueStruct.inl"
 
 template <typename T>
 struct TIsPrimitive
@@ -18,8 +19,10 @@ struct TIsPrimitive
 		std::is_same_v<std::decay_t<T>, uint64> ||
 		std::is_same_v<std::decay_t<T>, float> ||
 		std::is_same_v<std::decay_t<T>, double> ||
+		std::is_same_v<std::decay_t<T>, FName> ||
 		TIsEnum<std::decay_t<T>>::Value ||
 		TIsEnumClass<std::decay_t<T>>::Value ||
-		TIsTEnumAsByte<std::decay_t<T>>::Value
+		TIsTEnumAsByte<std::decay_t<T>>::Value ||
+		TIsValueStruct<std::decay_t<T>>::Value
 	};
 };
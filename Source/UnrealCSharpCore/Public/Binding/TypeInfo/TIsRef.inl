@@ -12,7 +12,6 @@ struct TIsRef
 	static constexpr auto IsRef()
 	{
 		if constexpr (TIsPrimitive<T>::Value ||
-			std::is_same_v<std::decay_t<T>, FName> ||
 			std::is_same_v<std::decay_t<T>, FText> ||
 			std::is_same_v<std::decay_t<T>, FString> ||
 #if UE_F_UTF8_STR_PROPERTY
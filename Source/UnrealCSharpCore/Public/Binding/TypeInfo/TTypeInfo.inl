@@ -14,6 +14,18 @@ struct TTypeInfo final : FTypeInfo
 		return std::is_reference_v<T>;
 	}
 
+	constexpr static auto BufferSize() -> int32
+	{
+		if constexpr (TIsPrimitive<T>::Value)
+		{
+			return sizeof(T);
+		}
+		else
+		{
+			return sizeof(void*);
+		}
+	}
+
 	virtual auto GetName() const -> FString override
 	{
 		return TName<T, T>::Get();
@@ -28,14 +40,7 @@ struct TTypeInfo final : FTypeInfo
 
 	virtual auto GetBufferSize() const -> int32 override
 	{
-		if constexpr (TIsPrimitive<T>::Value)
-		{
-			return sizeof(T);
-		}
-		else
-		{
-			return sizeof(void*);
-		}
+		return BufferSize();
 	}
 
 	virtual auto IsRef() const -> bool override
@@ -145,6 +145,8 @@ public:
 
 	static FString GetOverrideFunctionName(const FName& InFunctionName);
 
+	static bool EnableUnboxedOverrideCall();
+
 	static FString GetBindingDirectory();
 
 	static FString GetPluginBaseDir();
@@ -196,6 +198,10 @@ public:
 
 	static FString GetCodeAnalysisPath();
 
+	static FString GetCompileServerCSProjPath();
+
+	static FString GetCompileServerProjectPath();
+
 	static FString GetSourceGeneratorPath();
 
 	static FString GetWeaversPath();
@@ -207,6 +213,10 @@ public:
 
 	static class UAssemblyLoader* GetAssemblyLoader();
 
+	static float GetReleaseQueueTimeBudget();
+
+	static bool IsEnableLazyBind();
+
 	static bool SaveStringToFile(const FString& InFileName, const FString& InString);
 
 	static TMap<FString, TArray<FString>> LoadFileToArray(const FString& InFileName);
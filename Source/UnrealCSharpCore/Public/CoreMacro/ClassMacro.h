@@ -6,6 +6,8 @@
 
 #define CLASS_UTILS FString(TEXT("Utils"))
 
+#define CLASS_BINDING_MANIFEST FString(TEXT("BindingManifest"))
+
 #define CLASS_SYNCHRONIZATION_CONTEXT FString(TEXT("SynchronizationContext"))
 
 #define CLASS_U_CLASS_ATTRIBUTE FString(TEXT("UClassAttribute"))
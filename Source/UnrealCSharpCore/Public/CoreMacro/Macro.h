@@ -26,6 +26,8 @@
 
 #define CODE_ANALYSIS_NAME FString(TEXT("CodeAnalysis"))
 
+#define COMPILE_SERVER_NAME FString(TEXT("CompileServer"))
+
 #define SOURCE_GENERATOR_NAME FString(TEXT("SourceGenerator"))
 
 #define WEAVERS_NAME FString(TEXT("Weavers"))
@@ -0,0 +1,33 @@
+﻿#pragma once
+
+#include "mono/metadata/details/object-types.h"
+
+class UNREALCSHARPCORE_API FBindingManifest
+{
+public:
+	static void Load();
+
+	static void Unload();
+
+	static bool IsValid();
+
+	static bool IsOverrideType(const FString& InNameSpace, const FString& InName);
+
+	static const TArray<FString>* GetOverrideMethods(const FString& InNameSpace, const FString& InName);
+
+	static const TArray<MonoClass*>* GetDynamicClasses(const FString& InAttribute);
+
+private:
+	static bool Load(MonoImage* InImage);
+
+	static FString GetString(MonoClass* InMonoClass, const char* InName);
+
+private:
+	static bool bIsValid;
+
+	static TSet<FString> OverrideTypes;
+
+	static TMap<FString, TArray<FString>> OverrideMethods;
+
+	static TMap<FString, TArray<MonoClass*>> DynamicClasses;
+};
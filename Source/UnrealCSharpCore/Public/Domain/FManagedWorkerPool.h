@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class FEvent;
+
+class FRunnableThread;
+
+/**
+ * Worker threads that stay attached to the managed runtime and run chunked index ranges with work stealing.
+ * Threads start on first use and detach in FMonoDomain::Deinitialize, before the domain goes away.
+ */
+class UNREALCSHARPCORE_API FManagedWorkerPool
+{
+public:
+	typedef TFunction<void(int32 InBegin, int32 InEnd)> FRangeFunction;
+
+public:
+	/**
+	 * Runs InFunction over [0, InNum) in ranges of at most InGrain indexes, InGrain <= 0 picks one per job.
+	 * When bInWait is true the calling thread takes part and returns once every range has run.
+	 */
+	static bool ParallelFor(int32 InNum, int32 InGrain, FRangeFunction&& InFunction, bool bInWait);
+
+	static int32 GetNumWorkers();
+
+	static void Shutdown();
+
+private:
+	struct FJob
+	{
+		struct alignas(PLATFORM_CACHE_LINE_SIZE) FPartition
+		{
+			std::atomic<int32> Next;
+
+			int32 End;
+		};
+
+		FJob(int32 InNum, int32 InGrain, int32 InNumPartitions, FRangeFunction&& InFunction, bool bInWait);
+
+		~FJob();
+
+		bool HasWork() const;
+
+		void Run();
+
+		FRangeFunction Function;
+
+		int32 Grain;
+
+		TArray<FPartition> Partitions;
+
+		std::atomic<int32> NextPartition;
+
+		std::atomic<int32> NumPending;
+
+		FEvent* DoneEvent;
+	};
+
+	class FWorker;
+
+	static bool Startup();
+
+	static TSharedPtr<FJob, ESPMode::ThreadSafe> FindJob();
+
+private:
+	static FCriticalSection CriticalSection;
+
+	static TArray<TSharedPtr<FJob, ESPMode::ThreadSafe>> Jobs;
+
+	static TArray<FWorker*> Workers;
+
+	static TArray<FRunnableThread*> Threads;
+};
@@ -3,11 +3,26 @@
 #include "FMonoObjectTypes.h"
 #include "FMonoDomainInitializeParams.h"
 #include "HAL/ThreadSafeCounter.h"
+#include "Misc/ScopeRWLock.h"
 #include "mono/metadata/appdomain.h"
 #include <atomic>
 
 class FEvent;
 
+struct FClassFromNameKeyFuncs : TDefaultMapKeyFuncs<TPair<FString, FString>, MonoClass*, false>
+{
+	// C# type names are case sensitive, FString hashing and equality are not
+	static bool Matches(KeyInitType A, KeyInitType B)
+	{
+		return A.Key.Equals(B.Key, ESearchCase::CaseSensitive) && A.Value.Equals(B.Value, ESearchCase::CaseSensitive);
+	}
+
+	static uint32 GetKeyHash(KeyInitType InKey)
+	{
+		return HashCombine(FCrc::StrCrc32(*InKey.Key), FCrc::StrCrc32(*InKey.Value));
+	}
+};
+
 class UNREALCSHARPCORE_API FMonoDomain
 {
 public:
@@ -89,6 +104,8 @@ public:
 	static MonoObject* Field_Get_Value_Object(MonoDomain* InMonoDomain, MonoClassField* InMonoClassField,
 	                                          MonoObject* InMonoObject);
 
+	static uint32 Field_Get_Offset(MonoClassField* InMonoClassField);
+
 	static const char* Property_Get_Name(MonoProperty* InMonoProperty);
 
 	static MonoMethod* Property_Get_Get_Method(MonoProperty* InMonoProperty);
@@ -216,6 +233,8 @@ public:
 
 	static MonoClassField* Self_Class_Get_Field_From_Name(MonoClass* InMonoClass, const char* InName);
 
+	static uint32 Class_Get_Garbage_Collection_Handle_Offset(MonoClass* InMonoClass);
+
 	static MonoType* Property_Get_Type(MonoProperty* InMonoProperty);
 
 	static MonoMethod* Class_Get_Method_From_Params(MonoClass* InMonoClass, const FString& InMethodName,
@@ -269,6 +288,11 @@ private:
 
 	static void RegisterProfiler();
 
+	/**
+	 * Managed FName must match the native size and field offsets, it is copied by value through buffers and containers.
+	 */
+	static bool CheckNameLayout(MonoClass* InNameClass);
+
 public:
 	static MonoDomain* Domain;
 
@@ -283,6 +307,14 @@ public:
 	static bool bLoadSucceed;
 
 private:
+	static TMap<MonoClass*, uint32> GarbageCollectionHandleOffsets;
+
+	static TMap<TPair<FString, FString>, MonoClass*, FDefaultSetAllocator, FClassFromNameKeyFuncs> ClassFromNames;
+
+	static FRWLock ClassFromNamesLock;
+
+	static FRWLock GarbageCollectionHandleOffsetsLock;
+
 	static std::atomic<bool> bManagedJobsEnabled;
 
 	static FThreadSafeCounter ManagedJobsInFlight;
@@ -50,6 +50,8 @@ public:
 
 	bool EnableCompiled() const;
 
+	bool EnableCompileServer() const;
+
 	bool EnableAssetChanged() const;
 
 	bool EnableDirectoryChanged() const;
@@ -88,6 +90,9 @@ private:
 	UPROPERTY(Config, EditAnywhere, Category = Generator)
 	bool bEnableCompiled;
 
+	UPROPERTY(Config, EditAnywhere, Category = Generator, meta = (EditCondition = "bEnableCompiled"))
+	bool bEnableCompileServer;
+
 	UPROPERTY(Config, EditAnywhere, Category = Generator)
 	bool bEnableAssetChanged;
 
@@ -92,10 +92,16 @@ public:
 
 	const FString& GetOverrideFunctionNameSuffix() const;
 
+	bool EnableUnboxedOverrideCall() const;
+
 	UAssemblyLoader* GetAssemblyLoader() const;
 
+	float GetReleaseQueueTimeBudget() const;
+
 	const TArray<FBindClass>& GetBindClass() const;
 
+	bool IsEnableLazyBind() const;
+
 	bool IsEnableDebug() const;
 
 	const FString& GetHost() const;
@@ -126,12 +132,21 @@ private:
 	UPROPERTY(Config, EditAnywhere, Category = Override, meta = (EditCondition = "bEnableCallOverrideFunction"))
 	FString OverrideFunctionNameSuffix;
 
+	UPROPERTY(Config, EditAnywhere, Category = Override)
+	bool bEnableUnboxedOverrideCall;
+
 	UPROPERTY(Config, EditAnywhere, Category = Domain)
 	TSubclassOf<UAssemblyLoader> AssemblyLoader;
 
+	UPROPERTY(Config, EditAnywhere, Category = Domain, meta = (ClampMin = "0.0", Units = "Milliseconds"))
+	float ReleaseQueueTimeBudget;
+
 	UPROPERTY(Config, EditAnywhere, Category = Bind)
 	TArray<FBindClass> BindClass;
 
+	UPROPERTY(Config, EditAnywhere, Category = Bind)
+	bool bEnableLazyBind;
+
 	UPROPERTY(Config, EditAnywhere, Category = Debug)
 	bool bEnableDebug;
 
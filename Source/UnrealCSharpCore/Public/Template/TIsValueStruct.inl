@@ -0,0 +1,7 @@
+#pragma once
+
+template <typename T>
+struct TIsValueStruct
+{
+	enum { Value = false };
+};
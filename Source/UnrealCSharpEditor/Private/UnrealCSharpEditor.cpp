@@ -17,6 +17,7 @@
 #include "Settings/ProjectPackagingSettings.h"
 #include "FCodeAnalysis.h"
 #include "Delegate/FUnrealCSharpCoreModuleDelegates.h"
+#include "Log/UnrealCSharpLog.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Dynamic/FDynamicGenerator.h"
 #include "IContentBrowserDataModule.h"
@@ -90,6 +91,14 @@ void FUnrealCSharpEditorModule::StartupModule()
 				});
 			}));
 
+	CompileLatencyConsoleCommand = MakeUnique<FAutoConsoleCommand>(
+		TEXT("UnrealCSharp.Editor.CompileLatency"), TEXT("UnrealCSharp.Editor.CompileLatency [WarmCycles]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda(
+			[](const TArray<FString>& InArgs)
+			{
+				FCSharpCompiler::Get().MeasureLatency(InArgs.IsEmpty() ? 5 : FCString::Atoi(*InArgs[0]));
+			}));
+
 	GeneratorConsoleCommand = MakeUnique<FAutoConsoleCommand>(
 		TEXT("UnrealCSharp.Editor.Generator"), TEXT(""),
 		FConsoleCommandDelegate::CreateLambda(
@@ -98,6 +107,14 @@ void FUnrealCSharpEditorModule::StartupModule()
 				Generator();
 			}));
 
+	GeneratorDeterminismConsoleCommand = MakeUnique<FAutoConsoleCommand>(
+		TEXT("UnrealCSharp.Editor.GeneratorDeterminism"), TEXT(""),
+		FConsoleCommandDelegate::CreateLambda(
+			[]()
+			{
+				GeneratorDeterminism();
+			}));
+
 	UpdatePackagingSettings();
 
 	DynamicDataSource.Reset(NewObject<UDynamicDataSource>(GetTransientPackage(), "DynamicData"));
@@ -302,6 +319,77 @@ void FUnrealCSharpEditorModule::Generator()
 	FUnrealCSharpCoreModuleDelegates::OnEndGenerator.Broadcast();
 }
 
+void FUnrealCSharpEditorModule::GeneratorDeterminism()
+{
+	FUnrealCSharpCoreModuleDelegates::OnBeginGenerator.Broadcast();
+
+	static FString DefaultCultureName = TEXT("en");
+
+	const auto CurrentCultureName = FInternationalization::Get().GetCurrentCulture().Get().GetName();
+
+	if (!CurrentCultureName.Equals(DefaultCultureName))
+	{
+		FInternationalization::Get().SetCurrentCulture(DefaultCultureName);
+	}
+
+	const auto Generate = [](const bool bIsParallel, const TCHAR* InName)
+	{
+		FGeneratorCore::BeginGenerator(bIsParallel);
+
+		const auto StartTime = FPlatformTime::Seconds();
+
+		FClassGenerator::Generator();
+
+		FStructGenerator::Generator();
+
+		FEnumGenerator::Generator();
+
+		UE_LOG(LogUnrealCSharp, Log, TEXT("Generator %s: %.3fs, %d files saved"),
+		       InName, FPlatformTime::Seconds() - StartTime, FGeneratorCore::GetSavedFileNum());
+
+		auto GeneratedFileHash = FGeneratorCore::GetGeneratedFileHash();
+
+		FGeneratorCore::EndGenerator();
+
+		return GeneratedFileHash;
+	};
+
+	// the serial pass brings the files up to date, the parallel passes must then reproduce them without saving
+	const auto SerialFileHash = Generate(false, TEXT("serial"));
+
+	auto bIsDeterministic = true;
+
+	for (auto Index = 0; Index < 2; ++Index)
+	{
+		const auto ParallelFileHash = Generate(true, TEXT("parallel"));
+
+		if (FGeneratorCore::GetSavedFileNum() != 0 || ParallelFileHash.Num() != SerialFileHash.Num())
+		{
+			bIsDeterministic = false;
+		}
+
+		for (const auto& [FileName, Hash] : ParallelFileHash)
+		{
+			if (const auto FoundHash = SerialFileHash.Find(FileName); FoundHash == nullptr || *FoundHash != Hash)
+			{
+				UE_LOG(LogUnrealCSharp, Error, TEXT("Generator output differs: %s"), *FileName);
+
+				bIsDeterministic = false;
+			}
+		}
+	}
+
+	if (!CurrentCultureName.Equals(DefaultCultureName))
+	{
+		FInternationalization::Get().SetCurrentCulture(CurrentCultureName);
+	}
+
+	UE_LOG(LogUnrealCSharp, Log, TEXT("Generator determinism %s (%d files)"),
+	       bIsDeterministic ? TEXT("passed") : TEXT("failed"), SerialFileHash.Num());
+
+	FUnrealCSharpCoreModuleDelegates::OnEndGenerator.Broadcast();
+}
+
 #undef LOCTEXT_NAMESPACE
 
 IMPLEMENT_MODULE(FUnrealCSharpEditorModule, UnrealCSharpEditor)
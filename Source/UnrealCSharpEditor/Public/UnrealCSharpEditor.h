@@ -31,6 +31,9 @@ public:
 
 	static void Generator();
 
+private:
+	static void GeneratorDeterminism();
+
 private:
 	TSharedPtr<class FUnrealCSharpPlayToolBar> UnrealCSharpPlayToolBar;
 
@@ -44,8 +47,12 @@ private:
 
 	TUniquePtr<FAutoConsoleCommand> CompileConsoleCommand;
 
+	TUniquePtr<FAutoConsoleCommand> CompileLatencyConsoleCommand;
+
 	TUniquePtr<FAutoConsoleCommand> GeneratorConsoleCommand;
 
+	TUniquePtr<FAutoConsoleCommand> GeneratorDeterminismConsoleCommand;
+
 	FEditorListener EditorListener;
 
 	FTSTicker::FDelegateHandle TickHandle;